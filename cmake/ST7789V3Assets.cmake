@@ -0,0 +1,74 @@
+# st7789v3_add_assets(<target>
+#     OUTPUT <header.hpp>
+#     [NAMESPACE <namespace>]
+#     ASSETS <name> <format> <file> [<name> <format> <file> ...]
+# )
+#
+# Преобразует изображения (PPM, BMP; PNG - если инструменты собраны с libpng) при сборке
+# в заголовок с ресурсами ImageAsset (image/asset.hpp). Форматы: rgb565, wire, palette,
+# mask, image. Заголовок пересоздается при изменении изображений; каталог заголовка
+# добавляется к путям включения цели.
+# Требуется генератор st7789v3_asset: опция ST7789V3_BUILD_TOOLS или путь в ST7789V3_ASSET_TOOL
+
+set(ST7789V3_ASSET_TOOL "" CACHE FILEPATH "Prebuilt st7789v3_asset generator (empty - build from tools/)")
+
+function(st7789v3_add_assets target)
+    cmake_parse_arguments(ARG "" "OUTPUT;NAMESPACE" "ASSETS" ${ARGN})
+
+    if(NOT ARG_OUTPUT)
+        message(FATAL_ERROR "st7789v3_add_assets: OUTPUT is required")
+    endif()
+    list(LENGTH ARG_ASSETS asset_args)
+    math(EXPR asset_rest "${asset_args} % 3")
+    if(asset_args EQUAL 0 OR NOT asset_rest EQUAL 0)
+        message(FATAL_ERROR "st7789v3_add_assets: ASSETS expects <name> <format> <file> triples")
+    endif()
+
+    # Генератор: готовый файл, цель текущей сборки или внешний проект инструментов
+    get_property(tool_path GLOBAL PROPERTY ST7789V3_ASSET_TOOL_PATH)
+    get_property(tool_target GLOBAL PROPERTY ST7789V3_ASSET_TOOL_TARGET)
+    if(ST7789V3_ASSET_TOOL)
+        set(tool ${ST7789V3_ASSET_TOOL})
+        set(tool_depends ${ST7789V3_ASSET_TOOL})
+    elseif(TARGET st7789v3_asset)
+        set(tool $<TARGET_FILE:st7789v3_asset>)
+        set(tool_depends st7789v3_asset)
+    elseif(tool_path)
+        set(tool ${tool_path})
+        set(tool_depends ${tool_target})
+    else()
+        message(FATAL_ERROR "st7789v3_add_assets: enable ST7789V3_BUILD_TOOLS or set ST7789V3_ASSET_TOOL")
+    endif()
+
+    get_filename_component(output ${ARG_OUTPUT} ABSOLUTE BASE_DIR ${CMAKE_CURRENT_BINARY_DIR})
+    get_filename_component(output_dir ${output} DIRECTORY)
+
+    set(tool_args -o ${output})
+    if(ARG_NAMESPACE)
+        list(APPEND tool_args -N ${ARG_NAMESPACE})
+    endif()
+    set(images)
+    math(EXPR last "${asset_args} - 1")
+    foreach(i RANGE 0 ${last} 3)
+        math(EXPR format_index "${i} + 1")
+        math(EXPR file_index "${i} + 2")
+        list(GET ARG_ASSETS ${i} name)
+        list(GET ARG_ASSETS ${format_index} format)
+        list(GET ARG_ASSETS ${file_index} file)
+        get_filename_component(file ${file} ABSOLUTE BASE_DIR ${CMAKE_CURRENT_SOURCE_DIR})
+        list(APPEND tool_args -a ${name} ${format} ${file})
+        list(APPEND images ${file})
+    endforeach()
+
+    add_custom_command(
+        OUTPUT ${output}
+        COMMAND ${CMAKE_COMMAND} -E make_directory ${output_dir}
+        COMMAND ${tool} ${tool_args}
+        DEPENDS ${images} ${tool_depends}
+        COMMENT "Generating image assets ${ARG_OUTPUT}"
+        VERBATIM
+    )
+
+    target_sources(${target} PRIVATE ${output})
+    target_include_directories(${target} PRIVATE ${output_dir})
+endfunction()
@@ -0,0 +1,61 @@
+#include "color_ramp.hpp"
+
+namespace {
+
+struct ColorRampEntry {
+    uint16_t fg;
+    uint16_t bg;
+    uint8_t bpp;            // 0 - запись пуста
+    uint32_t last_used;
+    uint16_t colors[16];
+};
+
+ColorRampEntry ramp_cache[COLOR_RAMP_CACHE_SIZE];
+uint32_t ramp_clock = 0;
+
+} // namespace
+
+uint16_t ColorRamp_Blend565(uint16_t fg, uint16_t bg, uint8_t level, uint8_t max_level) {
+    if (level >= max_level) return fg;
+    if (level == 0) return bg;
+    
+    uint8_t inv = max_level - level;
+    uint16_t r = (((fg >> 11) & 0x1F) * level + ((bg >> 11) & 0x1F) * inv + max_level / 2) / max_level;
+    uint16_t g = (((fg >> 5) & 0x3F) * level + ((bg >> 5) & 0x3F) * inv + max_level / 2) / max_level;
+    uint16_t b = ((fg & 0x1F) * level + (bg & 0x1F) * inv + max_level / 2) / max_level;
+    
+    return static_cast<uint16_t>((r << 11) | (g << 5) | b);
+}
+
+const uint16_t* ColorRamp_Get(uint16_t fg, uint16_t bg, uint8_t bpp) {
+    // Таблица вмещает 16 уровней; 3 бита на пиксель растр шрифта не поддерживает
+    if (bpp != 1 && bpp != 2 && bpp != 4) {
+        return nullptr;
+    }
+    ramp_clock++;
+    
+    // Поиск готовой таблицы и самой старой записи для вытеснения
+    ColorRampEntry* victim = &ramp_cache[0];
+    for (uint8_t i = 0; i < COLOR_RAMP_CACHE_SIZE; i++) {
+        ColorRampEntry& entry = ramp_cache[i];
+        if (entry.bpp == bpp && entry.fg == fg && entry.bg == bg) {
+            entry.last_used = ramp_clock;
+            return entry.colors;
+        }
+        if (entry.last_used < victim->last_used) {
+            victim = &entry;  // Пустые записи имеют last_used = 0
+        }
+    }
+    
+    // Построение новой таблицы на месте вытесняемой записи
+    uint8_t max_level = static_cast<uint8_t>((1 << bpp) - 1);
+    for (uint8_t level = 0; level <= max_level; level++) {
+        victim->colors[level] = ColorRamp_Blend565(fg, bg, level, max_level);
+    }
+    victim->fg = fg;
+    victim->bg = bg;
+    victim->bpp = bpp;
+    victim->last_used = ramp_clock;
+    
+    return victim->colors;
+}
@@ -0,0 +1,17 @@
+#ifndef COLOR_RAMP_HPP
+#define COLOR_RAMP_HPP
+
+#include <cstdint>
+
+// Количество последних таблиц, хранимых в кэше
+constexpr uint8_t COLOR_RAMP_CACHE_SIZE = 4;
+
+// Таблица из (1 << bpp) цветов RGB565 (bpp - 1, 2 или 4): индекс 0 - фон, последний индекс - цвет текста.
+// Таблицы для последних пар (fg, bg) кэшируются, вытесняется давно не использованная.
+// Для другого bpp возвращается nullptr
+const uint16_t* ColorRamp_Get(uint16_t fg, uint16_t bg, uint8_t bpp);
+
+// Смешивание двух цветов RGB565: level / max_level доли fg
+uint16_t ColorRamp_Blend565(uint16_t fg, uint16_t bg, uint8_t level, uint8_t max_level);
+
+#endif
@@ -1,4 +1,5 @@
 #include "font8x16.hpp"
+#include <cstring>
 
 // ASCII символы (0x20-0x7F)
 static const uint8_t font8x16_ascii[][16] = {
@@ -504,43 +505,150 @@ static const uint8_t font8x16_unknown[16] = {
     0x5A, 0x5A, 0x42, 0x7E, 0x00, 0x00, 0x00, 0x00
 };
 
-uint16_t UTF8_ToUnicode(const char* utf8_char, uint8_t* bytes_consumed) {
+namespace {
+
+constexpr uint32_t UNICODE_REPLACEMENT = 0xFFFD;
+
+// Машинное слово для проверки ASCII: 4 байта на Cortex-M, 8 байт на 64-битных платформах
+using AsciiWord = uintptr_t;
+constexpr AsciiWord ASCII_ONES = static_cast<AsciiWord>(~static_cast<AsciiWord>(0)) / 0xFF;  // 0x0101...
+constexpr AsciiWord ASCII_HIGH = ASCII_ONES * 0x80;                                         // 0x8080...
+
+// true если все байты слова - ASCII без завершающего нуля
+inline bool isAsciiWord(AsciiWord word) {
+    bool has_high = (word & ASCII_HIGH) != 0;
+    bool has_zero = ((word - ASCII_ONES) & ~word & ASCII_HIGH) != 0;
+    return !has_high && !has_zero;
+}
+
+// Длина участка чистого ASCII начиная с str (не более limit байт).
+// Слова читаются только по выровненным адресам, поэтому чтение не выходит за пределы
+// страницы памяти, в которой лежит завершающий ноль (как в strlen из libc).
+// Байты после нуля внутри слова не используются, поэтому ASan для функции отключен.
+#if defined(__GNUC__)
+__attribute__((no_sanitize_address))
+#endif
+uint32_t asciiRunLength(const char* str, uint32_t limit) {
+    uint32_t length = 0;
+    
+    // Выравнивание до границы слова побайтово
+    while (length < limit && (reinterpret_cast<uintptr_t>(str + length) & (sizeof(AsciiWord) - 1)) != 0) {
+        uint8_t byte = static_cast<uint8_t>(str[length]);
+        if (byte == 0 || byte >= 0x80) return length;
+        length++;
+    }
+    
+    while (length + sizeof(AsciiWord) <= limit) {
+        AsciiWord word;
+        memcpy(&word, str + length, sizeof(word));  // Выровненное чтение одного слова
+        if (!isAsciiWord(word)) break;
+        length += sizeof(AsciiWord);
+    }
+    
+    while (length < limit) {
+        uint8_t byte = static_cast<uint8_t>(str[length]);
+        if (byte == 0 || byte >= 0x80) break;
+        length++;
+    }
+    
+    return length;
+}
+
+inline bool isContinuation(char byte) {
+    return (static_cast<uint8_t>(byte) & 0xC0) == 0x80;
+}
+
+// Глиф ASCII символа без проверки диапазонов Unicode
+inline const uint8_t* asciiGlyph(uint8_t ch) {
+    return (ch >= FONT8X16_ASCII_START) ? font8x16_ascii[ch - FONT8X16_ASCII_START] : font8x16_unknown;
+}
+
+} // namespace
+
+uint32_t UTF8_Decode(const char* utf8_char, uint8_t* bytes_consumed) {
     uint8_t first_byte = static_cast<uint8_t>(utf8_char[0]);
     
-    if ((first_byte & 0x80) == 0) {
+    if (first_byte < 0x80) {
         // ASCII символ (0xxxxxxx)
         *bytes_consumed = 1;
         return first_byte;
-    } else if ((first_byte & 0xE0) == 0xC0) {
+    }
+    
+    uint8_t length;
+    uint32_t code;
+    uint32_t min_code;
+    
+    if ((first_byte & 0xE0) == 0xC0) {
         // 2-байтовый символ (110xxxxx 10xxxxxx)
-        if (utf8_char[1] == 0 || (utf8_char[1] & 0xC0) != 0x80) {
-            *bytes_consumed = 1;
-            return 0xFFFD; // Replacement character
-        }
-        *bytes_consumed = 2;
-        return ((first_byte & 0x1F) << 6) | (utf8_char[1] & 0x3F);
+        length = 2;
+        code = first_byte & 0x1F;
+        min_code = 0x80;
     } else if ((first_byte & 0xF0) == 0xE0) {
         // 3-байтовый символ (1110xxxx 10xxxxxx 10xxxxxx)
-        if (utf8_char[1] == 0 || utf8_char[2] == 0 ||
-            (utf8_char[1] & 0xC0) != 0x80 || (utf8_char[2] & 0xC0) != 0x80) {
+        length = 3;
+        code = first_byte & 0x0F;
+        min_code = 0x800;
+    } else if ((first_byte & 0xF8) == 0xF0) {
+        // 4-байтовый символ (11110xxx 10xxxxxx 10xxxxxx 10xxxxxx)
+        length = 4;
+        code = first_byte & 0x07;
+        min_code = 0x10000;
+    } else {
+        *bytes_consumed = 1;
+        return UNICODE_REPLACEMENT;
+    }
+    
+    // Завершающий ноль не является байтом продолжения, поэтому за строку не выходим
+    for (uint8_t i = 1; i < length; i++) {
+        if (!isContinuation(utf8_char[i])) {
             *bytes_consumed = 1;
-            return 0xFFFD; // Replacement character
+            return UNICODE_REPLACEMENT;
+        }
+        code = (code << 6) | (static_cast<uint8_t>(utf8_char[i]) & 0x3F);
+    }
+    
+    // Избыточные последовательности, суррогаты и коды за пределами Unicode
+    if (code < min_code || code > 0x10FFFF || (code >= 0xD800 && code <= 0xDFFF)) {
+        *bytes_consumed = 1;
+        return UNICODE_REPLACEMENT;
+    }
+    
+    *bytes_consumed = length;
+    return code;
+}
+
+uint16_t UTF8_ToUnicode(const char* utf8_char, uint8_t* bytes_consumed) {
+    uint32_t code = UTF8_Decode(utf8_char, bytes_consumed);
+    return (code > 0xFFFF) ? static_cast<uint16_t>(UNICODE_REPLACEMENT) : static_cast<uint16_t>(code);
+}
+
+uint8_t UTF8_DecodeBatch(const char** utf8_str, uint32_t* codepoints, uint8_t max_codepoints) {
+    const char* ptr = *utf8_str;
+    uint8_t count = 0;
+    
+    while (count < max_codepoints && *ptr) {
+        uint32_t ascii = asciiRunLength(ptr, max_codepoints - count);
+        for (uint32_t i = 0; i < ascii; i++) {
+            codepoints[count++] = static_cast<uint8_t>(ptr[i]);
+        }
+        ptr += ascii;
+        
+        if (count < max_codepoints && *ptr) {
+            uint8_t bytes_consumed;
+            codepoints[count++] = UTF8_Decode(ptr, &bytes_consumed);
+            ptr += bytes_consumed;
         }
-        *bytes_consumed = 3;
-        return ((first_byte & 0x0F) << 12) | 
-               ((utf8_char[1] & 0x3F) << 6) | 
-               (utf8_char[2] & 0x3F);
     }
     
-    *bytes_consumed = 1;
-    return 0xFFFD; // Replacement character
+    *utf8_str = ptr;
+    return count;
 }
 
 bool UTF8_IsMultibyte(uint8_t first_byte) {
     return (first_byte & 0x80) != 0;
 }
 
-const uint8_t* Font8x16_GetChar(uint16_t unicode_char) {
+const uint8_t* Font8x16_GetChar(uint32_t unicode_char) {
     // ASCII символы
     if (unicode_char >= FONT8X16_ASCII_START && unicode_char <= FONT8X16_ASCII_END) {
         return font8x16_ascii[unicode_char - FONT8X16_ASCII_START];
@@ -566,6 +674,29 @@ const uint8_t* Font8x16_GetChar(uint16_t unicode_char) {
 }
 
 const uint8_t* Font8x16_GetCharUTF8(const char* utf8_char, uint8_t* bytes_consumed) {
-    uint16_t unicode = UTF8_ToUnicode(utf8_char, bytes_consumed);
+    uint32_t unicode = UTF8_Decode(utf8_char, bytes_consumed);
     return Font8x16_GetChar(unicode);
+}
+
+uint8_t Font8x16_GetGlyphs(const char** utf8_str, const uint8_t** glyphs, uint8_t max_glyphs) {
+    const char* ptr = *utf8_str;
+    uint8_t count = 0;
+    
+    while (count < max_glyphs && *ptr) {
+        // Участок ASCII отображается на глифы напрямую
+        uint32_t ascii = asciiRunLength(ptr, max_glyphs - count);
+        for (uint32_t i = 0; i < ascii; i++) {
+            glyphs[count++] = asciiGlyph(static_cast<uint8_t>(ptr[i]));
+        }
+        ptr += ascii;
+        
+        if (count < max_glyphs && *ptr) {
+            uint8_t bytes_consumed;
+            glyphs[count++] = Font8x16_GetCharUTF8(ptr, &bytes_consumed);
+            ptr += bytes_consumed;
+        }
+    }
+    
+    *utf8_str = ptr;
+    return count;
 }
\ No newline at end of file
@@ -13,12 +13,22 @@ constexpr uint16_t FONT8X16_ASCII_END = 0x7F;    // DEL
 constexpr uint16_t FONT8X16_CYRILLIC_START = 0x0410; // А
 constexpr uint16_t FONT8X16_CYRILLIC_END = 0x044F;   // я
 
+// Размер пакета при декодировании строк
+constexpr uint8_t FONT8X16_GLYPH_BATCH = 16;
+
 // Функции для работы со шрифтом
-const uint8_t* Font8x16_GetChar(uint16_t unicode_char);
+const uint8_t* Font8x16_GetChar(uint32_t unicode_char);
 const uint8_t* Font8x16_GetCharUTF8(const char* utf8_char, uint8_t* bytes_consumed);
 
+// Пакетное декодирование строки в указатели на глифы (не более max_glyphs).
+// Возвращает количество глифов, *utf8_str продвигается за декодированные символы.
+// Участки чистого ASCII проверяются словами по 4/8 байт и отображаются на глифы без декодирования
+uint8_t Font8x16_GetGlyphs(const char** utf8_str, const uint8_t** glyphs, uint8_t max_glyphs);
+
 // Утилиты для UTF-8
-uint16_t UTF8_ToUnicode(const char* utf8_char, uint8_t* bytes_consumed);
+uint32_t UTF8_Decode(const char* utf8_char, uint8_t* bytes_consumed);  // Полный диапазон U+0000..U+10FFFF
+uint16_t UTF8_ToUnicode(const char* utf8_char, uint8_t* bytes_consumed); // Символы вне BMP -> U+FFFD
+uint8_t UTF8_DecodeBatch(const char** utf8_str, uint32_t* codepoints, uint8_t max_codepoints);
 bool UTF8_IsMultibyte(uint8_t first_byte);
 
 #endif
\ No newline at end of file
@@ -0,0 +1,1063 @@
+#include "font_aa16x32.hpp"
+
+// Сглаженный шрифт 16x32, 4 бита на пиксель (16 уровней покрытия).
+// Получен из font8x16 двукратным увеличением EPX до 32x64, сглаживанием 3x3
+// и усреднением 2x2.
+// Строки выровнены по байту, старший полубайт - левый пиксель.
+static const uint8_t font_aa16x32_bitmap[] = {
+    // ! (0x21)
+    0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x15, 0xAA, 0x51, 0x00, 0x01, 0x9E, 0xFF, 0xE9, 0x10, 0x05,
+    0xEF, 0xFF, 0xFE, 0x50, 0x1A, 0xFF, 0xFF, 0xFF, 0xA1, 0x2D, 0xFF, 0xFF, 0xFF, 0xD2, 0x2D, 0xFF,
+    0xFF, 0xFF, 0xD2, 0x1A, 0xFF, 0xFF, 0xFF, 0xA1, 0x05, 0xEF, 0xFF, 0xFE, 0x50, 0x01, 0xAF, 0xFF,
+    0xFA, 0x10, 0x00, 0x5E, 0xFF, 0xE5, 0x00, 0x00, 0x2D, 0xFF, 0xD2, 0x00, 0x00, 0x2D, 0xFF, 0xD2,
+    0x00, 0x00, 0x1A, 0xFF, 0xA1, 0x00, 0x00, 0x04, 0xAA, 0x40, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00,
+    0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x04, 0xAA, 0x40, 0x00, 0x00, 0x1A, 0xFF, 0xA1, 0x00, 0x00,
+    0x1A, 0xFF, 0xA1, 0x00, 0x00, 0x04, 0xAA, 0x40, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00,
+    // " (0x22)
+    0x00, 0x11, 0x00, 0x00, 0x00, 0x11, 0x00, 0x04, 0xAA, 0x40, 0x00, 0x04, 0xAA, 0x40, 0x1A, 0xFF,
+    0xA1, 0x00, 0x1A, 0xFF, 0xA1, 0x2D, 0xFF, 0xD2, 0x00, 0x2D, 0xFF, 0xD2, 0x2D, 0xFF, 0xD2, 0x00,
+    0x2D, 0xFF, 0xD2, 0x1A, 0xFF, 0xD2, 0x00, 0x2D, 0xFF, 0xA1, 0x05, 0xEF, 0xD2, 0x00, 0x2D, 0xFE,
+    0x50, 0x01, 0xAF, 0xD2, 0x00, 0x2D, 0xFA, 0x10, 0x00, 0x4A, 0x91, 0x00, 0x19, 0xA4, 0x00, 0x00,
+    0x01, 0x10, 0x00, 0x01, 0x10, 0x00,
+    // # (0x23)
+    0x00, 0x01, 0x10, 0x00, 0x01, 0x10, 0x00, 0x00, 0x00, 0x4A, 0xA4, 0x00, 0x4A, 0xA4, 0x00, 0x00,
+    0x01, 0xAF, 0xFA, 0x11, 0xAF, 0xFA, 0x10, 0x00, 0x05, 0xEF, 0xFD, 0x22, 0xDF, 0xFE, 0x50, 0x00,
+    0x4B, 0xFF, 0xFE, 0x66, 0xEF, 0xFF, 0xB4, 0x00, 0xAF, 0xFF, 0xFF, 0xEE, 0xFF, 0xFF, 0xFA, 0x10,
+    0xAF, 0xFF, 0xFF, 0xEE, 0xFF, 0xFF, 0xFA, 0x10, 0x4B, 0xFF, 0xFE, 0x66, 0xEF, 0xFF, 0xB4, 0x00,
+    0x05, 0xEF, 0xFD, 0x22, 0xDF, 0xFE, 0x50, 0x00, 0x02, 0xDF, 0xFD, 0x22, 0xDF, 0xFD, 0x20, 0x00,
+    0x02, 0xDF, 0xFD, 0x22, 0xDF, 0xFD, 0x20, 0x00, 0x05, 0xEF, 0xFD, 0x22, 0xDF, 0xFE, 0x50, 0x00,
+    0x4B, 0xFF, 0xFE, 0x66, 0xEF, 0xFF, 0xB4, 0x00, 0xAF, 0xFF, 0xFF, 0xEE, 0xFF, 0xFF, 0xFA, 0x10,
+    0xAF, 0xFF, 0xFF, 0xEE, 0xFF, 0xFF, 0xFA, 0x10, 0x4B, 0xFF, 0xFE, 0x66, 0xEF, 0xFF, 0xB4, 0x00,
+    0x05, 0xEF, 0xFD, 0x22, 0xDF, 0xFE, 0x50, 0x00, 0x01, 0xAF, 0xFA, 0x11, 0xAF, 0xFA, 0x10, 0x00,
+    0x00, 0x4A, 0xA4, 0x00, 0x4A, 0xA4, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x01, 0x10, 0x00, 0x00,
+    // $ (0x24)
+    0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x99, 0x10, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x02, 0xDD, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xEE, 0x50, 0x00, 0x00, 0x00,
+    0x00, 0x01, 0x5B, 0xFF, 0xB5, 0x10, 0x00, 0x00, 0x01, 0x5A, 0xEF, 0xFF, 0xFE, 0xA5, 0x10, 0x00,
+    0x19, 0xEF, 0xEE, 0xFF, 0xEE, 0xFE, 0xA4, 0x00, 0x5E, 0xFE, 0x66, 0xEE, 0x65, 0xBF, 0xFA, 0x10,
+    0xAF, 0xFD, 0x22, 0xDD, 0x20, 0x4A, 0xD9, 0x10, 0xDF, 0xFD, 0x22, 0xDD, 0x20, 0x01, 0x21, 0x00,
+    0xDF, 0xFD, 0x22, 0xDD, 0x20, 0x00, 0x00, 0x00, 0xAF, 0xFD, 0x22, 0xDE, 0x50, 0x00, 0x00, 0x00,
+    0x5E, 0xFE, 0x66, 0xEF, 0xB5, 0x10, 0x00, 0x00, 0x19, 0xEF, 0xEE, 0xFF, 0xFE, 0xA5, 0x10, 0x00,
+    0x01, 0x5A, 0xEF, 0xFF, 0xEE, 0xFE, 0x91, 0x00, 0x00, 0x01, 0x5B, 0xFE, 0x66, 0xEF, 0xE5, 0x00,
+    0x00, 0x00, 0x05, 0xED, 0x22, 0xDF, 0xFA, 0x10, 0x00, 0x00, 0x02, 0xDD, 0x22, 0xDF, 0xFD, 0x20,
+    0x12, 0x10, 0x02, 0xDD, 0x22, 0xDF, 0xFD, 0x20, 0x9D, 0xA4, 0x02, 0xDD, 0x22, 0xDF, 0xFA, 0x10,
+    0xAF, 0xFB, 0x56, 0xEE, 0x66, 0xEF, 0xE5, 0x00, 0x4A, 0xEF, 0xEE, 0xFF, 0xEE, 0xFE, 0x91, 0x00,
+    0x01, 0x5A, 0xEF, 0xFF, 0xFE, 0xA5, 0x10, 0x00, 0x00, 0x01, 0x5B, 0xFF, 0xB5, 0x10, 0x00, 0x00,
+    0x00, 0x00, 0x05, 0xEE, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xDD, 0x20, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x01, 0x99, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00,
+    // % (0x25)
+    0x01, 0x10, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x4A, 0xA4, 0x00, 0x00, 0x00, 0x04, 0xA9, 0x10,
+    0xAF, 0xFA, 0x10, 0x00, 0x00, 0x1A, 0xFD, 0x20, 0xAF, 0xFA, 0x10, 0x00, 0x01, 0x6E, 0xFA, 0x10,
+    0x4A, 0xA4, 0x00, 0x00, 0x19, 0xEF, 0xE5, 0x00, 0x01, 0x10, 0x00, 0x01, 0x6E, 0xFE, 0x91, 0x00,
+    0x00, 0x00, 0x00, 0x19, 0xEF, 0xE6, 0x10, 0x00, 0x00, 0x00, 0x01, 0x6E, 0xFE, 0x91, 0x00, 0x00,
+    0x00, 0x00, 0x19, 0xEF, 0xE6, 0x10, 0x00, 0x00, 0x00, 0x01, 0x6E, 0xFE, 0x91, 0x00, 0x00, 0x00,
+    0x00, 0x19, 0xEF, 0xE6, 0x10, 0x00, 0x00, 0x00, 0x01, 0x6E, 0xFE, 0x91, 0x00, 0x00, 0x00, 0x00,
+    0x19, 0xEF, 0xE6, 0x10, 0x00, 0x01, 0x10, 0x00, 0x5E, 0xFE, 0x91, 0x00, 0x00, 0x4A, 0xA4, 0x00,
+    0xAF, 0xE6, 0x10, 0x00, 0x01, 0xAF, 0xFA, 0x10, 0xDF, 0xA1, 0x00, 0x00, 0x01, 0xAF, 0xFA, 0x10,
+    0x9A, 0x40, 0x00, 0x00, 0x00, 0x4A, 0xA4, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00,
+    // & (0x26)
+    0x00, 0x00, 0x01, 0x22, 0x10, 0x00, 0x00, 0x00, 0x00, 0x01, 0x5A, 0xDD, 0xA5, 0x10, 0x00, 0x00,
+    0x00, 0x19, 0xEF, 0xEE, 0xFE, 0x91, 0x00, 0x00, 0x00, 0x5E, 0xFE, 0x66, 0xEF, 0xE5, 0x00, 0x00,
+    0x01, 0xAF, 0xFD, 0x22, 0xDF, 0xFA, 0x10, 0x00, 0x01, 0xAF, 0xFD, 0x22, 0xDF, 0xFA, 0x10, 0x00,
+    0x00, 0x4B, 0xFE, 0x66, 0xEF, 0xB4, 0x00, 0x00, 0x00, 0x05, 0xEF, 0xEE, 0xFB, 0x40, 0x00, 0x00,
+    0x00, 0x05, 0xEF, 0xFF, 0xB4, 0x01, 0x21, 0x00, 0x01, 0x5B, 0xFF, 0xFE, 0x50, 0x4A, 0xD9, 0x10,
+    0x19, 0xEF, 0xEE, 0xFE, 0x65, 0xBF, 0xFA, 0x10, 0x5E, 0xFE, 0x65, 0xBF, 0xEE, 0xFF, 0xB4, 0x00,
+    0xAF, 0xFD, 0x20, 0x5E, 0xFF, 0xFE, 0x50, 0x00, 0xDF, 0xFD, 0x20, 0x1A, 0xFF, 0xFD, 0x20, 0x00,
+    0xDF, 0xFD, 0x20, 0x05, 0xEF, 0xFD, 0x20, 0x00, 0xDF, 0xFD, 0x20, 0x02, 0xDF, 0xFD, 0x20, 0x00,
+    0xDF, 0xFD, 0x20, 0x02, 0xDF, 0xFD, 0x20, 0x00, 0xAF, 0xFE, 0x50, 0x04, 0xBF, 0xFE, 0x50, 0x00,
+    0x5E, 0xFF, 0xB5, 0x5B, 0x4B, 0xFF, 0xB4, 0x00, 0x19, 0xEF, 0xFE, 0xED, 0x24, 0xBF, 0xFA, 0x10,
+    0x01, 0x5A, 0xDD, 0xD9, 0x10, 0x4A, 0xD9, 0x10, 0x00, 0x01, 0x22, 0x21, 0x00, 0x01, 0x21, 0x00,
+    // ' (0x27)
+    0x00, 0x00, 0x11, 0x00, 0x00, 0x04, 0xAA, 0x40, 0x00, 0x1A, 0xFF, 0xA1, 0x00, 0x2D, 0xFF, 0xD2,
+    0x00, 0x2D, 0xFF, 0xD2, 0x00, 0x5E, 0xFF, 0xA1, 0x04, 0xBF, 0xFE, 0x50, 0x1A, 0xFF, 0xE9, 0x10,
+    0x19, 0xDA, 0x51, 0x00, 0x01, 0x21, 0x00, 0x00,
+    // ( (0x28)
+    0x00, 0x00, 0x00, 0x12, 0x10, 0x00, 0x00, 0x15, 0xAD, 0x91, 0x00, 0x01, 0x9E, 0xFF, 0xA1, 0x00,
+    0x16, 0xEF, 0xEA, 0x40, 0x01, 0x9E, 0xFE, 0x61, 0x00, 0x05, 0xEF, 0xFA, 0x10, 0x00, 0x1A, 0xFF,
+    0xE5, 0x00, 0x00, 0x2D, 0xFF, 0xD2, 0x00, 0x00, 0x2D, 0xFF, 0xD2, 0x00, 0x00, 0x2D, 0xFF, 0xD2,
+    0x00, 0x00, 0x2D, 0xFF, 0xD2, 0x00, 0x00, 0x2D, 0xFF, 0xD2, 0x00, 0x00, 0x2D, 0xFF, 0xD2, 0x00,
+    0x00, 0x2D, 0xFF, 0xD2, 0x00, 0x00, 0x2D, 0xFF, 0xD2, 0x00, 0x00, 0x1A, 0xFF, 0xE5, 0x00, 0x00,
+    0x05, 0xEF, 0xFA, 0x10, 0x00, 0x01, 0x9E, 0xFE, 0x61, 0x00, 0x00, 0x16, 0xEF, 0xEA, 0x40, 0x00,
+    0x01, 0x9E, 0xFF, 0xA1, 0x00, 0x00, 0x15, 0xAD, 0x91, 0x00, 0x00, 0x00, 0x12, 0x10,
+    // ) (0x29)
+    0x01, 0x21, 0x00, 0x00, 0x00, 0x19, 0xDA, 0x51, 0x00, 0x00, 0x1A, 0xFF, 0xE9, 0x10, 0x00, 0x04,
+    0xAE, 0xFE, 0x61, 0x00, 0x00, 0x16, 0xEF, 0xE9, 0x10, 0x00, 0x01, 0xAF, 0xFE, 0x50, 0x00, 0x00,
+    0x5E, 0xFF, 0xA1, 0x00, 0x00, 0x2D, 0xFF, 0xD2, 0x00, 0x00, 0x2D, 0xFF, 0xD2, 0x00, 0x00, 0x2D,
+    0xFF, 0xD2, 0x00, 0x00, 0x2D, 0xFF, 0xD2, 0x00, 0x00, 0x2D, 0xFF, 0xD2, 0x00, 0x00, 0x2D, 0xFF,
+    0xD2, 0x00, 0x00, 0x2D, 0xFF, 0xD2, 0x00, 0x00, 0x2D, 0xFF, 0xD2, 0x00, 0x00, 0x5E, 0xFF, 0xA1,
+    0x00, 0x01, 0xAF, 0xFE, 0x50, 0x00, 0x16, 0xEF, 0xE9, 0x10, 0x04, 0xAE, 0xFE, 0x61, 0x00, 0x1A,
+    0xFF, 0xE9, 0x10, 0x00, 0x19, 0xDA, 0x51, 0x00, 0x00, 0x01, 0x21, 0x00, 0x00, 0x00,
+    // * (0x2A)
+    0x00, 0x12, 0x10, 0x00, 0x00, 0x01, 0x21, 0x00, 0x01, 0x9D, 0xA5, 0x10, 0x01, 0x5A, 0xD9, 0x10,
+    0x01, 0x9E, 0xFE, 0xA5, 0x5A, 0xEF, 0xE9, 0x10, 0x00, 0x16, 0xEF, 0xFE, 0xEF, 0xFE, 0x61, 0x00,
+    0x12, 0x26, 0xEF, 0xFF, 0xFF, 0xFE, 0x62, 0x21, 0x9D, 0xDE, 0xFF, 0xFF, 0xFF, 0xFF, 0xED, 0xD9,
+    0x9D, 0xDE, 0xFF, 0xFF, 0xFF, 0xFF, 0xED, 0xD9, 0x12, 0x26, 0xEF, 0xFF, 0xFF, 0xFE, 0x62, 0x21,
+    0x00, 0x16, 0xEF, 0xFE, 0xEF, 0xFE, 0x61, 0x00, 0x01, 0x9E, 0xFE, 0xA5, 0x5A, 0xEF, 0xE9, 0x10,
+    0x01, 0x9D, 0xA5, 0x10, 0x01, 0x5A, 0xD9, 0x10, 0x00, 0x12, 0x10, 0x00, 0x00, 0x01, 0x21, 0x00,
+    // + (0x2B)
+    0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xAA, 0x40, 0x00, 0x00, 0x00, 0x00,
+    0x1A, 0xFF, 0xA1, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xE5, 0x00, 0x00, 0x01, 0x25, 0xBF, 0xFF,
+    0xFB, 0x52, 0x10, 0x19, 0xDE, 0xFF, 0xFF, 0xFF, 0xED, 0x91, 0x19, 0xDE, 0xFF, 0xFF, 0xFF, 0xED,
+    0x91, 0x01, 0x25, 0xBF, 0xFF, 0xFB, 0x52, 0x10, 0x00, 0x00, 0x5E, 0xFF, 0xE5, 0x00, 0x00, 0x00,
+    0x00, 0x1A, 0xFF, 0xA1, 0x00, 0x00, 0x00, 0x00, 0x04, 0xAA, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x11, 0x00, 0x00, 0x00,
+    // , (0x2C)
+    0x00, 0x00, 0x11, 0x00, 0x00, 0x04, 0xAA, 0x40, 0x00, 0x1A, 0xFF, 0xA1, 0x00, 0x2D, 0xFF, 0xD2,
+    0x00, 0x2D, 0xFF, 0xD2, 0x00, 0x5E, 0xFF, 0xA1, 0x04, 0xBF, 0xFE, 0x50, 0x1A, 0xFF, 0xE9, 0x10,
+    0x19, 0xDA, 0x51, 0x00, 0x01, 0x21, 0x00, 0x00,
+    // - (0x2D)
+    0x12, 0x22, 0x22, 0x22, 0x22, 0x22, 0x21, 0x00, 0x9D, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xD9, 0x10,
+    0x9D, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xD9, 0x10, 0x12, 0x22, 0x22, 0x22, 0x22, 0x22, 0x21, 0x00,
+    // . (0x2E)
+    0x00, 0x11, 0x00, 0x04, 0xAA, 0x40, 0x1A, 0xFF, 0xA1, 0x1A, 0xFF, 0xA1, 0x04, 0xAA, 0x40, 0x00,
+    0x11, 0x00,
+    // / (0x2F)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xA9, 0x10,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0xFD, 0x20, 0x00, 0x00, 0x00, 0x00, 0x01, 0x6E, 0xFA, 0x10,
+    0x00, 0x00, 0x00, 0x00, 0x19, 0xEF, 0xE5, 0x00, 0x00, 0x00, 0x00, 0x01, 0x6E, 0xFE, 0x91, 0x00,
+    0x00, 0x00, 0x00, 0x19, 0xEF, 0xE6, 0x10, 0x00, 0x00, 0x00, 0x01, 0x6E, 0xFE, 0x91, 0x00, 0x00,
+    0x00, 0x00, 0x19, 0xEF, 0xE6, 0x10, 0x00, 0x00, 0x00, 0x01, 0x6E, 0xFE, 0x91, 0x00, 0x00, 0x00,
+    0x00, 0x19, 0xEF, 0xE6, 0x10, 0x00, 0x00, 0x00, 0x01, 0x6E, 0xFE, 0x91, 0x00, 0x00, 0x00, 0x00,
+    0x19, 0xEF, 0xE6, 0x10, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFE, 0x91, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xAF, 0xE6, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDF, 0xA1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x9A, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // 0 (0x30)
+    0x00, 0x01, 0x22, 0x22, 0x22, 0x10, 0x00, 0x00, 0x01, 0x5A, 0xDD, 0xDD, 0xDD, 0xA5, 0x10, 0x00,
+    0x19, 0xEF, 0xFE, 0xDD, 0xEF, 0xFE, 0x91, 0x00, 0x5E, 0xFF, 0xB5, 0x22, 0x5B, 0xFF, 0xE5, 0x00,
+    0xAF, 0xFE, 0x50, 0x00, 0x05, 0xEF, 0xFA, 0x10, 0xDF, 0xFD, 0x20, 0x00, 0x05, 0xEF, 0xFD, 0x20,
+    0xDF, 0xFD, 0x20, 0x00, 0x1A, 0xFF, 0xFD, 0x20, 0xDF, 0xFD, 0x20, 0x01, 0x6E, 0xFF, 0xFD, 0x20,
+    0xDF, 0xFD, 0x20, 0x19, 0xEF, 0xFF, 0xFD, 0x20, 0xDF, 0xFD, 0x20, 0x5E, 0xFF, 0xFF, 0xFD, 0x20,
+    0xDF, 0xFE, 0x65, 0xBF, 0xEE, 0xFF, 0xFD, 0x20, 0xDF, 0xFF, 0xEE, 0xFB, 0x56, 0xEF, 0xFD, 0x20,
+    0xDF, 0xFF, 0xFF, 0xE5, 0x02, 0xDF, 0xFD, 0x20, 0xDF, 0xFF, 0xFE, 0x91, 0x02, 0xDF, 0xFD, 0x20,
+    0xDF, 0xFF, 0xE6, 0x10, 0x02, 0xDF, 0xFD, 0x20, 0xDF, 0xFF, 0xA1, 0x00, 0x02, 0xDF, 0xFD, 0x20,
+    0xDF, 0xFE, 0x50, 0x00, 0x02, 0xDF, 0xFD, 0x20, 0xAF, 0xFE, 0x50, 0x00, 0x05, 0xEF, 0xFA, 0x10,
+    0x5E, 0xFF, 0xB5, 0x22, 0x5B, 0xFF, 0xE5, 0x00, 0x19, 0xEF, 0xFE, 0xDD, 0xEF, 0xFE, 0x91, 0x00,
+    0x01, 0x5A, 0xDD, 0xDD, 0xDD, 0xA5, 0x10, 0x00, 0x00, 0x01, 0x22, 0x22, 0x22, 0x10, 0x00, 0x00,
+    // 1 (0x31)
+    0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0xAA, 0x40, 0x00, 0x00, 0x00, 0x01,
+    0x9E, 0xFF, 0xA1, 0x00, 0x00, 0x00, 0x16, 0xEF, 0xFF, 0xD2, 0x00, 0x00, 0x04, 0xAE, 0xFF, 0xFF,
+    0xD2, 0x00, 0x00, 0x1A, 0xFF, 0xFF, 0xFF, 0xD2, 0x00, 0x00, 0x19, 0xDE, 0xFF, 0xFF, 0xD2, 0x00,
+    0x00, 0x01, 0x25, 0xBF, 0xFF, 0xD2, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xD2, 0x00, 0x00, 0x00,
+    0x00, 0x2D, 0xFF, 0xD2, 0x00, 0x00, 0x00, 0x00, 0x2D, 0xFF, 0xD2, 0x00, 0x00, 0x00, 0x00, 0x2D,
+    0xFF, 0xD2, 0x00, 0x00, 0x00, 0x00, 0x2D, 0xFF, 0xD2, 0x00, 0x00, 0x00, 0x00, 0x2D, 0xFF, 0xD2,
+    0x00, 0x00, 0x00, 0x00, 0x2D, 0xFF, 0xD2, 0x00, 0x00, 0x00, 0x00, 0x2D, 0xFF, 0xD2, 0x00, 0x00,
+    0x00, 0x00, 0x2D, 0xFF, 0xD2, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xE5, 0x00, 0x00, 0x01, 0x25,
+    0xBF, 0xFF, 0xFB, 0x52, 0x10, 0x19, 0xDE, 0xFF, 0xFF, 0xFF, 0xED, 0x91, 0x19, 0xDD, 0xDD, 0xDD,
+    0xDD, 0xDD, 0x91, 0x01, 0x22, 0x22, 0x22, 0x22, 0x22, 0x10,
+    // 2 (0x32)
+    0x00, 0x01, 0x22, 0x22, 0x22, 0x10, 0x00, 0x00, 0x01, 0x5A, 0xDD, 0xDD, 0xDD, 0xA5, 0x10, 0x00,
+    0x4A, 0xEF, 0xFE, 0xDD, 0xEF, 0xFE, 0x91, 0x00, 0xAF, 0xFE, 0xA5, 0x22, 0x5B, 0xFF, 0xE5, 0x00,
+    0x9D, 0xA5, 0x10, 0x00, 0x05, 0xEF, 0xFA, 0x10, 0x12, 0x10, 0x00, 0x00, 0x05, 0xEF, 0xFA, 0x10,
+    0x00, 0x00, 0x00, 0x00, 0x1A, 0xFF, 0xE5, 0x00, 0x00, 0x00, 0x00, 0x01, 0x6E, 0xFE, 0x91, 0x00,
+    0x00, 0x00, 0x00, 0x19, 0xEF, 0xE6, 0x10, 0x00, 0x00, 0x00, 0x01, 0x6E, 0xFE, 0x91, 0x00, 0x00,
+    0x00, 0x00, 0x19, 0xEF, 0xE6, 0x10, 0x00, 0x00, 0x00, 0x01, 0x6E, 0xFE, 0x91, 0x00, 0x00, 0x00,
+    0x00, 0x19, 0xEF, 0xE6, 0x10, 0x00, 0x00, 0x00, 0x01, 0x6E, 0xFE, 0x91, 0x00, 0x00, 0x00, 0x00,
+    0x19, 0xEF, 0xE6, 0x10, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xA1, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xAF, 0xFE, 0x50, 0x00, 0x00, 0x01, 0x10, 0x00, 0xDF, 0xFE, 0x50, 0x00, 0x01, 0x5A, 0xA4, 0x00,
+    0xDF, 0xFF, 0xB5, 0x22, 0x5A, 0xEF, 0xFA, 0x10, 0xAF, 0xFF, 0xFE, 0xDD, 0xEF, 0xFF, 0xFA, 0x10,
+    0x4A, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xA4, 0x00, 0x01, 0x22, 0x22, 0x22, 0x22, 0x22, 0x10, 0x00,
+    // 3 (0x33)
+    0x00, 0x01, 0x22, 0x22, 0x22, 0x10, 0x00, 0x00, 0x01, 0x5A, 0xDD, 0xDD, 0xDD, 0xA5, 0x10, 0x00,
+    0x4A, 0xEF, 0xFE, 0xDD, 0xEF, 0xFE, 0x91, 0x00, 0xAF, 0xFE, 0xA5, 0x22, 0x5B, 0xFF, 0xE5, 0x00,
+    0x9D, 0xA5, 0x10, 0x00, 0x05, 0xEF, 0xFA, 0x10, 0x12, 0x10, 0x00, 0x00, 0x02, 0xDF, 0xFD, 0x20,
+    0x00, 0x00, 0x00, 0x00, 0x02, 0xDF, 0xFD, 0x20, 0x00, 0x00, 0x00, 0x00, 0x05, 0xEF, 0xFA, 0x10,
+    0x00, 0x00, 0x12, 0x22, 0x5B, 0xFF, 0xB4, 0x00, 0x00, 0x01, 0x9D, 0xDD, 0xEF, 0xFE, 0x50, 0x00,
+    0x00, 0x01, 0x9D, 0xDD, 0xEF, 0xFE, 0x50, 0x00, 0x00, 0x00, 0x12, 0x22, 0x5B, 0xFF, 0xB4, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x05, 0xEF, 0xFA, 0x10, 0x00, 0x00, 0x00, 0x00, 0x02, 0xDF, 0xFD, 0x20,
+    0x00, 0x00, 0x00, 0x00, 0x02, 0xDF, 0xFD, 0x20, 0x00, 0x00, 0x00, 0x00, 0x02, 0xDF, 0xFD, 0x20,
+    0x12, 0x10, 0x00, 0x00, 0x02, 0xDF, 0xFD, 0x20, 0x9D, 0xA5, 0x10, 0x00, 0x05, 0xEF, 0xFA, 0x10,
+    0xAF, 0xFE, 0xA5, 0x22, 0x5B, 0xFF, 0xE5, 0x00, 0x4A, 0xEF, 0xFE, 0xDD, 0xEF, 0xFE, 0x91, 0x00,
+    0x01, 0x5A, 0xDD, 0xDD, 0xDD, 0xA5, 0x10, 0x00, 0x00, 0x01, 0x22, 0x22, 0x22, 0x10, 0x00, 0x00,
+    // 4 (0x34)
+    0x00, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x5A, 0xA4, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x19, 0xEF, 0xFA, 0x10, 0x00, 0x00, 0x00, 0x01, 0x6E, 0xFF, 0xFD, 0x20, 0x00,
+    0x00, 0x00, 0x19, 0xEF, 0xFF, 0xFD, 0x20, 0x00, 0x00, 0x01, 0x6E, 0xFF, 0xFF, 0xFD, 0x20, 0x00,
+    0x00, 0x19, 0xEF, 0xEE, 0xFF, 0xFD, 0x20, 0x00, 0x01, 0x6E, 0xFB, 0x56, 0xEF, 0xFD, 0x20, 0x00,
+    0x19, 0xEF, 0xB4, 0x02, 0xDF, 0xFD, 0x20, 0x00, 0x5E, 0xFE, 0x50, 0x05, 0xEF, 0xFE, 0x50, 0x00,
+    0xAF, 0xFE, 0x62, 0x5B, 0xFF, 0xFF, 0xB4, 0x00, 0xAF, 0xFF, 0xED, 0xEF, 0xFF, 0xFF, 0xFA, 0x10,
+    0x4A, 0xDD, 0xDD, 0xEF, 0xFF, 0xFF, 0xFA, 0x10, 0x01, 0x22, 0x22, 0x5B, 0xFF, 0xFF, 0xB4, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0xEF, 0xFE, 0x50, 0x00, 0x00, 0x00, 0x00, 0x02, 0xDF, 0xFD, 0x20, 0x00,
+    0x00, 0x00, 0x00, 0x02, 0xDF, 0xFD, 0x20, 0x00, 0x00, 0x00, 0x00, 0x05, 0xEF, 0xFE, 0x50, 0x00,
+    0x00, 0x00, 0x00, 0x4B, 0xFF, 0xFF, 0xB4, 0x00, 0x00, 0x00, 0x01, 0xAF, 0xFF, 0xFF, 0xFA, 0x10,
+    0x00, 0x00, 0x01, 0x9D, 0xDD, 0xDD, 0xD9, 0x10, 0x00, 0x00, 0x00, 0x12, 0x22, 0x22, 0x21, 0x00,
+    // 5 (0x35)
+    0x01, 0x22, 0x22, 0x22, 0x22, 0x22, 0x21, 0x00, 0x4A, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xD9, 0x10,
+    0xAF, 0xFF, 0xFE, 0xDD, 0xDD, 0xDD, 0xD9, 0x10, 0xDF, 0xFF, 0xB5, 0x22, 0x22, 0x22, 0x21, 0x00,
+    0xDF, 0xFE, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDF, 0xFD, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xDF, 0xFD, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDF, 0xFE, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xDF, 0xFF, 0xB5, 0x22, 0x22, 0x10, 0x00, 0x00, 0xAF, 0xFF, 0xFE, 0xDD, 0xDD, 0xA5, 0x10, 0x00,
+    0x4A, 0xDD, 0xDD, 0xDD, 0xEF, 0xFE, 0x91, 0x00, 0x01, 0x22, 0x22, 0x22, 0x5B, 0xFF, 0xE5, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x05, 0xEF, 0xFA, 0x10, 0x00, 0x00, 0x00, 0x00, 0x02, 0xDF, 0xFD, 0x20,
+    0x00, 0x00, 0x00, 0x00, 0x02, 0xDF, 0xFD, 0x20, 0x00, 0x00, 0x00, 0x00, 0x02, 0xDF, 0xFD, 0x20,
+    0x12, 0x10, 0x00, 0x00, 0x02, 0xDF, 0xFD, 0x20, 0x9D, 0xA5, 0x10, 0x00, 0x05, 0xEF, 0xFA, 0x10,
+    0xAF, 0xFE, 0xA5, 0x22, 0x5B, 0xFF, 0xE5, 0x00, 0x4A, 0xEF, 0xFE, 0xDD, 0xEF, 0xFE, 0x91, 0x00,
+    0x01, 0x5A, 0xDD, 0xDD, 0xDD, 0xA5, 0x10, 0x00, 0x00, 0x01, 0x22, 0x22, 0x22, 0x10, 0x00, 0x00,
+    // 6 (0x36)
+    0x00, 0x00, 0x01, 0x22, 0x21, 0x00, 0x00, 0x00, 0x00, 0x01, 0x5A, 0xDD, 0xD9, 0x10, 0x00, 0x00,
+    0x00, 0x19, 0xEF, 0xFE, 0xD9, 0x10, 0x00, 0x00, 0x01, 0x6E, 0xFE, 0xA5, 0x21, 0x00, 0x00, 0x00,
+    0x19, 0xEF, 0xE6, 0x10, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xA1, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xAF, 0xFE, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDF, 0xFE, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xDF, 0xFF, 0xB5, 0x22, 0x22, 0x10, 0x00, 0x00, 0xDF, 0xFF, 0xFE, 0xDD, 0xDD, 0xA5, 0x10, 0x00,
+    0xDF, 0xFF, 0xFE, 0xDD, 0xEF, 0xFE, 0x91, 0x00, 0xDF, 0xFF, 0xB5, 0x22, 0x5B, 0xFF, 0xE5, 0x00,
+    0xDF, 0xFE, 0x50, 0x00, 0x05, 0xEF, 0xFA, 0x10, 0xDF, 0xFD, 0x20, 0x00, 0x02, 0xDF, 0xFD, 0x20,
+    0xDF, 0xFD, 0x20, 0x00, 0x02, 0xDF, 0xFD, 0x20, 0xDF, 0xFD, 0x20, 0x00, 0x02, 0xDF, 0xFD, 0x20,
+    0xDF, 0xFD, 0x20, 0x00, 0x02, 0xDF, 0xFD, 0x20, 0xAF, 0xFE, 0x50, 0x00, 0x05, 0xEF, 0xFA, 0x10,
+    0x5E, 0xFF, 0xB5, 0x22, 0x5B, 0xFF, 0xE5, 0x00, 0x19, 0xEF, 0xFE, 0xDD, 0xEF, 0xFE, 0x91, 0x00,
+    0x01, 0x5A, 0xDD, 0xDD, 0xDD, 0xA5, 0x10, 0x00, 0x00, 0x01, 0x22, 0x22, 0x22, 0x10, 0x00, 0x00,
+    // 7 (0x37)
+    0x01, 0x22, 0x22, 0x22, 0x22, 0x22, 0x10, 0x00, 0x4A, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xA4, 0x00,
+    0xAF, 0xFF, 0xFE, 0xDD, 0xEF, 0xFF, 0xFA, 0x10, 0xAF, 0xFE, 0xA5, 0x22, 0x5B, 0xFF, 0xFD, 0x20,
+    0x4A, 0xA5, 0x10, 0x00, 0x05, 0xEF, 0xFD, 0x20, 0x01, 0x10, 0x00, 0x00, 0x02, 0xDF, 0xFD, 0x20,
+    0x00, 0x00, 0x00, 0x00, 0x02, 0xDF, 0xFD, 0x20, 0x00, 0x00, 0x00, 0x00, 0x05, 0xEF, 0xFA, 0x10,
+    0x00, 0x00, 0x00, 0x00, 0x1A, 0xFF, 0xE5, 0x00, 0x00, 0x00, 0x00, 0x01, 0x6E, 0xFE, 0x91, 0x00,
+    0x00, 0x00, 0x00, 0x19, 0xEF, 0xE6, 0x10, 0x00, 0x00, 0x00, 0x01, 0x6E, 0xFE, 0x91, 0x00, 0x00,
+    0x00, 0x00, 0x19, 0xEF, 0xE6, 0x10, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xA1, 0x00, 0x00, 0x00,
+    0x00, 0x01, 0xAF, 0xFE, 0x50, 0x00, 0x00, 0x00, 0x00, 0x02, 0xDF, 0xFD, 0x20, 0x00, 0x00, 0x00,
+    0x00, 0x02, 0xDF, 0xFD, 0x20, 0x00, 0x00, 0x00, 0x00, 0x02, 0xDF, 0xFD, 0x20, 0x00, 0x00, 0x00,
+    0x00, 0x02, 0xDF, 0xFD, 0x20, 0x00, 0x00, 0x00, 0x00, 0x01, 0xAF, 0xFA, 0x10, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x4A, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x00, 0x00, 0x00,
+    // 8 (0x38)
+    0x00, 0x01, 0x22, 0x22, 0x22, 0x10, 0x00, 0x00, 0x01, 0x5A, 0xDD, 0xDD, 0xDD, 0xA5, 0x10, 0x00,
+    0x19, 0xEF, 0xFE, 0xDD, 0xEF, 0xFE, 0x91, 0x00, 0x5E, 0xFF, 0xB5, 0x22, 0x5B, 0xFF, 0xE5, 0x00,
+    0xAF, 0xFE, 0x50, 0x00, 0x05, 0xEF, 0xFA, 0x10, 0xDF, 0xFD, 0x20, 0x00, 0x02, 0xDF, 0xFD, 0x20,
+    0xDF, 0xFD, 0x20, 0x00, 0x02, 0xDF, 0xFD, 0x20, 0xAF, 0xFE, 0x50, 0x00, 0x05, 0xEF, 0xFA, 0x10,
+    0x4B, 0xFF, 0xB5, 0x22, 0x5B, 0xFF, 0xB4, 0x00, 0x05, 0xEF, 0xFE, 0xDD, 0xEF, 0xFE, 0x50, 0x00,
+    0x05, 0xEF, 0xFE, 0xDD, 0xEF, 0xFE, 0x50, 0x00, 0x4B, 0xFF, 0xB5, 0x22, 0x5B, 0xFF, 0xB4, 0x00,
+    0xAF, 0xFE, 0x50, 0x00, 0x05, 0xEF, 0xFA, 0x10, 0xDF, 0xFD, 0x20, 0x00, 0x02, 0xDF, 0xFD, 0x20,
+    0xDF, 0xFD, 0x20, 0x00, 0x02, 0xDF, 0xFD, 0x20, 0xDF, 0xFD, 0x20, 0x00, 0x02, 0xDF, 0xFD, 0x20,
+    0xDF, 0xFD, 0x20, 0x00, 0x02, 0xDF, 0xFD, 0x20, 0xAF, 0xFE, 0x50, 0x00, 0x05, 0xEF, 0xFA, 0x10,
+    0x5E, 0xFF, 0xB5, 0x22, 0x5B, 0xFF, 0xE5, 0x00, 0x19, 0xEF, 0xFE, 0xDD, 0xEF, 0xFE, 0x91, 0x00,
+    0x01, 0x5A, 0xDD, 0xDD, 0xDD, 0xA5, 0x10, 0x00, 0x00, 0x01, 0x22, 0x22, 0x22, 0x10, 0x00, 0x00,
+    // 9 (0x39)
+    0x00, 0x01, 0x22, 0x22, 0x22, 0x10, 0x00, 0x00, 0x01, 0x5A, 0xDD, 0xDD, 0xDD, 0xA5, 0x10, 0x00,
+    0x19, 0xEF, 0xFE, 0xDD, 0xEF, 0xFE, 0x91, 0x00, 0x5E, 0xFF, 0xB5, 0x22, 0x5B, 0xFF, 0xE5, 0x00,
+    0xAF, 0xFE, 0x50, 0x00, 0x05, 0xEF, 0xFA, 0x10, 0xDF, 0xFD, 0x20, 0x00, 0x02, 0xDF, 0xFD, 0x20,
+    0xDF, 0xFD, 0x20, 0x00, 0x02, 0xDF, 0xFD, 0x20, 0xAF, 0xFE, 0x50, 0x00, 0x05, 0xEF, 0xFD, 0x20,
+    0x5E, 0xFF, 0xB5, 0x22, 0x5B, 0xFF, 0xFD, 0x20, 0x19, 0xEF, 0xFE, 0xDD, 0xEF, 0xFF, 0xFD, 0x20,
+    0x01, 0x5A, 0xDD, 0xDD, 0xEF, 0xFF, 0xFD, 0x20, 0x00, 0x01, 0x22, 0x22, 0x5B, 0xFF, 0xFD, 0x20,
+    0x00, 0x00, 0x00, 0x00, 0x05, 0xEF, 0xFD, 0x20, 0x00, 0x00, 0x00, 0x00, 0x02, 0xDF, 0xFD, 0x20,
+    0x00, 0x00, 0x00, 0x00, 0x02, 0xDF, 0xFD, 0x20, 0x00, 0x00, 0x00, 0x00, 0x05, 0xEF, 0xFA, 0x10,
+    0x00, 0x00, 0x00, 0x00, 0x1A, 0xFF, 0xE5, 0x00, 0x00, 0x00, 0x00, 0x01, 0x6E, 0xFE, 0x91, 0x00,
+    0x00, 0x12, 0x22, 0x5A, 0xEF, 0xE6, 0x10, 0x00, 0x01, 0x9D, 0xDD, 0xEF, 0xFE, 0x91, 0x00, 0x00,
+    0x01, 0x9D, 0xDD, 0xDD, 0xA5, 0x10, 0x00, 0x00, 0x00, 0x12, 0x22, 0x22, 0x10, 0x00, 0x00, 0x00,
+    // : (0x3A)
+    0x00, 0x11, 0x00, 0x04, 0xAA, 0x40, 0x1A, 0xFF, 0xA1, 0x1A, 0xFF, 0xA1, 0x04, 0xAA, 0x40, 0x00,
+    0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11,
+    0x00, 0x04, 0xAA, 0x40, 0x1A, 0xFF, 0xA1, 0x1A, 0xFF, 0xA1, 0x04, 0xAA, 0x40, 0x00, 0x11, 0x00,
+    // ; (0x3B)
+    0x00, 0x00, 0x11, 0x00, 0x00, 0x04, 0xAA, 0x40, 0x00, 0x1A, 0xFF, 0xA1, 0x00, 0x1A, 0xFF, 0xA1,
+    0x00, 0x04, 0xAA, 0x40, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x04, 0xAA, 0x40,
+    0x00, 0x1A, 0xFF, 0xA1, 0x00, 0x5E, 0xFF, 0xA1, 0x04, 0xBF, 0xFE, 0x50, 0x1A, 0xFF, 0xE9, 0x10,
+    0x19, 0xDA, 0x51, 0x00, 0x01, 0x21, 0x00, 0x00,
+    // < (0x3C)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x10, 0x00, 0x00, 0x00, 0x00, 0x15, 0xAD, 0x91, 0x00, 0x00,
+    0x00, 0x01, 0x9E, 0xFF, 0xA1, 0x00, 0x00, 0x00, 0x16, 0xEF, 0xEA, 0x40, 0x00, 0x00, 0x01, 0x9E,
+    0xFE, 0x61, 0x00, 0x00, 0x00, 0x16, 0xEF, 0xE9, 0x10, 0x00, 0x00, 0x01, 0x9E, 0xFE, 0x61, 0x00,
+    0x00, 0x00, 0x16, 0xEF, 0xE9, 0x10, 0x00, 0x00, 0x04, 0xAE, 0xFB, 0x51, 0x00, 0x00, 0x00, 0x1A,
+    0xFF, 0xE5, 0x00, 0x00, 0x00, 0x00, 0x1A, 0xFF, 0xE5, 0x00, 0x00, 0x00, 0x00, 0x04, 0xAE, 0xFB,
+    0x51, 0x00, 0x00, 0x00, 0x00, 0x16, 0xEF, 0xE9, 0x10, 0x00, 0x00, 0x00, 0x01, 0x9E, 0xFE, 0x61,
+    0x00, 0x00, 0x00, 0x00, 0x16, 0xEF, 0xE9, 0x10, 0x00, 0x00, 0x00, 0x01, 0x9E, 0xFE, 0x61, 0x00,
+    0x00, 0x00, 0x00, 0x16, 0xEF, 0xEA, 0x40, 0x00, 0x00, 0x00, 0x01, 0x9E, 0xFF, 0xA1, 0x00, 0x00,
+    0x00, 0x00, 0x15, 0xAD, 0x91, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x10,
+    // = (0x3D)
+    0x01, 0x22, 0x22, 0x22, 0x22, 0x22, 0x10, 0x19, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0x91, 0x19, 0xDD,
+    0xDD, 0xDD, 0xDD, 0xDD, 0x91, 0x01, 0x22, 0x22, 0x22, 0x22, 0x22, 0x10, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x22, 0x22, 0x22, 0x22, 0x22,
+    0x10, 0x19, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0x91, 0x19, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0x91, 0x01,
+    0x22, 0x22, 0x22, 0x22, 0x22, 0x10,
+    // > (0x3E)
+    0x01, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0xDA, 0x51, 0x00, 0x00, 0x00, 0x00, 0x1A, 0xFF,
+    0xE9, 0x10, 0x00, 0x00, 0x00, 0x04, 0xAE, 0xFE, 0x61, 0x00, 0x00, 0x00, 0x00, 0x16, 0xEF, 0xE9,
+    0x10, 0x00, 0x00, 0x00, 0x01, 0x9E, 0xFE, 0x61, 0x00, 0x00, 0x00, 0x00, 0x16, 0xEF, 0xE9, 0x10,
+    0x00, 0x00, 0x00, 0x01, 0x9E, 0xFE, 0x61, 0x00, 0x00, 0x00, 0x00, 0x15, 0xBF, 0xEA, 0x40, 0x00,
+    0x00, 0x00, 0x00, 0x5E, 0xFF, 0xA1, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xA1, 0x00, 0x00, 0x00,
+    0x15, 0xBF, 0xEA, 0x40, 0x00, 0x00, 0x01, 0x9E, 0xFE, 0x61, 0x00, 0x00, 0x00, 0x16, 0xEF, 0xE9,
+    0x10, 0x00, 0x00, 0x01, 0x9E, 0xFE, 0x61, 0x00, 0x00, 0x00, 0x16, 0xEF, 0xE9, 0x10, 0x00, 0x00,
+    0x04, 0xAE, 0xFE, 0x61, 0x00, 0x00, 0x00, 0x1A, 0xFF, 0xE9, 0x10, 0x00, 0x00, 0x00, 0x19, 0xDA,
+    0x51, 0x00, 0x00, 0x00, 0x00, 0x01, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // ? (0x3F)
+    0x00, 0x01, 0x22, 0x22, 0x22, 0x10, 0x00, 0x00, 0x01, 0x5A, 0xDD, 0xDD, 0xDD, 0xA5, 0x10, 0x00,
+    0x19, 0xEF, 0xFE, 0xDD, 0xEF, 0xFE, 0x91, 0x00, 0x5E, 0xFF, 0xB5, 0x22, 0x5B, 0xFF, 0xE5, 0x00,
+    0xAF, 0xFE, 0x50, 0x00, 0x05, 0xEF, 0xFA, 0x10, 0xAF, 0xFA, 0x10, 0x00, 0x05, 0xEF, 0xFA, 0x10,
+    0x4A, 0xA4, 0x00, 0x00, 0x1A, 0xFF, 0xE5, 0x00, 0x01, 0x10, 0x00, 0x01, 0x6E, 0xFE, 0x91, 0x00,
+    0x00, 0x00, 0x00, 0x19, 0xEF, 0xE6, 0x10, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xA1, 0x00, 0x00,
+    0x00, 0x00, 0x01, 0xAF, 0xFE, 0x50, 0x00, 0x00, 0x00, 0x00, 0x02, 0xDF, 0xFD, 0x20, 0x00, 0x00,
+    0x00, 0x00, 0x02, 0xDF, 0xFD, 0x20, 0x00, 0x00, 0x00, 0x00, 0x01, 0xAF, 0xFA, 0x10, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x4A, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4A, 0xA4, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x01, 0xAF, 0xFA, 0x10, 0x00, 0x00, 0x00, 0x00, 0x01, 0xAF, 0xFA, 0x10, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x4A, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x00, 0x00,
+    // @ (0x40)
+    0x00, 0x01, 0x22, 0x22, 0x22, 0x10, 0x00, 0x00, 0x01, 0x5A, 0xDD, 0xDD, 0xDD, 0xA5, 0x10, 0x00,
+    0x19, 0xEF, 0xFE, 0xDD, 0xEF, 0xFE, 0x91, 0x00, 0x5E, 0xFF, 0xB5, 0x22, 0x5B, 0xFF, 0xE5, 0x00,
+    0xAF, 0xFE, 0x50, 0x00, 0x05, 0xEF, 0xFA, 0x10, 0xDF, 0xFD, 0x20, 0x00, 0x05, 0xEF, 0xFD, 0x20,
+    0xDF, 0xFD, 0x20, 0x01, 0x5B, 0xFF, 0xFD, 0x20, 0xDF, 0xFD, 0x20, 0x4A, 0xEF, 0xFF, 0xFD, 0x20,
+    0xDF, 0xFD, 0x21, 0xAF, 0xFF, 0xFF, 0xFD, 0x20, 0xDF, 0xFD, 0x22, 0xDF, 0xFF, 0xFF, 0xFD, 0x20,
+    0xDF, 0xFD, 0x22, 0xDF, 0xFF, 0xFF, 0xFD, 0x20, 0xDF, 0xFD, 0x22, 0xDF, 0xFF, 0xFF, 0xFA, 0x10,
+    0xDF, 0xFD, 0x22, 0xDF, 0xFF, 0xFF, 0xE5, 0x00, 0xDF, 0xFD, 0x21, 0xAF, 0xFF, 0xFE, 0x91, 0x00,
+    0xDF, 0xFD, 0x20, 0x4A, 0xDD, 0xA5, 0x10, 0x00, 0xDF, 0xFD, 0x20, 0x01, 0x22, 0x10, 0x00, 0x00,
+    0xDF, 0xFD, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xFE, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x5E, 0xFF, 0xB5, 0x22, 0x22, 0x21, 0x00, 0x00, 0x19, 0xEF, 0xFE, 0xDD, 0xDD, 0xD9, 0x10, 0x00,
+    0x01, 0x5A, 0xDD, 0xDD, 0xDD, 0xD9, 0x10, 0x00, 0x00, 0x01, 0x22, 0x22, 0x22, 0x21, 0x00, 0x00,
+    // A (0x41)
+    0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xAA, 0x40, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x1A, 0xFF, 0xA1, 0x00, 0x00, 0x00, 0x00, 0x01, 0x6E, 0xFF, 0xE6, 0x10, 0x00, 0x00,
+    0x00, 0x19, 0xEF, 0xEE, 0xFE, 0x91, 0x00, 0x00, 0x01, 0x6E, 0xFB, 0x55, 0xBF, 0xE6, 0x10, 0x00,
+    0x19, 0xEF, 0xE5, 0x00, 0x5E, 0xFE, 0x91, 0x00, 0x5E, 0xFF, 0xA1, 0x00, 0x1A, 0xFF, 0xE5, 0x00,
+    0xAF, 0xFE, 0x50, 0x00, 0x05, 0xEF, 0xFA, 0x10, 0xDF, 0xFE, 0x50, 0x00, 0x05, 0xEF, 0xFD, 0x20,
+    0xDF, 0xFF, 0xB5, 0x22, 0x5B, 0xFF, 0xFD, 0x20, 0xDF, 0xFF, 0xFE, 0xDD, 0xEF, 0xFF, 0xFD, 0x20,
+    0xDF, 0xFF, 0xFE, 0xDD, 0xEF, 0xFF, 0xFD, 0x20, 0xDF, 0xFF, 0xB5, 0x22, 0x5B, 0xFF, 0xFD, 0x20,
+    0xDF, 0xFE, 0x50, 0x00, 0x05, 0xEF, 0xFD, 0x20, 0xDF, 0xFD, 0x20, 0x00, 0x02, 0xDF, 0xFD, 0x20,
+    0xDF, 0xFD, 0x20, 0x00, 0x02, 0xDF, 0xFD, 0x20, 0xDF, 0xFD, 0x20, 0x00, 0x02, 0xDF, 0xFD, 0x20,
+    0xDF, 0xFD, 0x20, 0x00, 0x02, 0xDF, 0xFD, 0x20, 0xAF, 0xFA, 0x10, 0x00, 0x01, 0xAF, 0xFA, 0x10,
+    0x4A, 0xA4, 0x00, 0x00, 0x00, 0x4A, 0xA4, 0x00, 0x01, 0x10, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00,
+    // B (0x42)
+    0x12, 0x22, 0x22, 0x22, 0x22, 0x10, 0x00, 0x00, 0x9D, 0xDD, 0xDD, 0xDD, 0xDD, 0xA5, 0x10, 0x00,
+    0xAF, 0xFF, 0xFF, 0xFE, 0xEF, 0xFE, 0x91, 0x00, 0x4B, 0xFF, 0xFF, 0xB5, 0x5B, 0xFF, 0xE5, 0x00,
+    0x05, 0xEF, 0xFE, 0x50, 0x05, 0xEF, 0xFA, 0x10, 0x02, 0xDF, 0xFD, 0x20, 0x02, 0xDF, 0xFD, 0x20,
+    0x02, 0xDF, 0xFD, 0x20, 0x02, 0xDF, 0xFD, 0x20, 0x02, 0xDF, 0xFE, 0x50, 0x05, 0xEF, 0xFA, 0x10,
+    0x02, 0xDF, 0xFF, 0xB5, 0x5B, 0xFF, 0xB4, 0x00, 0x02, 0xDF, 0xFF, 0xFE, 0xEF, 0xFE, 0x50, 0x00,
+    0x02, 0xDF, 0xFF, 0xFE, 0xEF, 0xFE, 0x50, 0x00, 0x02, 0xDF, 0xFF, 0xB5, 0x5B, 0xFF, 0xB4, 0x00,
+    0x02, 0xDF, 0xFE, 0x50, 0x05, 0xEF, 0xFA, 0x10, 0x02, 0xDF, 0xFD, 0x20, 0x02, 0xDF, 0xFD, 0x20,
+    0x02, 0xDF, 0xFD, 0x20, 0x02, 0xDF, 0xFD, 0x20, 0x02, 0xDF, 0xFD, 0x20, 0x02, 0xDF, 0xFD, 0x20,
+    0x02, 0xDF, 0xFD, 0x20, 0x02, 0xDF, 0xFD, 0x20, 0x05, 0xEF, 0xFE, 0x50, 0x05, 0xEF, 0xFA, 0x10,
+    0x4B, 0xFF, 0xFF, 0xB5, 0x5B, 0xFF, 0xE5, 0x00, 0xAF, 0xFF, 0xFF, 0xFE, 0xEF, 0xFE, 0x91, 0x00,
+    0x9D, 0xDD, 0xDD, 0xDD, 0xDD, 0xA5, 0x10, 0x00, 0x12, 0x22, 0x22, 0x22, 0x22, 0x10, 0x00, 0x00,
+    // C (0x43)
+    0x00, 0x00, 0x01, 0x22, 0x22, 0x10, 0x00, 0x00, 0x00, 0x01, 0x5A, 0xDD, 0xDD, 0xA5, 0x10, 0x00,
+    0x00, 0x19, 0xEF, 0xFE, 0xEF, 0xFE, 0x91, 0x00, 0x01, 0x6E, 0xFE, 0xA5, 0x5A, 0xEF, 0xE5, 0x00,
+    0x19, 0xEF, 0xE6, 0x10, 0x01, 0x6E, 0xFA, 0x10, 0x5E, 0xFF, 0xA1, 0x00, 0x00, 0x1A, 0xFD, 0x20,
+    0xAF, 0xFE, 0x50, 0x00, 0x00, 0x04, 0xA9, 0x10, 0xDF, 0xFD, 0x20, 0x00, 0x00, 0x00, 0x11, 0x00,
+    0xDF, 0xFD, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDF, 0xFD, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xDF, 0xFD, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDF, 0xFD, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xDF, 0xFD, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDF, 0xFD, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xDF, 0xFD, 0x20, 0x00, 0x00, 0x00, 0x11, 0x00, 0xAF, 0xFE, 0x50, 0x00, 0x00, 0x04, 0xA9, 0x10,
+    0x5E, 0xFF, 0xA1, 0x00, 0x00, 0x1A, 0xFD, 0x20, 0x19, 0xEF, 0xE6, 0x10, 0x01, 0x6E, 0xFA, 0x10,
+    0x01, 0x6E, 0xFE, 0xA5, 0x5A, 0xEF, 0xE5, 0x00, 0x00, 0x19, 0xEF, 0xFE, 0xEF, 0xFE, 0x91, 0x00,
+    0x00, 0x01, 0x5A, 0xDD, 0xDD, 0xA5, 0x10, 0x00, 0x00, 0x00, 0x01, 0x22, 0x22, 0x10, 0x00, 0x00,
+    // D (0x44)
+    0x12, 0x22, 0x22, 0x22, 0x10, 0x00, 0x00, 0x00, 0x9D, 0xDD, 0xDD, 0xDD, 0xA5, 0x10, 0x00, 0x00,
+    0xAF, 0xFF, 0xFF, 0xEE, 0xFE, 0x91, 0x00, 0x00, 0x4B, 0xFF, 0xFE, 0x65, 0xBF, 0xE6, 0x10, 0x00,
+    0x05, 0xEF, 0xFD, 0x20, 0x5E, 0xFE, 0x91, 0x00, 0x02, 0xDF, 0xFD, 0x20, 0x1A, 0xFF, 0xE5, 0x00,
+    0x02, 0xDF, 0xFD, 0x20, 0x05, 0xEF, 0xFA, 0x10, 0x02, 0xDF, 0xFD, 0x20, 0x02, 0xDF, 0xFD, 0x20,
+    0x02, 0xDF, 0xFD, 0x20, 0x02, 0xDF, 0xFD, 0x20, 0x02, 0xDF, 0xFD, 0x20, 0x02, 0xDF, 0xFD, 0x20,
+    0x02, 0xDF, 0xFD, 0x20, 0x02, 0xDF, 0xFD, 0x20, 0x02, 0xDF, 0xFD, 0x20, 0x02, 0xDF, 0xFD, 0x20,
+    0x02, 0xDF, 0xFD, 0x20, 0x02, 0xDF, 0xFD, 0x20, 0x02, 0xDF, 0xFD, 0x20, 0x02, 0xDF, 0xFD, 0x20,
+    0x02, 0xDF, 0xFD, 0x20, 0x02, 0xDF, 0xFD, 0x20, 0x02, 0xDF, 0xFD, 0x20, 0x05, 0xEF, 0xFA, 0x10,
+    0x02, 0xDF, 0xFD, 0x20, 0x1A, 0xFF, 0xE5, 0x00, 0x05, 0xEF, 0xFD, 0x20, 0x5E, 0xFE, 0x91, 0x00,
+    0x4B, 0xFF, 0xFE, 0x65, 0xBF, 0xE6, 0x10, 0x00, 0xAF, 0xFF, 0xFF, 0xEE, 0xFE, 0x91, 0x00, 0x00,
+    0x9D, 0xDD, 0xDD, 0xDD, 0xA5, 0x10, 0x00, 0x00, 0x12, 0x22, 0x22, 0x22, 0x10, 0x00, 0x00, 0x00,
+    // E (0x45)
+    0x12, 0x22, 0x22, 0x22, 0x22, 0x22, 0x10, 0x00, 0x9D, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xA4, 0x00,
+    0xAF, 0xFF, 0xFF, 0xFE, 0xEF, 0xFF, 0xFA, 0x10, 0x4B, 0xFF, 0xFF, 0xB5, 0x5A, 0xEF, 0xFD, 0x20,
+    0x05, 0xEF, 0xFE, 0x50, 0x01, 0x6E, 0xFD, 0x20, 0x02, 0xDF, 0xFD, 0x20, 0x00, 0x1A, 0xFD, 0x20,
+    0x02, 0xDF, 0xFD, 0x20, 0x11, 0x04, 0xA9, 0x10, 0x02, 0xDF, 0xFD, 0x21, 0x99, 0x10, 0x11, 0x00,
+    0x02, 0xDF, 0xFE, 0x66, 0xED, 0x20, 0x00, 0x00, 0x02, 0xDF, 0xFF, 0xEE, 0xFD, 0x20, 0x00, 0x00,
+    0x02, 0xDF, 0xFF, 0xEE, 0xFD, 0x20, 0x00, 0x00, 0x02, 0xDF, 0xFE, 0x66, 0xED, 0x20, 0x00, 0x00,
+    0x02, 0xDF, 0xFD, 0x21, 0x99, 0x10, 0x00, 0x00, 0x02, 0xDF, 0xFD, 0x20, 0x11, 0x00, 0x00, 0x00,
+    0x02, 0xDF, 0xFD, 0x20, 0x00, 0x00, 0x11, 0x00, 0x02, 0xDF, 0xFD, 0x20, 0x00, 0x04, 0xA9, 0x10,
+    0x02, 0xDF, 0xFD, 0x20, 0x00, 0x1A, 0xFD, 0x20, 0x05, 0xEF, 0xFE, 0x50, 0x01, 0x6E, 0xFD, 0x20,
+    0x4B, 0xFF, 0xFF, 0xB5, 0x5A, 0xEF, 0xFD, 0x20, 0xAF, 0xFF, 0xFF, 0xFE, 0xEF, 0xFF, 0xFA, 0x10,
+    0x9D, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xA4, 0x00, 0x12, 0x22, 0x22, 0x22, 0x22, 0x22, 0x10, 0x00,
+    // F (0x46)
+    0x12, 0x22, 0x22, 0x22, 0x22, 0x22, 0x10, 0x00, 0x9D, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xA4, 0x00,
+    0xAF, 0xFF, 0xFF, 0xFE, 0xEF, 0xFF, 0xFA, 0x10, 0x4B, 0xFF, 0xFF, 0xB5, 0x5A, 0xEF, 0xFD, 0x20,
+    0x05, 0xEF, 0xFE, 0x50, 0x01, 0x6E, 0xFD, 0x20, 0x02, 0xDF, 0xFD, 0x20, 0x00, 0x1A, 0xFD, 0x20,
+    0x02, 0xDF, 0xFD, 0x20, 0x11, 0x04, 0xA9, 0x10, 0x02, 0xDF, 0xFD, 0x21, 0x99, 0x10, 0x11, 0x00,
+    0x02, 0xDF, 0xFE, 0x66, 0xED, 0x20, 0x00, 0x00, 0x02, 0xDF, 0xFF, 0xEE, 0xFD, 0x20, 0x00, 0x00,
+    0x02, 0xDF, 0xFF, 0xEE, 0xFD, 0x20, 0x00, 0x00, 0x02, 0xDF, 0xFE, 0x66, 0xED, 0x20, 0x00, 0x00,
+    0x02, 0xDF, 0xFD, 0x21, 0x99, 0x10, 0x00, 0x00, 0x02, 0xDF, 0xFD, 0x20, 0x11, 0x00, 0x00, 0x00,
+    0x02, 0xDF, 0xFD, 0x20, 0x00, 0x00, 0x00, 0x00, 0x02, 0xDF, 0xFD, 0x20, 0x00, 0x00, 0x00, 0x00,
+    0x02, 0xDF, 0xFD, 0x20, 0x00, 0x00, 0x00, 0x00, 0x05, 0xEF, 0xFE, 0x50, 0x00, 0x00, 0x00, 0x00,
+    0x4B, 0xFF, 0xFF, 0xB4, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xFF, 0xFA, 0x10, 0x00, 0x00, 0x00,
+    0x9D, 0xDD, 0xDD, 0xD9, 0x10, 0x00, 0x00, 0x00, 0x12, 0x22, 0x22, 0x21, 0x00, 0x00, 0x00, 0x00,
+    // G (0x47)
+    0x00, 0x00, 0x01, 0x22, 0x22, 0x10, 0x00, 0x00, 0x00, 0x01, 0x5A, 0xDD, 0xDD, 0xA5, 0x10, 0x00,
+    0x00, 0x19, 0xEF, 0xFE, 0xEF, 0xFE, 0x91, 0x00, 0x01, 0x6E, 0xFE, 0xA5, 0x5A, 0xEF, 0xE5, 0x00,
+    0x19, 0xEF, 0xE6, 0x10, 0x01, 0x6E, 0xFA, 0x10, 0x5E, 0xFF, 0xA1, 0x00, 0x00, 0x1A, 0xFD, 0x20,
+    0xAF, 0xFE, 0x50, 0x00, 0x00, 0x04, 0xA9, 0x10, 0xDF, 0xFD, 0x20, 0x00, 0x00, 0x00, 0x11, 0x00,
+    0xDF, 0xFD, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDF, 0xFD, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xDF, 0xFD, 0x20, 0x12, 0x22, 0x22, 0x10, 0x00, 0xDF, 0xFD, 0x21, 0x9D, 0xDD, 0xDD, 0xA4, 0x00,
+    0xDF, 0xFD, 0x21, 0x9D, 0xEF, 0xFF, 0xFA, 0x10, 0xDF, 0xFD, 0x20, 0x12, 0x5B, 0xFF, 0xFD, 0x20,
+    0xDF, 0xFD, 0x20, 0x00, 0x05, 0xEF, 0xFD, 0x20, 0xAF, 0xFE, 0x50, 0x00, 0x02, 0xDF, 0xFD, 0x20,
+    0x5E, 0xFF, 0xA1, 0x00, 0x02, 0xDF, 0xFD, 0x20, 0x19, 0xEF, 0xE6, 0x10, 0x04, 0xBF, 0xFD, 0x20,
+    0x01, 0x6E, 0xFE, 0xA5, 0x5B, 0x4B, 0xFD, 0x20, 0x00, 0x19, 0xEF, 0xFE, 0xED, 0x25, 0xED, 0x20,
+    0x00, 0x01, 0x5A, 0xDD, 0xD9, 0x11, 0x99, 0x10, 0x00, 0x00, 0x01, 0x22, 0x21, 0x00, 0x11, 0x00,
+    // H (0x48)
+    0x01, 0x10, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x4A, 0xA4, 0x00, 0x00, 0x00, 0x4A, 0xA4, 0x00,
+    0xAF, 0xFA, 0x10, 0x00, 0x01, 0xAF, 0xFA, 0x10, 0xDF, 0xFD, 0x20, 0x00, 0x02, 0xDF, 0xFD, 0x20,
+    0xDF, 0xFD, 0x20, 0x00, 0x02, 0xDF, 0xFD, 0x20, 0xDF, 0xFD, 0x20, 0x00, 0x02, 0xDF, 0xFD, 0x20,
+    0xDF, 0xFD, 0x20, 0x00, 0x02, 0xDF, 0xFD, 0x20, 0xDF, 0xFE, 0x50, 0x00, 0x05, 0xEF, 0xFD, 0x20,
+    0xDF, 0xFF, 0xB5, 0x22, 0x5B, 0xFF, 0xFD, 0x20, 0xDF, 0xFF, 0xFE, 0xDD, 0xEF, 0xFF, 0xFD, 0x20,
+    0xDF, 0xFF, 0xFE, 0xDD, 0xEF, 0xFF, 0xFD, 0x20, 0xDF, 0xFF, 0xB5, 0x22, 0x5B, 0xFF, 0xFD, 0x20,
+    0xDF, 0xFE, 0x50, 0x00, 0x05, 0xEF, 0xFD, 0x20, 0xDF, 0xFD, 0x20, 0x00, 0x02, 0xDF, 0xFD, 0x20,
+    0xDF, 0xFD, 0x20, 0x00, 0x02, 0xDF, 0xFD, 0x20, 0xDF, 0xFD, 0x20, 0x00, 0x02, 0xDF, 0xFD, 0x20,
+    0xDF, 0xFD, 0x20, 0x00, 0x02, 0xDF, 0xFD, 0x20, 0xDF, 0xFD, 0x20, 0x00, 0x02, 0xDF, 0xFD, 0x20,
+    0xDF, 0xFD, 0x20, 0x00, 0x02, 0xDF, 0xFD, 0x20, 0xAF, 0xFA, 0x10, 0x00, 0x01, 0xAF, 0xFA, 0x10,
+    0x4A, 0xA4, 0x00, 0x00, 0x00, 0x4A, 0xA4, 0x00, 0x01, 0x10, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00,
+    // I (0x49)
+    0x01, 0x22, 0x22, 0x22, 0x10, 0x19, 0xDD, 0xDD, 0xDD, 0x91, 0x1A, 0xFF, 0xFF, 0xFF, 0xA1, 0x04,
+    0xBF, 0xFF, 0xFB, 0x40, 0x00, 0x5E, 0xFF, 0xE5, 0x00, 0x00, 0x2D, 0xFF, 0xD2, 0x00, 0x00, 0x2D,
+    0xFF, 0xD2, 0x00, 0x00, 0x2D, 0xFF, 0xD2, 0x00, 0x00, 0x2D, 0xFF, 0xD2, 0x00, 0x00, 0x2D, 0xFF,
+    0xD2, 0x00, 0x00, 0x2D, 0xFF, 0xD2, 0x00, 0x00, 0x2D, 0xFF, 0xD2, 0x00, 0x00, 0x2D, 0xFF, 0xD2,
+    0x00, 0x00, 0x2D, 0xFF, 0xD2, 0x00, 0x00, 0x2D, 0xFF, 0xD2, 0x00, 0x00, 0x2D, 0xFF, 0xD2, 0x00,
+    0x00, 0x2D, 0xFF, 0xD2, 0x00, 0x00, 0x5E, 0xFF, 0xE5, 0x00, 0x04, 0xBF, 0xFF, 0xFB, 0x40, 0x1A,
+    0xFF, 0xFF, 0xFF, 0xA1, 0x19, 0xDD, 0xDD, 0xDD, 0x91, 0x01, 0x22, 0x22, 0x22, 0x10,
+    // J (0x4A)
+    0x00, 0x00, 0x00, 0x12, 0x22, 0x22, 0x21, 0x00, 0x00, 0x00, 0x01, 0x9D, 0xDD, 0xDD, 0xD9, 0x10,
+    0x00, 0x00, 0x01, 0xAF, 0xFF, 0xFF, 0xFA, 0x10, 0x00, 0x00, 0x00, 0x4B, 0xFF, 0xFF, 0xB4, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0xEF, 0xFE, 0x50, 0x00, 0x00, 0x00, 0x00, 0x02, 0xDF, 0xFD, 0x20, 0x00,
+    0x00, 0x00, 0x00, 0x02, 0xDF, 0xFD, 0x20, 0x00, 0x00, 0x00, 0x00, 0x02, 0xDF, 0xFD, 0x20, 0x00,
+    0x00, 0x00, 0x00, 0x02, 0xDF, 0xFD, 0x20, 0x00, 0x00, 0x00, 0x00, 0x02, 0xDF, 0xFD, 0x20, 0x00,
+    0x00, 0x00, 0x00, 0x02, 0xDF, 0xFD, 0x20, 0x00, 0x00, 0x00, 0x00, 0x02, 0xDF, 0xFD, 0x20, 0x00,
+    0x01, 0x10, 0x00, 0x02, 0xDF, 0xFD, 0x20, 0x00, 0x4A, 0xA4, 0x00, 0x02, 0xDF, 0xFD, 0x20, 0x00,
+    0xAF, 0xFA, 0x10, 0x02, 0xDF, 0xFD, 0x20, 0x00, 0xDF, 0xFD, 0x20, 0x02, 0xDF, 0xFD, 0x20, 0x00,
+    0xDF, 0xFD, 0x20, 0x02, 0xDF, 0xFD, 0x20, 0x00, 0xAF, 0xFE, 0x50, 0x05, 0xEF, 0xFA, 0x10, 0x00,
+    0x5E, 0xFF, 0xB5, 0x5B, 0xFF, 0xE5, 0x00, 0x00, 0x19, 0xEF, 0xFE, 0xEF, 0xFE, 0x91, 0x00, 0x00,
+    0x01, 0x5A, 0xDD, 0xDD, 0xA5, 0x10, 0x00, 0x00, 0x00, 0x01, 0x22, 0x22, 0x10, 0x00, 0x00, 0x00,
+    // K (0x4B)
+    0x12, 0x22, 0x10, 0x00, 0x00, 0x01, 0x10, 0x00, 0x9D, 0xDD, 0xA4, 0x00, 0x00, 0x4A, 0xA4, 0x00,
+    0xAF, 0xFF, 0xFA, 0x10, 0x01, 0xAF, 0xFA, 0x10, 0x4B, 0xFF, 0xFD, 0x20, 0x05, 0xEF, 0xFA, 0x10,
+    0x05, 0xEF, 0xFD, 0x20, 0x1A, 0xFF, 0xE5, 0x00, 0x02, 0xDF, 0xFD, 0x20, 0x5E, 0xFE, 0x91, 0x00,
+    0x02, 0xDF, 0xFE, 0x65, 0xBF, 0xE6, 0x10, 0x00, 0x02, 0xDF, 0xFF, 0xEE, 0xFE, 0x91, 0x00, 0x00,
+    0x02, 0xDF, 0xFF, 0xFF, 0xB5, 0x10, 0x00, 0x00, 0x02, 0xDF, 0xFF, 0xFE, 0x50, 0x00, 0x00, 0x00,
+    0x02, 0xDF, 0xFF, 0xFE, 0x50, 0x00, 0x00, 0x00, 0x02, 0xDF, 0xFF, 0xFF, 0xB5, 0x10, 0x00, 0x00,
+    0x02, 0xDF, 0xFF, 0xEE, 0xFE, 0x91, 0x00, 0x00, 0x02, 0xDF, 0xFE, 0x65, 0xBF, 0xE6, 0x10, 0x00,
+    0x02, 0xDF, 0xFD, 0x20, 0x5E, 0xFE, 0x91, 0x00, 0x02, 0xDF, 0xFD, 0x20, 0x1A, 0xFF, 0xE5, 0x00,
+    0x02, 0xDF, 0xFD, 0x20, 0x05, 0xEF, 0xFA, 0x10, 0x05, 0xEF, 0xFD, 0x20, 0x02, 0xDF, 0xFD, 0x20,
+    0x4B, 0xFF, 0xFD, 0x20, 0x02, 0xDF, 0xFD, 0x20, 0xAF, 0xFF, 0xFA, 0x10, 0x01, 0xAF, 0xFA, 0x10,
+    0x9D, 0xDD, 0xA4, 0x00, 0x00, 0x4A, 0xA4, 0x00, 0x12, 0x22, 0x10, 0x00, 0x00, 0x01, 0x10, 0x00,
+    // L (0x4C)
+    0x12, 0x22, 0x22, 0x21, 0x00, 0x00, 0x00, 0x00, 0x9D, 0xDD, 0xDD, 0xD9, 0x10, 0x00, 0x00, 0x00,
+    0xAF, 0xFF, 0xFF, 0xFA, 0x10, 0x00, 0x00, 0x00, 0x4B, 0xFF, 0xFF, 0xB4, 0x00, 0x00, 0x00, 0x00,
+    0x05, 0xEF, 0xFE, 0x50, 0x00, 0x00, 0x00, 0x00, 0x02, 0xDF, 0xFD, 0x20, 0x00, 0x00, 0x00, 0x00,
+    0x02, 0xDF, 0xFD, 0x20, 0x00, 0x00, 0x00, 0x00, 0x02, 0xDF, 0xFD, 0x20, 0x00, 0x00, 0x00, 0x00,
+    0x02, 0xDF, 0xFD, 0x20, 0x00, 0x00, 0x00, 0x00, 0x02, 0xDF, 0xFD, 0x20, 0x00, 0x00, 0x00, 0x00,
+    0x02, 0xDF, 0xFD, 0x20, 0x00, 0x00, 0x00, 0x00, 0x02, 0xDF, 0xFD, 0x20, 0x00, 0x00, 0x00, 0x00,
+    0x02, 0xDF, 0xFD, 0x20, 0x00, 0x00, 0x00, 0x00, 0x02, 0xDF, 0xFD, 0x20, 0x00, 0x00, 0x00, 0x00,
+    0x02, 0xDF, 0xFD, 0x20, 0x00, 0x00, 0x11, 0x00, 0x02, 0xDF, 0xFD, 0x20, 0x00, 0x04, 0xA9, 0x10,
+    0x02, 0xDF, 0xFD, 0x20, 0x00, 0x1A, 0xFD, 0x20, 0x05, 0xEF, 0xFE, 0x50, 0x01, 0x6E, 0xFD, 0x20,
+    0x4B, 0xFF, 0xFF, 0xB5, 0x5A, 0xEF, 0xFD, 0x20, 0xAF, 0xFF, 0xFF, 0xFE, 0xEF, 0xFF, 0xFA, 0x10,
+    0x9D, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xA4, 0x00, 0x12, 0x22, 0x22, 0x22, 0x22, 0x22, 0x10, 0x00,
+    // M (0x4D)
+    0x01, 0x10, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x4A, 0xA5, 0x10, 0x00, 0x01, 0x5A, 0xA4, 0x00,
+    0xAF, 0xFE, 0x91, 0x00, 0x19, 0xEF, 0xFA, 0x10, 0xDF, 0xFF, 0xE5, 0x00, 0x5E, 0xFF, 0xFD, 0x20,
+    0xDF, 0xFF, 0xFB, 0x55, 0xBF, 0xFF, 0xFD, 0x20, 0xDF, 0xFF, 0xFF, 0xEE, 0xFF, 0xFF, 0xFD, 0x20,
+    0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x20, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x20,
+    0xDF, 0xFF, 0xEE, 0xFF, 0xEE, 0xFF, 0xFD, 0x20, 0xDF, 0xFE, 0x66, 0xEE, 0x66, 0xEF, 0xFD, 0x20,
+    0xDF, 0xFD, 0x21, 0x99, 0x12, 0xDF, 0xFD, 0x20, 0xDF, 0xFD, 0x20, 0x11, 0x02, 0xDF, 0xFD, 0x20,
+    0xDF, 0xFD, 0x20, 0x00, 0x02, 0xDF, 0xFD, 0x20, 0xDF, 0xFD, 0x20, 0x00, 0x02, 0xDF, 0xFD, 0x20,
+    0xDF, 0xFD, 0x20, 0x00, 0x02, 0xDF, 0xFD, 0x20, 0xDF, 0xFD, 0x20, 0x00, 0x02, 0xDF, 0xFD, 0x20,
+    0xDF, 0xFD, 0x20, 0x00, 0x02, 0xDF, 0xFD, 0x20, 0xDF, 0xFD, 0x20, 0x00, 0x02, 0xDF, 0xFD, 0x20,
+    0xDF, 0xFD, 0x20, 0x00, 0x02, 0xDF, 0xFD, 0x20, 0xAF, 0xFA, 0x10, 0x00, 0x01, 0xAF, 0xFA, 0x10,
+    0x4A, 0xA4, 0x00, 0x00, 0x00, 0x4A, 0xA4, 0x00, 0x01, 0x10, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00,
+    // N (0x4E)
+    0x01, 0x10, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x4A, 0xA5, 0x10, 0x00, 0x00, 0x4A, 0xA4, 0x00,
+    0xAF, 0xFE, 0x91, 0x00, 0x01, 0xAF, 0xFA, 0x10, 0xDF, 0xFF, 0xE6, 0x10, 0x02, 0xDF, 0xFD, 0x20,
+    0xDF, 0xFF, 0xFE, 0x91, 0x02, 0xDF, 0xFD, 0x20, 0xDF, 0xFF, 0xFF, 0xE5, 0x02, 0xDF, 0xFD, 0x20,
+    0xDF, 0xFF, 0xFF, 0xFB, 0x56, 0xEF, 0xFD, 0x20, 0xDF, 0xFF, 0xFF, 0xFF, 0xEE, 0xFF, 0xFD, 0x20,
+    0xDF, 0xFF, 0xEE, 0xFF, 0xFF, 0xFF, 0xFD, 0x20, 0xDF, 0xFE, 0x65, 0xBF, 0xFF, 0xFF, 0xFD, 0x20,
+    0xDF, 0xFD, 0x20, 0x5E, 0xFF, 0xFF, 0xFD, 0x20, 0xDF, 0xFD, 0x20, 0x19, 0xEF, 0xFF, 0xFD, 0x20,
+    0xDF, 0xFD, 0x20, 0x01, 0x6E, 0xFF, 0xFD, 0x20, 0xDF, 0xFD, 0x20, 0x00, 0x1A, 0xFF, 0xFD, 0x20,
+    0xDF, 0xFD, 0x20, 0x00, 0x05, 0xEF, 0xFD, 0x20, 0xDF, 0xFD, 0x20, 0x00, 0x02, 0xDF, 0xFD, 0x20,
+    0xDF, 0xFD, 0x20, 0x00, 0x02, 0xDF, 0xFD, 0x20, 0xDF, 0xFD, 0x20, 0x00, 0x02, 0xDF, 0xFD, 0x20,
+    0xDF, 0xFD, 0x20, 0x00, 0x02, 0xDF, 0xFD, 0x20, 0xAF, 0xFA, 0x10, 0x00, 0x01, 0xAF, 0xFA, 0x10,
+    0x4A, 0xA4, 0x00, 0x00, 0x00, 0x4A, 0xA4, 0x00, 0x01, 0x10, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00,
+    // O (0x4F)
+    0x00, 0x01, 0x22, 0x22, 0x22, 0x10, 0x00, 0x00, 0x01, 0x5A, 0xDD, 0xDD, 0xDD, 0xA5, 0x10, 0x00,
+    0x19, 0xEF, 0xFE, 0xDD, 0xEF, 0xFE, 0x91, 0x00, 0x5E, 0xFF, 0xB5, 0x22, 0x5B, 0xFF, 0xE5, 0x00,
+    0xAF, 0xFE, 0x50, 0x00, 0x05, 0xEF, 0xFA, 0x10, 0xDF, 0xFD, 0x20, 0x00, 0x02, 0xDF, 0xFD, 0x20,
+    0xDF, 0xFD, 0x20, 0x00, 0x02, 0xDF, 0xFD, 0x20, 0xDF, 0xFD, 0x20, 0x00, 0x02, 0xDF, 0xFD, 0x20,
+    0xDF, 0xFD, 0x20, 0x00, 0x02, 0xDF, 0xFD, 0x20, 0xDF, 0xFD, 0x20, 0x00, 0x02, 0xDF, 0xFD, 0x20,
+    0xDF, 0xFD, 0x20, 0x00, 0x02, 0xDF, 0xFD, 0x20, 0xDF, 0xFD, 0x20, 0x00, 0x02, 0xDF, 0xFD, 0x20,
+    0xDF, 0xFD, 0x20, 0x00, 0x02, 0xDF, 0xFD, 0x20, 0xDF, 0xFD, 0x20, 0x00, 0x02, 0xDF, 0xFD, 0x20,
+    0xDF, 0xFD, 0x20, 0x00, 0x02, 0xDF, 0xFD, 0x20, 0xDF, 0xFD, 0x20, 0x00, 0x02, 0xDF, 0xFD, 0x20,
+    0xDF, 0xFD, 0x20, 0x00, 0x02, 0xDF, 0xFD, 0x20, 0xAF, 0xFE, 0x50, 0x00, 0x05, 0xEF, 0xFA, 0x10,
+    0x5E, 0xFF, 0xB5, 0x22, 0x5B, 0xFF, 0xE5, 0x00, 0x19, 0xEF, 0xFE, 0xDD, 0xEF, 0xFE, 0x91, 0x00,
+    0x01, 0x5A, 0xDD, 0xDD, 0xDD, 0xA5, 0x10, 0x00, 0x00, 0x01, 0x22, 0x22, 0x22, 0x10, 0x00, 0x00,
+    // P (0x50)
+    0x12, 0x22, 0x22, 0x22, 0x22, 0x10, 0x00, 0x00, 0x9D, 0xDD, 0xDD, 0xDD, 0xDD, 0xA5, 0x10, 0x00,
+    0xAF, 0xFF, 0xFF, 0xFE, 0xEF, 0xFE, 0x91, 0x00, 0x4B, 0xFF, 0xFF, 0xB5, 0x5B, 0xFF, 0xE5, 0x00,
+    0x05, 0xEF, 0xFE, 0x50, 0x05, 0xEF, 0xFA, 0x10, 0x02, 0xDF, 0xFD, 0x20, 0x02, 0xDF, 0xFD, 0x20,
+    0x02, 0xDF, 0xFD, 0x20, 0x02, 0xDF, 0xFD, 0x20, 0x02, 0xDF, 0xFE, 0x50, 0x05, 0xEF, 0xFA, 0x10,
+    0x02, 0xDF, 0xFF, 0xB5, 0x5B, 0xFF, 0xE5, 0x00, 0x02, 0xDF, 0xFF, 0xFE, 0xEF, 0xFE, 0x91, 0x00,
+    0x02, 0xDF, 0xFF, 0xFE, 0xDD, 0xA5, 0x10, 0x00, 0x02, 0xDF, 0xFF, 0xB5, 0x22, 0x10, 0x00, 0x00,
+    0x02, 0xDF, 0xFE, 0x50, 0x00, 0x00, 0x00, 0x00, 0x02, 0xDF, 0xFD, 0x20, 0x00, 0x00, 0x00, 0x00,
+    0x02, 0xDF, 0xFD, 0x20, 0x00, 0x00, 0x00, 0x00, 0x02, 0xDF, 0xFD, 0x20, 0x00, 0x00, 0x00, 0x00,
+    0x02, 0xDF, 0xFD, 0x20, 0x00, 0x00, 0x00, 0x00, 0x05, 0xEF, 0xFE, 0x50, 0x00, 0x00, 0x00, 0x00,
+    0x4B, 0xFF, 0xFF, 0xB4, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xFF, 0xFA, 0x10, 0x00, 0x00, 0x00,
+    0x9D, 0xDD, 0xDD, 0xD9, 0x10, 0x00, 0x00, 0x00, 0x12, 0x22, 0x22, 0x21, 0x00, 0x00, 0x00, 0x00,
+    // Q (0x51)
+    0x00, 0x01, 0x22, 0x22, 0x22, 0x10, 0x00, 0x00, 0x01, 0x5A, 0xDD, 0xDD, 0xDD, 0xA5, 0x10, 0x00,
+    0x19, 0xEF, 0xFE, 0xDD, 0xEF, 0xFE, 0x91, 0x00, 0x5E, 0xFF, 0xB5, 0x22, 0x5B, 0xFF, 0xE5, 0x00,
+    0xAF, 0xFE, 0x50, 0x00, 0x05, 0xEF, 0xFA, 0x10, 0xDF, 0xFD, 0x20, 0x00, 0x02, 0xDF, 0xFD, 0x20,
+    0xDF, 0xFD, 0x20, 0x00, 0x02, 0xDF, 0xFD, 0x20, 0xDF, 0xFD, 0x20, 0x00, 0x02, 0xDF, 0xFD, 0x20,
+    0xDF, 0xFD, 0x20, 0x00, 0x02, 0xDF, 0xFD, 0x20, 0xDF, 0xFD, 0x20, 0x00, 0x02, 0xDF, 0xFD, 0x20,
+    0xDF, 0xFD, 0x20, 0x00, 0x02, 0xDF, 0xFD, 0x20, 0xDF, 0xFD, 0x20, 0x00, 0x02, 0xDF, 0xFD, 0x20,
+    0xDF, 0xFD, 0x20, 0x00, 0x02, 0xDF, 0xFD, 0x20, 0xDF, 0xFD, 0x20, 0x00, 0x02, 0xDF, 0xFD, 0x20,
+    0xDF, 0xFD, 0x20, 0x11, 0x02, 0xDF, 0xFD, 0x20, 0xDF, 0xFD, 0x21, 0x99, 0x12, 0xDF, 0xFD, 0x20,
+    0xDF, 0xFD, 0x22, 0xDE, 0x66, 0xEF, 0xFD, 0x20, 0xAF, 0xFD, 0x22, 0xDF, 0xEE, 0xFF, 0xFA, 0x10,
+    0x5E, 0xFE, 0x66, 0xEF, 0xFF, 0xFF, 0xE5, 0x00, 0x19, 0xEF, 0xEE, 0xFF, 0xFF, 0xFF, 0xA1, 0x00,
+    0x01, 0x5A, 0xDD, 0xEF, 0xFF, 0xFE, 0x50, 0x00, 0x00, 0x01, 0x22, 0x5B, 0xFF, 0xFE, 0x50, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0xEF, 0xFF, 0xB4, 0x00, 0x00, 0x00, 0x00, 0x01, 0xAF, 0xFF, 0xFA, 0x10,
+    0x00, 0x00, 0x00, 0x00, 0x4A, 0xDD, 0xD9, 0x10, 0x00, 0x00, 0x00, 0x00, 0x01, 0x22, 0x21, 0x00,
+    // R (0x52)
+    0x12, 0x22, 0x22, 0x22, 0x22, 0x10, 0x00, 0x00, 0x9D, 0xDD, 0xDD, 0xDD, 0xDD, 0xA5, 0x10, 0x00,
+    0xAF, 0xFF, 0xFF, 0xFE, 0xEF, 0xFE, 0x91, 0x00, 0x4B, 0xFF, 0xFF, 0xB5, 0x5B, 0xFF, 0xE5, 0x00,
+    0x05, 0xEF, 0xFE, 0x50, 0x05, 0xEF, 0xFA, 0x10, 0x02, 0xDF, 0xFD, 0x20, 0x02, 0xDF, 0xFD, 0x20,
+    0x02, 0xDF, 0xFD, 0x20, 0x02, 0xDF, 0xFD, 0x20, 0x02, 0xDF, 0xFE, 0x50, 0x05, 0xEF, 0xFA, 0x10,
+    0x02, 0xDF, 0xFF, 0xB5, 0x5B, 0xFF, 0xE5, 0x00, 0x02, 0xDF, 0xFF, 0xFE, 0xEF, 0xFF, 0xA1, 0x00,
+    0x02, 0xDF, 0xFF, 0xEE, 0xFF, 0xFE, 0x50, 0x00, 0x02, 0xDF, 0xFE, 0x65, 0xBF, 0xFE, 0x50, 0x00,
+    0x02, 0xDF, 0xFD, 0x20, 0x5E, 0xFF, 0xA1, 0x00, 0x02, 0xDF, 0xFD, 0x20, 0x1A, 0xFF, 0xE5, 0x00,
+    0x02, 0xDF, 0xFD, 0x20, 0x05, 0xEF, 0xFA, 0x10, 0x02, 0xDF, 0xFD, 0x20, 0x02, 0xDF, 0xFD, 0x20,
+    0x02, 0xDF, 0xFD, 0x20, 0x02, 0xDF, 0xFD, 0x20, 0x05, 0xEF, 0xFD, 0x20, 0x02, 0xDF, 0xFD, 0x20,
+    0x4B, 0xFF, 0xFD, 0x20, 0x02, 0xDF, 0xFD, 0x20, 0xAF, 0xFF, 0xFA, 0x10, 0x01, 0xAF, 0xFA, 0x10,
+    0x9D, 0xDD, 0xA4, 0x00, 0x00, 0x4A, 0xA4, 0x00, 0x12, 0x22, 0x10, 0x00, 0x00, 0x01, 0x10, 0x00,
+    // S (0x53)
+    0x00, 0x01, 0x22, 0x22, 0x22, 0x10, 0x00, 0x00, 0x01, 0x5A, 0xDD, 0xDD, 0xDD, 0xA5, 0x10, 0x00,
+    0x19, 0xEF, 0xFE, 0xDD, 0xEF, 0xFE, 0x91, 0x00, 0x5E, 0xFF, 0xB5, 0x22, 0x5B, 0xFF, 0xE5, 0x00,
+    0xAF, 0xFE, 0x50, 0x00, 0x05, 0xEF, 0xFA, 0x10, 0xAF, 0xFE, 0x50, 0x00, 0x01, 0xAF, 0xFA, 0x10,
+    0x5E, 0xFF, 0xA1, 0x00, 0x00, 0x4A, 0xA4, 0x00, 0x19, 0xEF, 0xE6, 0x10, 0x00, 0x01, 0x10, 0x00,
+    0x01, 0x6E, 0xFE, 0xA5, 0x10, 0x00, 0x00, 0x00, 0x00, 0x19, 0xEF, 0xFE, 0xA5, 0x10, 0x00, 0x00,
+    0x00, 0x01, 0x5A, 0xEF, 0xFE, 0x91, 0x00, 0x00, 0x00, 0x00, 0x01, 0x5A, 0xEF, 0xE6, 0x10, 0x00,
+    0x00, 0x00, 0x00, 0x01, 0x6E, 0xFE, 0x91, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0xFF, 0xE5, 0x00,
+    0x01, 0x10, 0x00, 0x00, 0x05, 0xEF, 0xFA, 0x10, 0x4A, 0xA4, 0x00, 0x00, 0x02, 0xDF, 0xFD, 0x20,
+    0xAF, 0xFA, 0x10, 0x00, 0x02, 0xDF, 0xFD, 0x20, 0xAF, 0xFE, 0x50, 0x00, 0x05, 0xEF, 0xFA, 0x10,
+    0x5E, 0xFF, 0xB5, 0x22, 0x5B, 0xFF, 0xE5, 0x00, 0x19, 0xEF, 0xFE, 0xDD, 0xEF, 0xFE, 0x91, 0x00,
+    0x01, 0x5A, 0xDD, 0xDD, 0xDD, 0xA5, 0x10, 0x00, 0x00, 0x01, 0x22, 0x22, 0x22, 0x10, 0x00, 0x00,
+    // T (0x54)
+    0x00, 0x12, 0x22, 0x22, 0x22, 0x21, 0x00, 0x04, 0xAD, 0xDD, 0xDD, 0xDD, 0xDA, 0x40, 0x1A, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xA1, 0x2D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD2, 0x2D, 0xFE, 0xEF, 0xFF,
+    0xFE, 0xEF, 0xD2, 0x2D, 0xE6, 0x6E, 0xFF, 0xE6, 0x6E, 0xD2, 0x19, 0x91, 0x2D, 0xFF, 0xD2, 0x19,
+    0x91, 0x01, 0x10, 0x2D, 0xFF, 0xD2, 0x01, 0x10, 0x00, 0x00, 0x2D, 0xFF, 0xD2, 0x00, 0x00, 0x00,
+    0x00, 0x2D, 0xFF, 0xD2, 0x00, 0x00, 0x00, 0x00, 0x2D, 0xFF, 0xD2, 0x00, 0x00, 0x00, 0x00, 0x2D,
+    0xFF, 0xD2, 0x00, 0x00, 0x00, 0x00, 0x2D, 0xFF, 0xD2, 0x00, 0x00, 0x00, 0x00, 0x2D, 0xFF, 0xD2,
+    0x00, 0x00, 0x00, 0x00, 0x2D, 0xFF, 0xD2, 0x00, 0x00, 0x00, 0x00, 0x2D, 0xFF, 0xD2, 0x00, 0x00,
+    0x00, 0x00, 0x2D, 0xFF, 0xD2, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xE5, 0x00, 0x00, 0x00, 0x04,
+    0xBF, 0xFF, 0xFB, 0x40, 0x00, 0x00, 0x1A, 0xFF, 0xFF, 0xFF, 0xA1, 0x00, 0x00, 0x19, 0xDD, 0xDD,
+    0xDD, 0x91, 0x00, 0x00, 0x01, 0x22, 0x22, 0x22, 0x10, 0x00,
+    // U (0x55)
+    0x01, 0x10, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x4A, 0xA4, 0x00, 0x00, 0x00, 0x4A, 0xA4, 0x00,
+    0xAF, 0xFA, 0x10, 0x00, 0x01, 0xAF, 0xFA, 0x10, 0xDF, 0xFD, 0x20, 0x00, 0x02, 0xDF, 0xFD, 0x20,
+    0xDF, 0xFD, 0x20, 0x00, 0x02, 0xDF, 0xFD, 0x20, 0xDF, 0xFD, 0x20, 0x00, 0x02, 0xDF, 0xFD, 0x20,
+    0xDF, 0xFD, 0x20, 0x00, 0x02, 0xDF, 0xFD, 0x20, 0xDF, 0xFD, 0x20, 0x00, 0x02, 0xDF, 0xFD, 0x20,
+    0xDF, 0xFD, 0x20, 0x00, 0x02, 0xDF, 0xFD, 0x20, 0xDF, 0xFD, 0x20, 0x00, 0x02, 0xDF, 0xFD, 0x20,
+    0xDF, 0xFD, 0x20, 0x00, 0x02, 0xDF, 0xFD, 0x20, 0xDF, 0xFD, 0x20, 0x00, 0x02, 0xDF, 0xFD, 0x20,
+    0xDF, 0xFD, 0x20, 0x00, 0x02, 0xDF, 0xFD, 0x20, 0xDF, 0xFD, 0x20, 0x00, 0x02, 0xDF, 0xFD, 0x20,
+    0xDF, 0xFD, 0x20, 0x00, 0x02, 0xDF, 0xFD, 0x20, 0xDF, 0xFD, 0x20, 0x00, 0x02, 0xDF, 0xFD, 0x20,
+    0xDF, 0xFD, 0x20, 0x00, 0x02, 0xDF, 0xFD, 0x20, 0xAF, 0xFE, 0x50, 0x00, 0x05, 0xEF, 0xFA, 0x10,
+    0x5E, 0xFF, 0xB5, 0x22, 0x5B, 0xFF, 0xE5, 0x00, 0x19, 0xEF, 0xFE, 0xDD, 0xEF, 0xFE, 0x91, 0x00,
+    0x01, 0x5A, 0xDD, 0xDD, 0xDD, 0xA5, 0x10, 0x00, 0x00, 0x01, 0x22, 0x22, 0x22, 0x10, 0x00, 0x00,
+    // V (0x56)
+    0x01, 0x10, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x4A, 0xA4, 0x00, 0x00, 0x00, 0x4A, 0xA4, 0x00,
+    0xAF, 0xFA, 0x10, 0x00, 0x01, 0xAF, 0xFA, 0x10, 0xDF, 0xFD, 0x20, 0x00, 0x02, 0xDF, 0xFD, 0x20,
+    0xDF, 0xFD, 0x20, 0x00, 0x02, 0xDF, 0xFD, 0x20, 0xDF, 0xFD, 0x20, 0x00, 0x02, 0xDF, 0xFD, 0x20,
+    0xDF, 0xFD, 0x20, 0x00, 0x02, 0xDF, 0xFD, 0x20, 0xDF, 0xFD, 0x20, 0x00, 0x02, 0xDF, 0xFD, 0x20,
+    0xDF, 0xFD, 0x20, 0x00, 0x02, 0xDF, 0xFD, 0x20, 0xDF, 0xFD, 0x20, 0x00, 0x02, 0xDF, 0xFD, 0x20,
+    0xDF, 0xFD, 0x20, 0x00, 0x02, 0xDF, 0xFD, 0x20, 0xDF, 0xFD, 0x20, 0x00, 0x02, 0xDF, 0xFD, 0x20,
+    0xDF, 0xFD, 0x20, 0x00, 0x02, 0xDF, 0xFD, 0x20, 0xAF, 0xFE, 0x50, 0x00, 0x05, 0xEF, 0xFA, 0x10,
+    0x5E, 0xFF, 0xA1, 0x00, 0x1A, 0xFF, 0xE5, 0x00, 0x19, 0xEF, 0xE5, 0x00, 0x5E, 0xFE, 0x91, 0x00,
+    0x01, 0x6E, 0xFB, 0x55, 0xBF, 0xE6, 0x10, 0x00, 0x00, 0x19, 0xEF, 0xEE, 0xFE, 0x91, 0x00, 0x00,
+    0x00, 0x01, 0x6E, 0xFF, 0xE6, 0x10, 0x00, 0x00, 0x00, 0x00, 0x1A, 0xFF, 0xA1, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x04, 0xAA, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00,
+    // W (0x57)
+    0x01, 0x10, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x4A, 0xA4, 0x00, 0x00, 0x00, 0x4A, 0xA4, 0x00,
+    0xAF, 0xFA, 0x10, 0x00, 0x01, 0xAF, 0xFA, 0x10, 0xDF, 0xFD, 0x20, 0x00, 0x02, 0xDF, 0xFD, 0x20,
+    0xDF, 0xFD, 0x20, 0x00, 0x02, 0xDF, 0xFD, 0x20, 0xDF, 0xFD, 0x20, 0x00, 0x02, 0xDF, 0xFD, 0x20,
+    0xDF, 0xFD, 0x20, 0x00, 0x02, 0xDF, 0xFD, 0x20, 0xDF, 0xFD, 0x20, 0x00, 0x02, 0xDF, 0xFD, 0x20,
+    0xDF, 0xFD, 0x20, 0x11, 0x02, 0xDF, 0xFD, 0x20, 0xDF, 0xFD, 0x21, 0x99, 0x12, 0xDF, 0xFD, 0x20,
+    0xDF, 0xFD, 0x22, 0xDD, 0x22, 0xDF, 0xFD, 0x20, 0xDF, 0xFD, 0x22, 0xDD, 0x22, 0xDF, 0xFD, 0x20,
+    0xDF, 0xFD, 0x22, 0xDD, 0x22, 0xDF, 0xFD, 0x20, 0xDF, 0xFD, 0x22, 0xDD, 0x22, 0xDF, 0xFD, 0x20,
+    0xDF, 0xFE, 0x66, 0xEE, 0x66, 0xEF, 0xFD, 0x20, 0xDF, 0xFF, 0xEE, 0xFF, 0xEE, 0xFF, 0xFD, 0x20,
+    0xDF, 0xFF, 0xFF, 0xEE, 0xFF, 0xFF, 0xFD, 0x20, 0xAF, 0xFF, 0xFE, 0x66, 0xEF, 0xFF, 0xFA, 0x10,
+    0x5E, 0xFF, 0xFD, 0x22, 0xDF, 0xFF, 0xE5, 0x00, 0x19, 0xEF, 0xFA, 0x11, 0xAF, 0xFE, 0x91, 0x00,
+    0x01, 0x5A, 0xA4, 0x00, 0x4A, 0xA5, 0x10, 0x00, 0x00, 0x01, 0x10, 0x00, 0x01, 0x10, 0x00, 0x00,
+    // X (0x58)
+    0x01, 0x10, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x4A, 0xA4, 0x00, 0x00, 0x00, 0x4A, 0xA4, 0x00,
+    0xAF, 0xFA, 0x10, 0x00, 0x01, 0xAF, 0xFA, 0x10, 0xAF, 0xFE, 0x50, 0x00, 0x05, 0xEF, 0xFA, 0x10,
+    0x5E, 0xFF, 0xA1, 0x00, 0x1A, 0xFF, 0xE5, 0x00, 0x1A, 0xFF, 0xE5, 0x00, 0x5E, 0xFF, 0xA1, 0x00,
+    0x05, 0xEF, 0xFB, 0x55, 0xBF, 0xFE, 0x50, 0x00, 0x01, 0xAF, 0xFF, 0xEE, 0xFF, 0xFA, 0x10, 0x00,
+    0x00, 0x5E, 0xFF, 0xFF, 0xFF, 0xE5, 0x00, 0x00, 0x00, 0x1A, 0xFF, 0xFF, 0xFF, 0xA1, 0x00, 0x00,
+    0x00, 0x05, 0xEF, 0xFF, 0xFE, 0x50, 0x00, 0x00, 0x00, 0x05, 0xEF, 0xFF, 0xFE, 0x50, 0x00, 0x00,
+    0x00, 0x1A, 0xFF, 0xFF, 0xFF, 0xA1, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0xFF, 0xE5, 0x00, 0x00,
+    0x01, 0xAF, 0xFF, 0xEE, 0xFF, 0xFA, 0x10, 0x00, 0x05, 0xEF, 0xFB, 0x55, 0xBF, 0xFE, 0x50, 0x00,
+    0x1A, 0xFF, 0xE5, 0x00, 0x5E, 0xFF, 0xA1, 0x00, 0x5E, 0xFF, 0xA1, 0x00, 0x1A, 0xFF, 0xE5, 0x00,
+    0xAF, 0xFE, 0x50, 0x00, 0x05, 0xEF, 0xFA, 0x10, 0xAF, 0xFA, 0x10, 0x00, 0x01, 0xAF, 0xFA, 0x10,
+    0x4A, 0xA4, 0x00, 0x00, 0x00, 0x4A, 0xA4, 0x00, 0x01, 0x10, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00,
+    // Y (0x59)
+    0x00, 0x11, 0x00, 0x00, 0x00, 0x11, 0x00, 0x04, 0xAA, 0x40, 0x00, 0x04, 0xAA, 0x40, 0x1A, 0xFF,
+    0xA1, 0x00, 0x1A, 0xFF, 0xA1, 0x2D, 0xFF, 0xD2, 0x00, 0x2D, 0xFF, 0xD2, 0x2D, 0xFF, 0xD2, 0x00,
+    0x2D, 0xFF, 0xD2, 0x2D, 0xFF, 0xD2, 0x00, 0x2D, 0xFF, 0xD2, 0x2D, 0xFF, 0xD2, 0x00, 0x2D, 0xFF,
+    0xD2, 0x1A, 0xFF, 0xE5, 0x00, 0x5E, 0xFF, 0xA1, 0x05, 0xEF, 0xFB, 0x55, 0xBF, 0xFE, 0x50, 0x01,
+    0x9E, 0xFF, 0xEE, 0xFF, 0xE9, 0x10, 0x00, 0x16, 0xEF, 0xFF, 0xFE, 0x61, 0x00, 0x00, 0x01, 0xAF,
+    0xFF, 0xFA, 0x10, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xE5, 0x00, 0x00, 0x00, 0x00, 0x2D, 0xFF, 0xD2,
+    0x00, 0x00, 0x00, 0x00, 0x2D, 0xFF, 0xD2, 0x00, 0x00, 0x00, 0x00, 0x2D, 0xFF, 0xD2, 0x00, 0x00,
+    0x00, 0x00, 0x2D, 0xFF, 0xD2, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xE5, 0x00, 0x00, 0x00, 0x04,
+    0xBF, 0xFF, 0xFB, 0x40, 0x00, 0x00, 0x1A, 0xFF, 0xFF, 0xFF, 0xA1, 0x00, 0x00, 0x19, 0xDD, 0xDD,
+    0xDD, 0x91, 0x00, 0x00, 0x01, 0x22, 0x22, 0x22, 0x10, 0x00,
+    // Z (0x5A)
+    0x01, 0x22, 0x22, 0x22, 0x22, 0x22, 0x10, 0x00, 0x4A, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xA4, 0x00,
+    0xAF, 0xFF, 0xFE, 0xDD, 0xEF, 0xFF, 0xFA, 0x10, 0xDF, 0xFE, 0xA5, 0x22, 0x5B, 0xFF, 0xFD, 0x20,
+    0xDF, 0xE6, 0x10, 0x00, 0x05, 0xEF, 0xFD, 0x20, 0xDF, 0xA1, 0x00, 0x00, 0x05, 0xEF, 0xFA, 0x10,
+    0x9A, 0x40, 0x00, 0x00, 0x1A, 0xFF, 0xE5, 0x00, 0x11, 0x00, 0x00, 0x01, 0x6E, 0xFE, 0x91, 0x00,
+    0x00, 0x00, 0x00, 0x19, 0xEF, 0xE6, 0x10, 0x00, 0x00, 0x00, 0x01, 0x6E, 0xFE, 0x91, 0x00, 0x00,
+    0x00, 0x00, 0x19, 0xEF, 0xE6, 0x10, 0x00, 0x00, 0x00, 0x01, 0x6E, 0xFE, 0x91, 0x00, 0x00, 0x00,
+    0x00, 0x19, 0xEF, 0xE6, 0x10, 0x00, 0x00, 0x00, 0x01, 0x6E, 0xFE, 0x91, 0x00, 0x00, 0x00, 0x00,
+    0x19, 0xEF, 0xE6, 0x10, 0x00, 0x00, 0x11, 0x00, 0x5E, 0xFF, 0xA1, 0x00, 0x00, 0x04, 0xA9, 0x10,
+    0xAF, 0xFE, 0x50, 0x00, 0x00, 0x1A, 0xFD, 0x20, 0xDF, 0xFE, 0x50, 0x00, 0x01, 0x6E, 0xFD, 0x20,
+    0xDF, 0xFF, 0xB5, 0x22, 0x5A, 0xEF, 0xFD, 0x20, 0xAF, 0xFF, 0xFE, 0xDD, 0xEF, 0xFF, 0xFA, 0x10,
+    0x4A, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xA4, 0x00, 0x01, 0x22, 0x22, 0x22, 0x22, 0x22, 0x10, 0x00,
+    // [ (0x5B)
+    0x00, 0x12, 0x22, 0x22, 0x10, 0x04, 0xAD, 0xDD, 0xDD, 0x91, 0x1A, 0xFF, 0xFF, 0xED, 0x91, 0x2D,
+    0xFF, 0xFB, 0x52, 0x10, 0x2D, 0xFF, 0xE5, 0x00, 0x00, 0x2D, 0xFF, 0xD2, 0x00, 0x00, 0x2D, 0xFF,
+    0xD2, 0x00, 0x00, 0x2D, 0xFF, 0xD2, 0x00, 0x00, 0x2D, 0xFF, 0xD2, 0x00, 0x00, 0x2D, 0xFF, 0xD2,
+    0x00, 0x00, 0x2D, 0xFF, 0xD2, 0x00, 0x00, 0x2D, 0xFF, 0xD2, 0x00, 0x00, 0x2D, 0xFF, 0xD2, 0x00,
+    0x00, 0x2D, 0xFF, 0xD2, 0x00, 0x00, 0x2D, 0xFF, 0xD2, 0x00, 0x00, 0x2D, 0xFF, 0xD2, 0x00, 0x00,
+    0x2D, 0xFF, 0xD2, 0x00, 0x00, 0x2D, 0xFF, 0xE5, 0x00, 0x00, 0x2D, 0xFF, 0xFB, 0x52, 0x10, 0x1A,
+    0xFF, 0xFF, 0xED, 0x91, 0x04, 0xAD, 0xDD, 0xDD, 0x91, 0x00, 0x12, 0x22, 0x22, 0x10,
+    // \ (0x5C)
+    0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9A, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xDF, 0xA1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xE6, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x5E, 0xFE, 0x91, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0xEF, 0xE6, 0x10, 0x00, 0x00, 0x00, 0x00,
+    0x01, 0x6E, 0xFE, 0x91, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0xEF, 0xE6, 0x10, 0x00, 0x00, 0x00,
+    0x00, 0x01, 0x6E, 0xFE, 0x91, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0xEF, 0xE6, 0x10, 0x00, 0x00,
+    0x00, 0x00, 0x01, 0x6E, 0xFE, 0x91, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0xEF, 0xE6, 0x10, 0x00,
+    0x00, 0x00, 0x00, 0x01, 0x6E, 0xFE, 0x91, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0xEF, 0xE5, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x01, 0x6E, 0xFA, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0xFD, 0x20,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xA9, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00,
+    // ] (0x5D)
+    0x01, 0x22, 0x22, 0x21, 0x00, 0x19, 0xDD, 0xDD, 0xDA, 0x40, 0x19, 0xDE, 0xFF, 0xFF, 0xA1, 0x01,
+    0x25, 0xBF, 0xFF, 0xD2, 0x00, 0x00, 0x5E, 0xFF, 0xD2, 0x00, 0x00, 0x2D, 0xFF, 0xD2, 0x00, 0x00,
+    0x2D, 0xFF, 0xD2, 0x00, 0x00, 0x2D, 0xFF, 0xD2, 0x00, 0x00, 0x2D, 0xFF, 0xD2, 0x00, 0x00, 0x2D,
+    0xFF, 0xD2, 0x00, 0x00, 0x2D, 0xFF, 0xD2, 0x00, 0x00, 0x2D, 0xFF, 0xD2, 0x00, 0x00, 0x2D, 0xFF,
+    0xD2, 0x00, 0x00, 0x2D, 0xFF, 0xD2, 0x00, 0x00, 0x2D, 0xFF, 0xD2, 0x00, 0x00, 0x2D, 0xFF, 0xD2,
+    0x00, 0x00, 0x2D, 0xFF, 0xD2, 0x00, 0x00, 0x5E, 0xFF, 0xD2, 0x01, 0x25, 0xBF, 0xFF, 0xD2, 0x19,
+    0xDE, 0xFF, 0xFF, 0xA1, 0x19, 0xDD, 0xDD, 0xDA, 0x40, 0x01, 0x22, 0x22, 0x21, 0x00,
+    // ^ (0x5E)
+    0x00, 0x00, 0x04, 0xAA, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0xFF, 0xA1, 0x00, 0x00, 0x00,
+    0x00, 0x01, 0x6E, 0xFF, 0xE6, 0x10, 0x00, 0x00, 0x00, 0x19, 0xEF, 0xEE, 0xFE, 0x91, 0x00, 0x00,
+    0x01, 0x6E, 0xFB, 0x55, 0xBF, 0xE6, 0x10, 0x00, 0x4A, 0xEF, 0xE5, 0x00, 0x5E, 0xFE, 0xA4, 0x00,
+    0xAF, 0xFE, 0x91, 0x00, 0x19, 0xEF, 0xFA, 0x10, 0x9D, 0xA5, 0x10, 0x00, 0x01, 0x5A, 0xD9, 0x10,
+    0x12, 0x10, 0x00, 0x00, 0x00, 0x01, 0x21, 0x00,
+    // _ (0x5F)
+    0x12, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x21, 0x9D, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xD9,
+    0x9D, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xD9, 0x12, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x21,
+    // ` (0x60)
+    0x01, 0x21, 0x00, 0x00, 0x00, 0x19, 0xDA, 0x51, 0x00, 0x00, 0x1A, 0xFF, 0xE9, 0x10, 0x00, 0x04,
+    0xAE, 0xFE, 0x61, 0x00, 0x00, 0x16, 0xEF, 0xEA, 0x40, 0x00, 0x01, 0x9E, 0xFF, 0xA1, 0x00, 0x00,
+    0x15, 0xAD, 0x91, 0x00, 0x00, 0x00, 0x12, 0x10,
+    // a (0x61)
+    0x00, 0x12, 0x22, 0x22, 0x10, 0x00, 0x00, 0x00, 0x01, 0x9D, 0xDD, 0xDD, 0xA5, 0x10, 0x00, 0x00,
+    0x01, 0x9D, 0xDD, 0xDE, 0xFE, 0x91, 0x00, 0x00, 0x00, 0x12, 0x22, 0x26, 0xEF, 0xE5, 0x00, 0x00,
+    0x00, 0x01, 0x22, 0x26, 0xEF, 0xFA, 0x10, 0x00, 0x01, 0x5A, 0xDD, 0xDE, 0xFF, 0xFD, 0x20, 0x00,
+    0x19, 0xEF, 0xFE, 0xEF, 0xFF, 0xFD, 0x20, 0x00, 0x5E, 0xFF, 0xB5, 0x5B, 0xFF, 0xFD, 0x20, 0x00,
+    0xAF, 0xFE, 0x50, 0x05, 0xEF, 0xFD, 0x20, 0x00, 0xDF, 0xFD, 0x20, 0x02, 0xDF, 0xFD, 0x20, 0x00,
+    0xDF, 0xFD, 0x20, 0x02, 0xDF, 0xFD, 0x20, 0x00, 0xAF, 0xFE, 0x50, 0x04, 0xBF, 0xFE, 0x50, 0x00,
+    0x5E, 0xFF, 0xB5, 0x5B, 0x4B, 0xFF, 0xB4, 0x00, 0x19, 0xEF, 0xFE, 0xED, 0x24, 0xBF, 0xFA, 0x10,
+    0x01, 0x5A, 0xDD, 0xD9, 0x10, 0x4A, 0xD9, 0x10, 0x00, 0x01, 0x22, 0x21, 0x00, 0x01, 0x21, 0x00,
+    // b (0x62)
+    0x12, 0x22, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9D, 0xDD, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xAF, 0xFF, 0xFA, 0x10, 0x00, 0x00, 0x00, 0x00, 0x4B, 0xFF, 0xFD, 0x20, 0x00, 0x00, 0x00, 0x00,
+    0x05, 0xEF, 0xFD, 0x20, 0x00, 0x00, 0x00, 0x00, 0x02, 0xDF, 0xFE, 0x50, 0x00, 0x00, 0x00, 0x00,
+    0x02, 0xDF, 0xFF, 0xB5, 0x10, 0x00, 0x00, 0x00, 0x02, 0xDF, 0xFF, 0xFE, 0xA5, 0x10, 0x00, 0x00,
+    0x02, 0xDF, 0xFF, 0xEE, 0xFE, 0x91, 0x00, 0x00, 0x02, 0xDF, 0xFE, 0x65, 0xBF, 0xE6, 0x10, 0x00,
+    0x02, 0xDF, 0xFD, 0x20, 0x5E, 0xFE, 0x91, 0x00, 0x02, 0xDF, 0xFD, 0x20, 0x1A, 0xFF, 0xE5, 0x00,
+    0x02, 0xDF, 0xFD, 0x20, 0x05, 0xEF, 0xFA, 0x10, 0x02, 0xDF, 0xFD, 0x20, 0x02, 0xDF, 0xFD, 0x20,
+    0x02, 0xDF, 0xFD, 0x20, 0x02, 0xDF, 0xFD, 0x20, 0x02, 0xDF, 0xFD, 0x20, 0x02, 0xDF, 0xFD, 0x20,
+    0x02, 0xDF, 0xFD, 0x20, 0x02, 0xDF, 0xFD, 0x20, 0x02, 0xDF, 0xFE, 0x50, 0x05, 0xEF, 0xFA, 0x10,
+    0x02, 0xDF, 0xFF, 0xB5, 0x5B, 0xFF, 0xE5, 0x00, 0x01, 0xAF, 0xFF, 0xFE, 0xEF, 0xFE, 0x91, 0x00,
+    0x00, 0x4A, 0xDD, 0xDD, 0xDD, 0xA5, 0x10, 0x00, 0x00, 0x01, 0x22, 0x22, 0x22, 0x10, 0x00, 0x00,
+    // c (0x63)
+    0x00, 0x01, 0x22, 0x22, 0x22, 0x10, 0x00, 0x00, 0x01, 0x5A, 0xDD, 0xDD, 0xDD, 0xA5, 0x10, 0x00,
+    0x19, 0xEF, 0xFE, 0xDD, 0xEF, 0xFE, 0xA4, 0x00, 0x5E, 0xFF, 0xB5, 0x22, 0x5A, 0xEF, 0xFA, 0x10,
+    0xAF, 0xFE, 0x50, 0x00, 0x01, 0x5A, 0xD9, 0x10, 0xDF, 0xFD, 0x20, 0x00, 0x00, 0x01, 0x21, 0x00,
+    0xDF, 0xFD, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDF, 0xFD, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xDF, 0xFD, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDF, 0xFD, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xDF, 0xFD, 0x20, 0x00, 0x00, 0x01, 0x21, 0x00, 0xAF, 0xFE, 0x50, 0x00, 0x01, 0x5A, 0xD9, 0x10,
+    0x5E, 0xFF, 0xB5, 0x22, 0x5A, 0xEF, 0xFA, 0x10, 0x19, 0xEF, 0xFE, 0xDD, 0xEF, 0xFE, 0xA4, 0x00,
+    0x01, 0x5A, 0xDD, 0xDD, 0xDD, 0xA5, 0x10, 0x00, 0x00, 0x01, 0x22, 0x22, 0x22, 0x10, 0x00, 0x00,
+    // d (0x64)
+    0x00, 0x00, 0x00, 0x12, 0x22, 0x10, 0x00, 0x00, 0x00, 0x00, 0x01, 0x9D, 0xDD, 0xA4, 0x00, 0x00,
+    0x00, 0x00, 0x01, 0xAF, 0xFF, 0xFA, 0x10, 0x00, 0x00, 0x00, 0x00, 0x4B, 0xFF, 0xFD, 0x20, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0xEF, 0xFD, 0x20, 0x00, 0x00, 0x00, 0x00, 0x05, 0xEF, 0xFD, 0x20, 0x00,
+    0x00, 0x00, 0x01, 0x5B, 0xFF, 0xFD, 0x20, 0x00, 0x00, 0x01, 0x5A, 0xEF, 0xFF, 0xFD, 0x20, 0x00,
+    0x00, 0x19, 0xEF, 0xEE, 0xFF, 0xFD, 0x20, 0x00, 0x01, 0x6E, 0xFB, 0x56, 0xEF, 0xFD, 0x20, 0x00,
+    0x19, 0xEF, 0xE5, 0x02, 0xDF, 0xFD, 0x20, 0x00, 0x5E, 0xFF, 0xA1, 0x02, 0xDF, 0xFD, 0x20, 0x00,
+    0xAF, 0xFE, 0x50, 0x02, 0xDF, 0xFD, 0x20, 0x00, 0xDF, 0xFD, 0x20, 0x02, 0xDF, 0xFD, 0x20, 0x00,
+    0xDF, 0xFD, 0x20, 0x02, 0xDF, 0xFD, 0x20, 0x00, 0xDF, 0xFD, 0x20, 0x02, 0xDF, 0xFD, 0x20, 0x00,
+    0xDF, 0xFD, 0x20, 0x02, 0xDF, 0xFD, 0x20, 0x00, 0xAF, 0xFE, 0x50, 0x04, 0xBF, 0xFE, 0x50, 0x00,
+    0x5E, 0xFF, 0xB5, 0x5B, 0x4B, 0xFF, 0xB4, 0x00, 0x19, 0xEF, 0xFE, 0xED, 0x24, 0xBF, 0xFA, 0x10,
+    0x01, 0x5A, 0xDD, 0xD9, 0x10, 0x4A, 0xD9, 0x10, 0x00, 0x01, 0x22, 0x21, 0x00, 0x01, 0x21, 0x00,
+    // e (0x65)
+    0x00, 0x01, 0x22, 0x22, 0x22, 0x10, 0x00, 0x00, 0x01, 0x5A, 0xDD, 0xDD, 0xDD, 0xA5, 0x10, 0x00,
+    0x19, 0xEF, 0xED, 0xDD, 0xDE, 0xFE, 0x91, 0x00, 0x5E, 0xFE, 0x62, 0x22, 0x26, 0xEF, 0xE5, 0x00,
+    0xAF, 0xFE, 0x62, 0x22, 0x26, 0xEF, 0xFA, 0x10, 0xDF, 0xFF, 0xED, 0xDD, 0xDE, 0xFF, 0xFA, 0x10,
+    0xDF, 0xFF, 0xFE, 0xDD, 0xDD, 0xDD, 0xA4, 0x00, 0xDF, 0xFF, 0xB5, 0x22, 0x22, 0x22, 0x10, 0x00,
+    0xDF, 0xFE, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDF, 0xFD, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xDF, 0xFD, 0x20, 0x00, 0x00, 0x01, 0x21, 0x00, 0xAF, 0xFE, 0x50, 0x00, 0x01, 0x5A, 0xD9, 0x10,
+    0x5E, 0xFF, 0xB5, 0x22, 0x5A, 0xEF, 0xFA, 0x10, 0x19, 0xEF, 0xFE, 0xDD, 0xEF, 0xFE, 0xA4, 0x00,
+    0x01, 0x5A, 0xDD, 0xDD, 0xDD, 0xA5, 0x10, 0x00, 0x00, 0x01, 0x22, 0x22, 0x22, 0x10, 0x00, 0x00,
+    // f (0x66)
+    0x00, 0x00, 0x01, 0x22, 0x10, 0x00, 0x00, 0x00, 0x01, 0x5A, 0xDD, 0xA5, 0x10, 0x00, 0x00, 0x19,
+    0xEF, 0xEE, 0xFE, 0x91, 0x00, 0x00, 0x5E, 0xFE, 0x65, 0xBF, 0xE5, 0x00, 0x01, 0xAF, 0xFD, 0x20,
+    0x5E, 0xFA, 0x10, 0x02, 0xDF, 0xFD, 0x20, 0x1A, 0xFD, 0x20, 0x02, 0xDF, 0xFD, 0x20, 0x04, 0xA9,
+    0x10, 0x05, 0xEF, 0xFE, 0x50, 0x00, 0x11, 0x00, 0x4B, 0xFF, 0xFF, 0xB4, 0x00, 0x00, 0x00, 0xAF,
+    0xFF, 0xFF, 0xFA, 0x10, 0x00, 0x00, 0xAF, 0xFF, 0xFF, 0xFA, 0x10, 0x00, 0x00, 0x4B, 0xFF, 0xFF,
+    0xB4, 0x00, 0x00, 0x00, 0x05, 0xEF, 0xFE, 0x50, 0x00, 0x00, 0x00, 0x02, 0xDF, 0xFD, 0x20, 0x00,
+    0x00, 0x00, 0x02, 0xDF, 0xFD, 0x20, 0x00, 0x00, 0x00, 0x02, 0xDF, 0xFD, 0x20, 0x00, 0x00, 0x00,
+    0x02, 0xDF, 0xFD, 0x20, 0x00, 0x00, 0x00, 0x05, 0xEF, 0xFE, 0x50, 0x00, 0x00, 0x00, 0x4B, 0xFF,
+    0xFF, 0xB4, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xFF, 0xFA, 0x10, 0x00, 0x00, 0x9D, 0xDD, 0xDD, 0xD9,
+    0x10, 0x00, 0x00, 0x12, 0x22, 0x22, 0x21, 0x00, 0x00, 0x00,
+    // g (0x67)
+    0x00, 0x01, 0x22, 0x21, 0x00, 0x01, 0x21, 0x00, 0x01, 0x5A, 0xDD, 0xD9, 0x10, 0x4A, 0xD9, 0x10,
+    0x19, 0xEF, 0xFE, 0xED, 0x24, 0xBF, 0xFA, 0x10, 0x5E, 0xFF, 0xB5, 0x5B, 0x4B, 0xFF, 0xB4, 0x00,
+    0xAF, 0xFE, 0x50, 0x04, 0xBF, 0xFE, 0x50, 0x00, 0xDF, 0xFD, 0x20, 0x02, 0xDF, 0xFD, 0x20, 0x00,
+    0xDF, 0xFD, 0x20, 0x02, 0xDF, 0xFD, 0x20, 0x00, 0xAF, 0xFE, 0x50, 0x05, 0xEF, 0xFD, 0x20, 0x00,
+    0x5E, 0xFF, 0xB5, 0x5B, 0xFF, 0xFD, 0x20, 0x00, 0x19, 0xEF, 0xFE, 0xEF, 0xFF, 0xFD, 0x20, 0x00,
+    0x01, 0x5A, 0xDD, 0xEF, 0xFF, 0xFD, 0x20, 0x00, 0x00, 0x01, 0x22, 0x5B, 0xFF, 0xFD, 0x20, 0x00,
+    0x12, 0x10, 0x00, 0x05, 0xEF, 0xFD, 0x20, 0x00, 0x9D, 0xA5, 0x10, 0x05, 0xEF, 0xFA, 0x10, 0x00,
+    0xAF, 0xFE, 0xA5, 0x5B, 0xFF, 0xE5, 0x00, 0x00, 0x4A, 0xEF, 0xFE, 0xEF, 0xFE, 0x91, 0x00, 0x00,
+    0x01, 0x5A, 0xDD, 0xDD, 0xA5, 0x10, 0x00, 0x00, 0x00, 0x01, 0x22, 0x22, 0x10, 0x00, 0x00, 0x00,
+    // h (0x68)
+    0x12, 0x22, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9D, 0xDD, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xAF, 0xFF, 0xFA, 0x10, 0x00, 0x00, 0x00, 0x00, 0x4B, 0xFF, 0xFD, 0x20, 0x00, 0x00, 0x00, 0x00,
+    0x05, 0xEF, 0xFD, 0x20, 0x00, 0x00, 0x00, 0x00, 0x02, 0xDF, 0xFD, 0x20, 0x00, 0x00, 0x00, 0x00,
+    0x02, 0xDF, 0xFD, 0x20, 0x12, 0x10, 0x00, 0x00, 0x02, 0xDF, 0xFD, 0x21, 0x9D, 0xA5, 0x10, 0x00,
+    0x02, 0xDF, 0xFE, 0x64, 0xBE, 0xFE, 0x91, 0x00, 0x02, 0xDF, 0xFF, 0xEB, 0x46, 0xEF, 0xE5, 0x00,
+    0x02, 0xDF, 0xFF, 0xFA, 0x12, 0xDF, 0xFA, 0x10, 0x02, 0xDF, 0xFF, 0xB4, 0x02, 0xDF, 0xFD, 0x20,
+    0x02, 0xDF, 0xFE, 0x50, 0x02, 0xDF, 0xFD, 0x20, 0x02, 0xDF, 0xFD, 0x20, 0x02, 0xDF, 0xFD, 0x20,
+    0x02, 0xDF, 0xFD, 0x20, 0x02, 0xDF, 0xFD, 0x20, 0x02, 0xDF, 0xFD, 0x20, 0x02, 0xDF, 0xFD, 0x20,
+    0x02, 0xDF, 0xFD, 0x20, 0x02, 0xDF, 0xFD, 0x20, 0x05, 0xEF, 0xFD, 0x20, 0x02, 0xDF, 0xFD, 0x20,
+    0x4B, 0xFF, 0xFD, 0x20, 0x02, 0xDF, 0xFD, 0x20, 0xAF, 0xFF, 0xFA, 0x10, 0x01, 0xAF, 0xFA, 0x10,
+    0x9D, 0xDD, 0xA4, 0x00, 0x00, 0x4A, 0xA4, 0x00, 0x12, 0x22, 0x10, 0x00, 0x00, 0x01, 0x10, 0x00,
+    // i (0x69)
+    0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x04, 0xAA, 0x40, 0x00, 0x00, 0x1A, 0xFF, 0xA1, 0x00, 0x00,
+    0x1A, 0xFF, 0xA1, 0x00, 0x00, 0x04, 0xAA, 0x40, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x01, 0x22,
+    0x21, 0x00, 0x00, 0x19, 0xDD, 0xDA, 0x40, 0x00, 0x1A, 0xFF, 0xFF, 0xA1, 0x00, 0x04, 0xBF, 0xFF,
+    0xD2, 0x00, 0x00, 0x5E, 0xFF, 0xD2, 0x00, 0x00, 0x2D, 0xFF, 0xD2, 0x00, 0x00, 0x2D, 0xFF, 0xD2,
+    0x00, 0x00, 0x2D, 0xFF, 0xD2, 0x00, 0x00, 0x2D, 0xFF, 0xD2, 0x00, 0x00, 0x2D, 0xFF, 0xD2, 0x00,
+    0x00, 0x2D, 0xFF, 0xD2, 0x00, 0x00, 0x5E, 0xFF, 0xE5, 0x00, 0x04, 0xBF, 0xFF, 0xFB, 0x40, 0x1A,
+    0xFF, 0xFF, 0xFF, 0xA1, 0x19, 0xDD, 0xDD, 0xDD, 0x91, 0x01, 0x22, 0x22, 0x22, 0x10,
+    // j (0x6A)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xAA, 0x40, 0x00, 0x00,
+    0x00, 0x00, 0x1A, 0xFF, 0xA1, 0x00, 0x00, 0x00, 0x00, 0x1A, 0xFF, 0xA1, 0x00, 0x00, 0x00, 0x00,
+    0x04, 0xAA, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x01, 0x22, 0x21,
+    0x00, 0x00, 0x00, 0x00, 0x19, 0xDD, 0xDA, 0x40, 0x00, 0x00, 0x00, 0x1A, 0xFF, 0xFF, 0xA1, 0x00,
+    0x00, 0x00, 0x04, 0xBF, 0xFF, 0xD2, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xD2, 0x00, 0x00, 0x00,
+    0x00, 0x2D, 0xFF, 0xD2, 0x00, 0x00, 0x00, 0x00, 0x2D, 0xFF, 0xD2, 0x00, 0x00, 0x00, 0x00, 0x2D,
+    0xFF, 0xD2, 0x00, 0x00, 0x00, 0x00, 0x2D, 0xFF, 0xD2, 0x00, 0x00, 0x00, 0x00, 0x2D, 0xFF, 0xD2,
+    0x00, 0x00, 0x00, 0x00, 0x2D, 0xFF, 0xD2, 0x00, 0x00, 0x00, 0x00, 0x2D, 0xFF, 0xD2, 0x01, 0x21,
+    0x00, 0x00, 0x2D, 0xFF, 0xD2, 0x19, 0xDA, 0x51, 0x00, 0x5E, 0xFF, 0xA1, 0x1A, 0xFF, 0xEA, 0x55,
+    0xBF, 0xFE, 0x50, 0x04, 0xAE, 0xFF, 0xEE, 0xFF, 0xE9, 0x10, 0x00, 0x15, 0xAD, 0xDD, 0xDA, 0x51,
+    0x00, 0x00, 0x00, 0x12, 0x22, 0x21, 0x00, 0x00,
+    // k (0x6B)
+    0x12, 0x22, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9D, 0xDD, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xAF, 0xFF, 0xFA, 0x10, 0x00, 0x00, 0x00, 0x00, 0x4B, 0xFF, 0xFD, 0x20, 0x00, 0x00, 0x00, 0x00,
+    0x05, 0xEF, 0xFD, 0x20, 0x00, 0x00, 0x00, 0x00, 0x02, 0xDF, 0xFD, 0x20, 0x00, 0x00, 0x00, 0x00,
+    0x02, 0xDF, 0xFD, 0x20, 0x00, 0x01, 0x21, 0x00, 0x02, 0xDF, 0xFD, 0x20, 0x01, 0x5A, 0xD9, 0x10,
+    0x02, 0xDF, 0xFD, 0x20, 0x19, 0xEF, 0xFA, 0x10, 0x02, 0xDF, 0xFD, 0x20, 0x5E, 0xFE, 0xA4, 0x00,
+    0x02, 0xDF, 0xFE, 0x65, 0xBF, 0xB5, 0x10, 0x00, 0x02, 0xDF, 0xFF, 0xEE, 0xFE, 0x50, 0x00, 0x00,
+    0x02, 0xDF, 0xFF, 0xEE, 0xFE, 0x50, 0x00, 0x00, 0x02, 0xDF, 0xFE, 0x65, 0xBF, 0xB5, 0x10, 0x00,
+    0x02, 0xDF, 0xFD, 0x20, 0x5E, 0xFE, 0x91, 0x00, 0x02, 0xDF, 0xFD, 0x20, 0x1A, 0xFF, 0xE5, 0x00,
+    0x02, 0xDF, 0xFD, 0x20, 0x05, 0xEF, 0xFA, 0x10, 0x05, 0xEF, 0xFD, 0x20, 0x02, 0xDF, 0xFD, 0x20,
+    0x4B, 0xFF, 0xFD, 0x20, 0x02, 0xDF, 0xFD, 0x20, 0xAF, 0xFF, 0xFA, 0x10, 0x01, 0xAF, 0xFA, 0x10,
+    0x9D, 0xDD, 0xA4, 0x00, 0x00, 0x4A, 0xA4, 0x00, 0x12, 0x22, 0x10, 0x00, 0x00, 0x01, 0x10, 0x00,
+    // l (0x6C)
+    0x01, 0x22, 0x21, 0x00, 0x00, 0x19, 0xDD, 0xDA, 0x40, 0x00, 0x1A, 0xFF, 0xFF, 0xA1, 0x00, 0x04,
+    0xBF, 0xFF, 0xD2, 0x00, 0x00, 0x5E, 0xFF, 0xD2, 0x00, 0x00, 0x2D, 0xFF, 0xD2, 0x00, 0x00, 0x2D,
+    0xFF, 0xD2, 0x00, 0x00, 0x2D, 0xFF, 0xD2, 0x00, 0x00, 0x2D, 0xFF, 0xD2, 0x00, 0x00, 0x2D, 0xFF,
+    0xD2, 0x00, 0x00, 0x2D, 0xFF, 0xD2, 0x00, 0x00, 0x2D, 0xFF, 0xD2, 0x00, 0x00, 0x2D, 0xFF, 0xD2,
+    0x00, 0x00, 0x2D, 0xFF, 0xD2, 0x00, 0x00, 0x2D, 0xFF, 0xD2, 0x00, 0x00, 0x2D, 0xFF, 0xD2, 0x00,
+    0x00, 0x2D, 0xFF, 0xD2, 0x00, 0x00, 0x5E, 0xFF, 0xE5, 0x00, 0x04, 0xBF, 0xFF, 0xFB, 0x40, 0x1A,
+    0xFF, 0xFF, 0xFF, 0xA1, 0x19, 0xDD, 0xDD, 0xDD, 0x91, 0x01, 0x22, 0x22, 0x22, 0x10,
+    // m (0x6D)
+    0x01, 0x22, 0x10, 0x00, 0x01, 0x10, 0x00, 0x00, 0x4A, 0xDD, 0xA4, 0x00, 0x4A, 0xA5, 0x10, 0x00,
+    0xAF, 0xFF, 0xFB, 0x55, 0xBF, 0xFE, 0x91, 0x00, 0xDF, 0xFF, 0xFF, 0xEE, 0xFF, 0xFF, 0xE5, 0x00,
+    0xDF, 0xFF, 0xEE, 0xFF, 0xEE, 0xFF, 0xFA, 0x10, 0xDF, 0xFE, 0x66, 0xEE, 0x66, 0xEF, 0xFD, 0x20,
+    0xDF, 0xFD, 0x22, 0xDD, 0x22, 0xDF, 0xFD, 0x20, 0xDF, 0xFD, 0x22, 0xDD, 0x22, 0xDF, 0xFD, 0x20,
+    0xDF, 0xFD, 0x22, 0xDD, 0x22, 0xDF, 0xFD, 0x20, 0xDF, 0xFD, 0x22, 0xDD, 0x22, 0xDF, 0xFD, 0x20,
+    0xDF, 0xFD, 0x22, 0xDD, 0x22, 0xDF, 0xFD, 0x20, 0xDF, 0xFD, 0x22, 0xDD, 0x22, 0xDF, 0xFD, 0x20,
+    0xDF, 0xFD, 0x21, 0x99, 0x12, 0xDF, 0xFD, 0x20, 0xAF, 0xFA, 0x10, 0x11, 0x01, 0xAF, 0xFA, 0x10,
+    0x4A, 0xA4, 0x00, 0x00, 0x00, 0x4A, 0xA4, 0x00, 0x01, 0x10, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00,
+    // n (0x6E)
+    0x12, 0x10, 0x00, 0x12, 0x22, 0x10, 0x00, 0x00, 0x9D, 0xA4, 0x01, 0x9D, 0xDD, 0xA5, 0x10, 0x00,
+    0xAF, 0xFB, 0x42, 0xDE, 0xEF, 0xFE, 0x91, 0x00, 0x4B, 0xFF, 0xB4, 0xB5, 0x5B, 0xFF, 0xE5, 0x00,
+    0x05, 0xEF, 0xFB, 0x40, 0x05, 0xEF, 0xFA, 0x10, 0x02, 0xDF, 0xFD, 0x20, 0x02, 0xDF, 0xFD, 0x20,
+    0x02, 0xDF, 0xFD, 0x20, 0x02, 0xDF, 0xFD, 0x20, 0x02, 0xDF, 0xFD, 0x20, 0x02, 0xDF, 0xFD, 0x20,
+    0x02, 0xDF, 0xFD, 0x20, 0x02, 0xDF, 0xFD, 0x20, 0x02, 0xDF, 0xFD, 0x20, 0x02, 0xDF, 0xFD, 0x20,
+    0x02, 0xDF, 0xFD, 0x20, 0x02, 0xDF, 0xFD, 0x20, 0x02, 0xDF, 0xFD, 0x20, 0x02, 0xDF, 0xFD, 0x20,
+    0x02, 0xDF, 0xFD, 0x20, 0x02, 0xDF, 0xFD, 0x20, 0x01, 0xAF, 0xFA, 0x10, 0x01, 0xAF, 0xFA, 0x10,
+    0x00, 0x4A, 0xA4, 0x00, 0x00, 0x4A, 0xA4, 0x00, 0x00, 0x01, 0x10, 0x00, 0x00, 0x01, 0x10, 0x00,
+    // o (0x6F)
+    0x00, 0x01, 0x22, 0x22, 0x22, 0x10, 0x00, 0x00, 0x01, 0x5A, 0xDD, 0xDD, 0xDD, 0xA5, 0x10, 0x00,
+    0x19, 0xEF, 0xFE, 0xDD, 0xEF, 0xFE, 0x91, 0x00, 0x5E, 0xFF, 0xB5, 0x22, 0x5B, 0xFF, 0xE5, 0x00,
+    0xAF, 0xFE, 0x50, 0x00, 0x05, 0xEF, 0xFA, 0x10, 0xDF, 0xFD, 0x20, 0x00, 0x02, 0xDF, 0xFD, 0x20,
+    0xDF, 0xFD, 0x20, 0x00, 0x02, 0xDF, 0xFD, 0x20, 0xDF, 0xFD, 0x20, 0x00, 0x02, 0xDF, 0xFD, 0x20,
+    0xDF, 0xFD, 0x20, 0x00, 0x02, 0xDF, 0xFD, 0x20, 0xDF, 0xFD, 0x20, 0x00, 0x02, 0xDF, 0xFD, 0x20,
+    0xDF, 0xFD, 0x20, 0x00, 0x02, 0xDF, 0xFD, 0x20, 0xAF, 0xFE, 0x50, 0x00, 0x05, 0xEF, 0xFA, 0x10,
+    0x5E, 0xFF, 0xB5, 0x22, 0x5B, 0xFF, 0xE5, 0x00, 0x19, 0xEF, 0xFE, 0xDD, 0xEF, 0xFE, 0x91, 0x00,
+    0x01, 0x5A, 0xDD, 0xDD, 0xDD, 0xA5, 0x10, 0x00, 0x00, 0x01, 0x22, 0x22, 0x22, 0x10, 0x00, 0x00,
+    // p (0x70)
+    0x12, 0x10, 0x00, 0x12, 0x22, 0x10, 0x00, 0x00, 0x9D, 0xA4, 0x01, 0x9D, 0xDD, 0xA5, 0x10, 0x00,
+    0xAF, 0xFB, 0x42, 0xDE, 0xEF, 0xFE, 0x91, 0x00, 0x4B, 0xFF, 0xB4, 0xB5, 0x5B, 0xFF, 0xE5, 0x00,
+    0x05, 0xEF, 0xFB, 0x40, 0x05, 0xEF, 0xFA, 0x10, 0x02, 0xDF, 0xFD, 0x20, 0x02, 0xDF, 0xFD, 0x20,
+    0x02, 0xDF, 0xFD, 0x20, 0x02, 0xDF, 0xFD, 0x20, 0x02, 0xDF, 0xFD, 0x20, 0x02, 0xDF, 0xFD, 0x20,
+    0x02, 0xDF, 0xFD, 0x20, 0x02, 0xDF, 0xFD, 0x20, 0x02, 0xDF, 0xFE, 0x50, 0x05, 0xEF, 0xFA, 0x10,
+    0x02, 0xDF, 0xFF, 0xB5, 0x5B, 0xFF, 0xE5, 0x00, 0x02, 0xDF, 0xFF, 0xFE, 0xEF, 0xFE, 0x91, 0x00,
+    0x02, 0xDF, 0xFF, 0xED, 0xDD, 0xA5, 0x10, 0x00, 0x05, 0xEF, 0xFE, 0x62, 0x22, 0x10, 0x00, 0x00,
+    0x4B, 0xFF, 0xFE, 0x61, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xFF, 0xE9, 0x10, 0x00, 0x00, 0x00,
+    0x9D, 0xDD, 0xDD, 0xD9, 0x10, 0x00, 0x00, 0x00, 0x12, 0x22, 0x22, 0x21, 0x00, 0x00, 0x00, 0x00,
+    // q (0x71)
+    0x00, 0x01, 0x22, 0x21, 0x00, 0x01, 0x21, 0x00, 0x01, 0x5A, 0xDD, 0xD9, 0x10, 0x4A, 0xD9, 0x10,
+    0x19, 0xEF, 0xFE, 0xED, 0x24, 0xBF, 0xFA, 0x10, 0x5E, 0xFF, 0xB5, 0x5B, 0x4B, 0xFF, 0xB4, 0x00,
+    0xAF, 0xFE, 0x50, 0x04, 0xBF, 0xFE, 0x50, 0x00, 0xDF, 0xFD, 0x20, 0x02, 0xDF, 0xFD, 0x20, 0x00,
+    0xDF, 0xFD, 0x20, 0x02, 0xDF, 0xFD, 0x20, 0x00, 0xDF, 0xFD, 0x20, 0x02, 0xDF, 0xFD, 0x20, 0x00,
+    0xDF, 0xFD, 0x20, 0x02, 0xDF, 0xFD, 0x20, 0x00, 0xAF, 0xFE, 0x50, 0x05, 0xEF, 0xFD, 0x20, 0x00,
+    0x5E, 0xFF, 0xB5, 0x5B, 0xFF, 0xFD, 0x20, 0x00, 0x19, 0xEF, 0xFE, 0xEF, 0xFF, 0xFD, 0x20, 0x00,
+    0x01, 0x5A, 0xDD, 0xDE, 0xFF, 0xFD, 0x20, 0x00, 0x00, 0x01, 0x22, 0x26, 0xEF, 0xFE, 0x50, 0x00,
+    0x00, 0x00, 0x00, 0x16, 0xEF, 0xFF, 0xB4, 0x00, 0x00, 0x00, 0x01, 0x9E, 0xFF, 0xFF, 0xFA, 0x10,
+    0x00, 0x00, 0x01, 0x9D, 0xDD, 0xDD, 0xD9, 0x10, 0x00, 0x00, 0x00, 0x12, 0x22, 0x22, 0x21, 0x00,
+    // r (0x72)
+    0x12, 0x10, 0x00, 0x01, 0x22, 0x10, 0x00, 0x00, 0x9D, 0xA4, 0x00, 0x4A, 0xDD, 0xA5, 0x10, 0x00,
+    0xAF, 0xFB, 0x55, 0xBF, 0xEE, 0xFE, 0x91, 0x00, 0x4B, 0xFF, 0xEE, 0xFB, 0x56, 0xEF, 0xE5, 0x00,
+    0x05, 0xEF, 0xFF, 0xE5, 0x02, 0xDF, 0xFA, 0x10, 0x02, 0xDF, 0xFF, 0xA1, 0x01, 0xAF, 0xFA, 0x10,
+    0x02, 0xDF, 0xFE, 0x50, 0x00, 0x4A, 0xA4, 0x00, 0x02, 0xDF, 0xFD, 0x20, 0x00, 0x01, 0x10, 0x00,
+    0x02, 0xDF, 0xFD, 0x20, 0x00, 0x00, 0x00, 0x00, 0x02, 0xDF, 0xFD, 0x20, 0x00, 0x00, 0x00, 0x00,
+    0x02, 0xDF, 0xFD, 0x20, 0x00, 0x00, 0x00, 0x00, 0x05, 0xEF, 0xFE, 0x50, 0x00, 0x00, 0x00, 0x00,
+    0x4B, 0xFF, 0xFF, 0xB4, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xFF, 0xFA, 0x10, 0x00, 0x00, 0x00,
+    0x9D, 0xDD, 0xDD, 0xD9, 0x10, 0x00, 0x00, 0x00, 0x12, 0x22, 0x22, 0x21, 0x00, 0x00, 0x00, 0x00,
+    // s (0x73)
+    0x00, 0x01, 0x22, 0x22, 0x22, 0x10, 0x00, 0x00, 0x01, 0x5A, 0xDD, 0xDD, 0xDD, 0xA5, 0x10, 0x00,
+    0x4A, 0xEF, 0xED, 0xDD, 0xEF, 0xFE, 0xA4, 0x00, 0xAF, 0xFE, 0x62, 0x22, 0x5A, 0xEF, 0xFA, 0x10,
+    0xAF, 0xFE, 0x62, 0x10, 0x01, 0x5A, 0xD9, 0x10, 0x4A, 0xEF, 0xED, 0xA5, 0x10, 0x01, 0x21, 0x00,
+    0x01, 0x5A, 0xEF, 0xFE, 0xA5, 0x10, 0x00, 0x00, 0x00, 0x01, 0x5A, 0xEF, 0xFE, 0xA5, 0x10, 0x00,
+    0x01, 0x10, 0x01, 0x5A, 0xEF, 0xFE, 0x91, 0x00, 0x4A, 0xA4, 0x00, 0x01, 0x5B, 0xFF, 0xE5, 0x00,
+    0xAF, 0xFA, 0x10, 0x00, 0x05, 0xEF, 0xFA, 0x10, 0xAF, 0xFE, 0x50, 0x00, 0x05, 0xEF, 0xFA, 0x10,
+    0x5E, 0xFF, 0xB5, 0x22, 0x5B, 0xFF, 0xE5, 0x00, 0x19, 0xEF, 0xFE, 0xDD, 0xEF, 0xFE, 0x91, 0x00,
+    0x01, 0x5A, 0xDD, 0xDD, 0xDD, 0xA5, 0x10, 0x00, 0x00, 0x01, 0x22, 0x22, 0x22, 0x10, 0x00, 0x00,
+    // t (0x74)
+    0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xA9, 0x10, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x1A, 0xFD, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFD, 0x20, 0x00, 0x00, 0x00,
+    0x00, 0x01, 0xAF, 0xFD, 0x20, 0x00, 0x00, 0x00, 0x00, 0x05, 0xEF, 0xFE, 0x50, 0x00, 0x00, 0x00,
+    0x12, 0x5B, 0xFF, 0xFF, 0xB5, 0x21, 0x00, 0x00, 0x9D, 0xEF, 0xFF, 0xFF, 0xFE, 0xD9, 0x10, 0x00,
+    0x9D, 0xEF, 0xFF, 0xFF, 0xFE, 0xD9, 0x10, 0x00, 0x12, 0x5B, 0xFF, 0xFF, 0xB5, 0x21, 0x00, 0x00,
+    0x00, 0x05, 0xEF, 0xFE, 0x50, 0x00, 0x00, 0x00, 0x00, 0x02, 0xDF, 0xFD, 0x20, 0x00, 0x00, 0x00,
+    0x00, 0x02, 0xDF, 0xFD, 0x20, 0x00, 0x00, 0x00, 0x00, 0x02, 0xDF, 0xFD, 0x20, 0x00, 0x00, 0x00,
+    0x00, 0x02, 0xDF, 0xFD, 0x20, 0x00, 0x00, 0x00, 0x00, 0x02, 0xDF, 0xFD, 0x20, 0x00, 0x00, 0x00,
+    0x00, 0x02, 0xDF, 0xFD, 0x20, 0x01, 0x21, 0x00, 0x00, 0x01, 0xAF, 0xFD, 0x20, 0x4A, 0xD9, 0x10,
+    0x00, 0x00, 0x5E, 0xFE, 0x65, 0xBF, 0xFA, 0x10, 0x00, 0x00, 0x19, 0xEF, 0xEE, 0xFE, 0xA4, 0x00,
+    0x00, 0x00, 0x01, 0x5A, 0xDD, 0xA5, 0x10, 0x00, 0x00, 0x00, 0x00, 0x01, 0x22, 0x10, 0x00, 0x00,
+    // u (0x75)
+    0x01, 0x10, 0x00, 0x00, 0x01, 0x10, 0x00, 0x00, 0x4A, 0xA4, 0x00, 0x00, 0x4A, 0xA4, 0x00, 0x00,
+    0xAF, 0xFA, 0x10, 0x01, 0xAF, 0xFA, 0x10, 0x00, 0xDF, 0xFD, 0x20, 0x02, 0xDF, 0xFD, 0x20, 0x00,
+    0xDF, 0xFD, 0x20, 0x02, 0xDF, 0xFD, 0x20, 0x00, 0xDF, 0xFD, 0x20, 0x02, 0xDF, 0xFD, 0x20, 0x00,
+    0xDF, 0xFD, 0x20, 0x02, 0xDF, 0xFD, 0x20, 0x00, 0xDF, 0xFD, 0x20, 0x02, 0xDF, 0xFD, 0x20, 0x00,
+    0xDF, 0xFD, 0x20, 0x02, 0xDF, 0xFD, 0x20, 0x00, 0xDF, 0xFD, 0x20, 0x02, 0xDF, 0xFD, 0x20, 0x00,
+    0xDF, 0xFD, 0x20, 0x02, 0xDF, 0xFD, 0x20, 0x00, 0xAF, 0xFE, 0x50, 0x04, 0xBF, 0xFE, 0x50, 0x00,
+    0x5E, 0xFF, 0xB5, 0x5B, 0x4B, 0xFF, 0xB4, 0x00, 0x19, 0xEF, 0xFE, 0xED, 0x24, 0xBF, 0xFA, 0x10,
+    0x01, 0x5A, 0xDD, 0xD9, 0x10, 0x4A, 0xD9, 0x10, 0x00, 0x01, 0x22, 0x21, 0x00, 0x01, 0x21, 0x00,
+    // v (0x76)
+    0x01, 0x10, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x4A, 0xA4, 0x00, 0x00, 0x00, 0x4A, 0xA4, 0x00,
+    0xAF, 0xFA, 0x10, 0x00, 0x01, 0xAF, 0xFA, 0x10, 0xDF, 0xFD, 0x20, 0x00, 0x02, 0xDF, 0xFD, 0x20,
+    0xDF, 0xFD, 0x20, 0x00, 0x02, 0xDF, 0xFD, 0x20, 0xDF, 0xFD, 0x20, 0x00, 0x02, 0xDF, 0xFD, 0x20,
+    0xDF, 0xFD, 0x20, 0x00, 0x02, 0xDF, 0xFD, 0x20, 0xAF, 0xFE, 0x50, 0x00, 0x05, 0xEF, 0xFA, 0x10,
+    0x5E, 0xFF, 0xA1, 0x00, 0x1A, 0xFF, 0xE5, 0x00, 0x19, 0xEF, 0xE5, 0x00, 0x5E, 0xFE, 0x91, 0x00,
+    0x01, 0x6E, 0xFB, 0x55, 0xBF, 0xE6, 0x10, 0x00, 0x00, 0x19, 0xEF, 0xEE, 0xFE, 0x91, 0x00, 0x00,
+    0x00, 0x01, 0x6E, 0xFF, 0xE6, 0x10, 0x00, 0x00, 0x00, 0x00, 0x1A, 0xFF, 0xA1, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x04, 0xAA, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00,
+    // w (0x77)
+    0x01, 0x10, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x4A, 0xA4, 0x00, 0x00, 0x00, 0x4A, 0xA4, 0x00,
+    0xAF, 0xFA, 0x10, 0x00, 0x01, 0xAF, 0xFA, 0x10, 0xDF, 0xFD, 0x20, 0x00, 0x02, 0xDF, 0xFD, 0x20,
+    0xDF, 0xFD, 0x20, 0x11, 0x02, 0xDF, 0xFD, 0x20, 0xDF, 0xFD, 0x21, 0x99, 0x12, 0xDF, 0xFD, 0x20,
+    0xDF, 0xFD, 0x22, 0xDD, 0x22, 0xDF, 0xFD, 0x20, 0xDF, 0xFD, 0x22, 0xDD, 0x22, 0xDF, 0xFD, 0x20,
+    0xDF, 0xFD, 0x22, 0xDD, 0x22, 0xDF, 0xFD, 0x20, 0xDF, 0xFD, 0x22, 0xDD, 0x22, 0xDF, 0xFD, 0x20,
+    0xDF, 0xFE, 0x66, 0xEE, 0x66, 0xEF, 0xFD, 0x20, 0xAF, 0xFF, 0xEE, 0xFF, 0xEE, 0xFF, 0xFA, 0x10,
+    0x5E, 0xFF, 0xFF, 0xEE, 0xFF, 0xFF, 0xE5, 0x00, 0x19, 0xEF, 0xFB, 0x55, 0xBF, 0xFE, 0x91, 0x00,
+    0x01, 0x5A, 0xA4, 0x00, 0x4A, 0xA5, 0x10, 0x00, 0x00, 0x01, 0x10, 0x00, 0x01, 0x10, 0x00, 0x00,
+    // x (0x78)
+    0x12, 0x10, 0x00, 0x00, 0x00, 0x01, 0x21, 0x00, 0x9D, 0xA5, 0x10, 0x00, 0x01, 0x5A, 0xD9, 0x10,
+    0xAF, 0xFE, 0x91, 0x00, 0x19, 0xEF, 0xFA, 0x10, 0x4A, 0xEF, 0xE5, 0x00, 0x5E, 0xFE, 0xA4, 0x00,
+    0x01, 0x6E, 0xFB, 0x55, 0xBF, 0xE6, 0x10, 0x00, 0x00, 0x1A, 0xFF, 0xEE, 0xFF, 0xA1, 0x00, 0x00,
+    0x00, 0x05, 0xEF, 0xFF, 0xFE, 0x50, 0x00, 0x00, 0x00, 0x05, 0xEF, 0xFF, 0xFE, 0x50, 0x00, 0x00,
+    0x00, 0x1A, 0xFF, 0xEE, 0xFF, 0xA1, 0x00, 0x00, 0x01, 0x6E, 0xFB, 0x55, 0xBF, 0xE6, 0x10, 0x00,
+    0x19, 0xEF, 0xE5, 0x00, 0x5E, 0xFE, 0x91, 0x00, 0x5E, 0xFF, 0xA1, 0x00, 0x1A, 0xFF, 0xE5, 0x00,
+    0xAF, 0xFE, 0x50, 0x00, 0x05, 0xEF, 0xFA, 0x10, 0xAF, 0xFA, 0x10, 0x00, 0x01, 0xAF, 0xFA, 0x10,
+    0x4A, 0xA4, 0x00, 0x00, 0x00, 0x4A, 0xA4, 0x00, 0x01, 0x10, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00,
+    // y (0x79)
+    0x01, 0x10, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x4A, 0xA4, 0x00, 0x00, 0x00, 0x4A, 0xA4, 0x00,
+    0xAF, 0xFA, 0x10, 0x00, 0x01, 0xAF, 0xFA, 0x10, 0xDF, 0xFD, 0x20, 0x00, 0x02, 0xDF, 0xFD, 0x20,
+    0xDF, 0xFD, 0x20, 0x00, 0x02, 0xDF, 0xFD, 0x20, 0xDF, 0xFD, 0x20, 0x00, 0x02, 0xDF, 0xFD, 0x20,
+    0xDF, 0xFD, 0x20, 0x00, 0x02, 0xDF, 0xFD, 0x20, 0xAF, 0xFE, 0x50, 0x00, 0x05, 0xEF, 0xFD, 0x20,
+    0x5E, 0xFF, 0xB5, 0x22, 0x5B, 0xFF, 0xFD, 0x20, 0x19, 0xEF, 0xFE, 0xDD, 0xEF, 0xFF, 0xFD, 0x20,
+    0x01, 0x5A, 0xDD, 0xDD, 0xDE, 0xFF, 0xFD, 0x20, 0x00, 0x01, 0x22, 0x22, 0x26, 0xEF, 0xFA, 0x10,
+    0x00, 0x00, 0x00, 0x00, 0x05, 0xEF, 0xE5, 0x00, 0x00, 0x00, 0x00, 0x01, 0x5B, 0xFE, 0x91, 0x00,
+    0x12, 0x22, 0x22, 0x5A, 0xEF, 0xE6, 0x10, 0x00, 0x9D, 0xDD, 0xDD, 0xEF, 0xFE, 0x91, 0x00, 0x00,
+    0x9D, 0xDD, 0xDD, 0xDD, 0xA5, 0x10, 0x00, 0x00, 0x12, 0x22, 0x22, 0x22, 0x10, 0x00, 0x00, 0x00,
+    // z (0x7A)
+    0x01, 0x22, 0x22, 0x22, 0x22, 0x22, 0x21, 0x00, 0x4A, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xD9, 0x10,
+    0xAF, 0xFF, 0xFE, 0xDE, 0xFF, 0xFF, 0xFA, 0x10, 0xAF, 0xFE, 0xA5, 0x26, 0xEF, 0xFE, 0xA4, 0x00,
+    0x4A, 0xA5, 0x10, 0x05, 0xEF, 0xE6, 0x10, 0x00, 0x01, 0x10, 0x01, 0x5B, 0xFE, 0x91, 0x00, 0x00,
+    0x00, 0x00, 0x19, 0xEF, 0xE6, 0x10, 0x00, 0x00, 0x00, 0x01, 0x6E, 0xFE, 0x91, 0x00, 0x00, 0x00,
+    0x00, 0x19, 0xEF, 0xE6, 0x10, 0x01, 0x10, 0x00, 0x01, 0x6E, 0xFE, 0x91, 0x00, 0x4A, 0xA4, 0x00,
+    0x19, 0xEF, 0xB5, 0x10, 0x01, 0xAF, 0xFA, 0x10, 0x5E, 0xFE, 0x50, 0x00, 0x05, 0xEF, 0xFD, 0x20,
+    0xAF, 0xFE, 0x62, 0x22, 0x5B, 0xFF, 0xFD, 0x20, 0xAF, 0xFF, 0xED, 0xDD, 0xEF, 0xFF, 0xFA, 0x10,
+    0x4A, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xA4, 0x00, 0x01, 0x22, 0x22, 0x22, 0x22, 0x22, 0x10, 0x00,
+    // { (0x7B)
+    0x00, 0x00, 0x00, 0x00, 0x12, 0x22, 0x10, 0x00, 0x00, 0x00, 0x15, 0xAD, 0xDD, 0x91, 0x00, 0x00,
+    0x01, 0x9E, 0xFF, 0xED, 0x91, 0x00, 0x00, 0x05, 0xEF, 0xFB, 0x52, 0x10, 0x00, 0x00, 0x1A, 0xFF,
+    0xE5, 0x00, 0x00, 0x00, 0x00, 0x2D, 0xFF, 0xD2, 0x00, 0x00, 0x00, 0x00, 0x2D, 0xFF, 0xD2, 0x00,
+    0x00, 0x00, 0x00, 0x5E, 0xFF, 0xA1, 0x00, 0x00, 0x01, 0x25, 0xBF, 0xFB, 0x40, 0x00, 0x00, 0x19,
+    0xDE, 0xFF, 0xE5, 0x00, 0x00, 0x00, 0x19, 0xDE, 0xFF, 0xE5, 0x00, 0x00, 0x00, 0x01, 0x25, 0xBF,
+    0xFB, 0x40, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xA1, 0x00, 0x00, 0x00, 0x00, 0x2D, 0xFF, 0xD2,
+    0x00, 0x00, 0x00, 0x00, 0x2D, 0xFF, 0xD2, 0x00, 0x00, 0x00, 0x00, 0x2D, 0xFF, 0xD2, 0x00, 0x00,
+    0x00, 0x00, 0x2D, 0xFF, 0xD2, 0x00, 0x00, 0x00, 0x00, 0x1A, 0xFF, 0xE5, 0x00, 0x00, 0x00, 0x00,
+    0x05, 0xEF, 0xFB, 0x52, 0x10, 0x00, 0x00, 0x01, 0x9E, 0xFF, 0xED, 0x91, 0x00, 0x00, 0x00, 0x15,
+    0xAD, 0xDD, 0x91, 0x00, 0x00, 0x00, 0x00, 0x12, 0x22, 0x10,
+    // | (0x7C)
+    0x00, 0x11, 0x00, 0x04, 0xAA, 0x40, 0x1A, 0xFF, 0xA1, 0x2D, 0xFF, 0xD2, 0x2D, 0xFF, 0xD2, 0x2D,
+    0xFF, 0xD2, 0x2D, 0xFF, 0xD2, 0x1A, 0xFF, 0xA1, 0x04, 0xAA, 0x40, 0x00, 0x11, 0x00, 0x00, 0x11,
+    0x00, 0x04, 0xAA, 0x40, 0x1A, 0xFF, 0xA1, 0x2D, 0xFF, 0xD2, 0x2D, 0xFF, 0xD2, 0x2D, 0xFF, 0xD2,
+    0x2D, 0xFF, 0xD2, 0x2D, 0xFF, 0xD2, 0x2D, 0xFF, 0xD2, 0x1A, 0xFF, 0xA1, 0x04, 0xAA, 0x40, 0x00,
+    0x11, 0x00,
+    // } (0x7D)
+    0x01, 0x22, 0x21, 0x00, 0x00, 0x00, 0x00, 0x19, 0xDD, 0xDA, 0x51, 0x00, 0x00, 0x00, 0x19, 0xDE,
+    0xFF, 0xE9, 0x10, 0x00, 0x00, 0x01, 0x25, 0xBF, 0xFE, 0x50, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF,
+    0xA1, 0x00, 0x00, 0x00, 0x00, 0x2D, 0xFF, 0xD2, 0x00, 0x00, 0x00, 0x00, 0x2D, 0xFF, 0xD2, 0x00,
+    0x00, 0x00, 0x00, 0x1A, 0xFF, 0xE5, 0x00, 0x00, 0x00, 0x00, 0x04, 0xBF, 0xFB, 0x52, 0x10, 0x00,
+    0x00, 0x00, 0x5E, 0xFF, 0xED, 0x91, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xED, 0x91, 0x00, 0x00, 0x04,
+    0xBF, 0xFB, 0x52, 0x10, 0x00, 0x00, 0x1A, 0xFF, 0xE5, 0x00, 0x00, 0x00, 0x00, 0x2D, 0xFF, 0xD2,
+    0x00, 0x00, 0x00, 0x00, 0x2D, 0xFF, 0xD2, 0x00, 0x00, 0x00, 0x00, 0x2D, 0xFF, 0xD2, 0x00, 0x00,
+    0x00, 0x00, 0x2D, 0xFF, 0xD2, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xA1, 0x00, 0x00, 0x01, 0x25,
+    0xBF, 0xFE, 0x50, 0x00, 0x00, 0x19, 0xDE, 0xFF, 0xE9, 0x10, 0x00, 0x00, 0x19, 0xDD, 0xDA, 0x51,
+    0x00, 0x00, 0x00, 0x01, 0x22, 0x21, 0x00, 0x00, 0x00, 0x00,
+    // ~ (0x7E)
+    0x00, 0x01, 0x22, 0x10, 0x00, 0x01, 0x21, 0x00, 0x01, 0x5A, 0xDD, 0xA4, 0x00, 0x4A, 0xD9, 0x10,
+    0x4A, 0xEF, 0xEE, 0xFB, 0x55, 0xBF, 0xFA, 0x10, 0xAF, 0xFB, 0x55, 0xBF, 0xEE, 0xFE, 0xA4, 0x00,
+    0x9D, 0xA4, 0x00, 0x4A, 0xDD, 0xA5, 0x10, 0x00, 0x12, 0x10, 0x00, 0x01, 0x22, 0x10, 0x00, 0x00,
+    // Неизвестный символ
+    0x00, 0x12, 0x22, 0x22, 0x22, 0x21, 0x00, 0x04, 0xAD, 0xDD, 0xDD, 0xDD, 0xDA, 0x40, 0x1A, 0xFF,
+    0xED, 0xDD, 0xDE, 0xFF, 0xA1, 0x2D, 0xFB, 0x52, 0x22, 0x25, 0xBF, 0xD2, 0x2D, 0xE5, 0x00, 0x00,
+    0x00, 0x5E, 0xD2, 0x2D, 0xD2, 0x00, 0x00, 0x00, 0x2D, 0xD2, 0x2D, 0xD2, 0x00, 0x11, 0x00, 0x2D,
+    0xD2, 0x2D, 0xD2, 0x04, 0xAA, 0x40, 0x2D, 0xD2, 0x2D, 0xD2, 0x1A, 0xFF, 0xA1, 0x2D, 0xD2, 0x2D,
+    0xD2, 0x1A, 0xFF, 0xA1, 0x2D, 0xD2, 0x2D, 0xD2, 0x04, 0xAA, 0x40, 0x2D, 0xD2, 0x2D, 0xD2, 0x00,
+    0x11, 0x00, 0x2D, 0xD2, 0x2D, 0xD2, 0x00, 0x11, 0x00, 0x2D, 0xD2, 0x2D, 0xD2, 0x04, 0xAA, 0x40,
+    0x2D, 0xD2, 0x2D, 0xD2, 0x1A, 0xFF, 0xA1, 0x2D, 0xD2, 0x2D, 0xD2, 0x1A, 0xFF, 0xA1, 0x2D, 0xD2,
+    0x2D, 0xD2, 0x04, 0xAA, 0x40, 0x2D, 0xD2, 0x2D, 0xE5, 0x00, 0x11, 0x00, 0x5E, 0xD2, 0x2D, 0xFB,
+    0x52, 0x22, 0x25, 0xBF, 0xD2, 0x1A, 0xFF, 0xED, 0xDD, 0xDE, 0xFF, 0xA1, 0x04, 0xAD, 0xDD, 0xDD,
+    0xDD, 0xDA, 0x40, 0x00, 0x12, 0x22, 0x22, 0x22, 0x21, 0x00,
+};
+
+// Описания глифов: смещение, ширина, высота, x_offset, y_offset, advance
+static const PropGlyph font_aa16x32_glyphs[] = {
+    {    0,  0,  0, 0,  0,  8},  // Пробел (0x20)
+    {    0, 10, 22, 1,  3, 12},  // ! (0x21)
+    {  110, 14, 10, 1,  1, 16},  // " (0x22)
+    {  180, 15, 20, 1,  5, 17},  // # (0x23)
+    {  340, 15, 28, 1,  1, 17},  // $ (0x24)
+    {  564, 15, 18, 1,  7, 17},  // % (0x25)
+    {  708, 15, 22, 1,  3, 17},  // & (0x26)
+    {  884,  8, 10, 1,  1, 10},  // ' (0x27)
+    {  924, 10, 22, 1,  3, 12},  // ( (0x28)
+    { 1034, 10, 22, 1,  3, 12},  // ) (0x29)
+    { 1144, 16, 12, 1,  9, 18},  // * (0x2A)
+    { 1240, 14, 12, 1,  9, 16},  // + (0x2B)
+    { 1324,  8, 10, 1, 17, 10},  // , (0x2C)
+    { 1364, 15,  4, 1, 13, 17},  // - (0x2D)
+    { 1396,  6,  6, 1, 19,  8},  // . (0x2E)
+    { 1414, 15, 18, 1,  7, 17},  // / (0x2F)
+    { 1558, 15, 22, 1,  3, 17},  // 0 (0x30)
+    { 1734, 14, 22, 1,  3, 16},  // 1 (0x31)
+    { 1888, 15, 22, 1,  3, 17},  // 2 (0x32)
+    { 2064, 15, 22, 1,  3, 17},  // 3 (0x33)
+    { 2240, 15, 22, 1,  3, 17},  // 4 (0x34)
+    { 2416, 15, 22, 1,  3, 17},  // 5 (0x35)
+    { 2592, 15, 22, 1,  3, 17},  // 6 (0x36)
+    { 2768, 15, 22, 1,  3, 17},  // 7 (0x37)
+    { 2944, 15, 22, 1,  3, 17},  // 8 (0x38)
+    { 3120, 15, 22, 1,  3, 17},  // 9 (0x39)
+    { 3296,  6, 16, 1,  7,  8},  // : (0x3A)
+    { 3344,  8, 18, 1,  7, 10},  // ; (0x3B)
+    { 3416, 14, 20, 1,  5, 16},  // < (0x3C)
+    { 3556, 14, 10, 1,  9, 16},  // = (0x3D)
+    { 3626, 14, 20, 1,  5, 16},  // > (0x3E)
+    { 3766, 15, 22, 1,  3, 17},  // ? (0x3F)
+    { 3942, 15, 22, 1,  3, 17},  // @ (0x40)
+    { 4118, 15, 22, 1,  3, 17},  // A (0x41)
+    { 4294, 15, 22, 1,  3, 17},  // B (0x42)
+    { 4470, 15, 22, 1,  3, 17},  // C (0x43)
+    { 4646, 15, 22, 1,  3, 17},  // D (0x44)
+    { 4822, 15, 22, 1,  3, 17},  // E (0x45)
+    { 4998, 15, 22, 1,  3, 17},  // F (0x46)
+    { 5174, 15, 22, 1,  3, 17},  // G (0x47)
+    { 5350, 15, 22, 1,  3, 17},  // H (0x48)
+    { 5526, 10, 22, 1,  3, 12},  // I (0x49)
+    { 5636, 15, 22, 1,  3, 17},  // J (0x4A)
+    { 5812, 15, 22, 1,  3, 17},  // K (0x4B)
+    { 5988, 15, 22, 1,  3, 17},  // L (0x4C)
+    { 6164, 15, 22, 1,  3, 17},  // M (0x4D)
+    { 6340, 15, 22, 1,  3, 17},  // N (0x4E)
+    { 6516, 15, 22, 1,  3, 17},  // O (0x4F)
+    { 6692, 15, 22, 1,  3, 17},  // P (0x50)
+    { 6868, 15, 26, 1,  3, 17},  // Q (0x51)
+    { 7076, 15, 22, 1,  3, 17},  // R (0x52)
+    { 7252, 15, 22, 1,  3, 17},  // S (0x53)
+    { 7428, 14, 22, 1,  3, 16},  // T (0x54)
+    { 7582, 15, 22, 1,  3, 17},  // U (0x55)
+    { 7758, 15, 22, 1,  3, 17},  // V (0x56)
+    { 7934, 15, 22, 1,  3, 17},  // W (0x57)
+    { 8110, 15, 22, 1,  3, 17},  // X (0x58)
+    { 8286, 14, 22, 1,  3, 16},  // Y (0x59)
+    { 8440, 15, 22, 1,  3, 17},  // Z (0x5A)
+    { 8616, 10, 22, 1,  3, 12},  // [ (0x5B)
+    { 8726, 15, 18, 1,  5, 17},  // \ (0x5C)
+    { 8870, 10, 22, 1,  3, 12},  // ] (0x5D)
+    { 8980, 15,  9, 1,  0, 17},  // ^ (0x5E)
+    { 9052, 16,  4, 1, 25, 18},  // _ (0x5F)
+    { 9084, 10,  8, 1,  1, 12},  // ` (0x60)
+    { 9124, 15, 16, 1,  9, 17},  // a (0x61)
+    { 9252, 15, 22, 1,  3, 17},  // b (0x62)
+    { 9428, 15, 16, 1,  9, 17},  // c (0x63)
+    { 9556, 15, 22, 1,  3, 17},  // d (0x64)
+    { 9732, 15, 16, 1,  9, 17},  // e (0x65)
+    { 9860, 13, 22, 1,  3, 15},  // f (0x66)
+    {10014, 15, 18, 1,  9, 17},  // g (0x67)
+    {10158, 15, 22, 1,  3, 17},  // h (0x68)
+    {10334, 10, 22, 1,  3, 12},  // i (0x69)
+    {10444, 14, 24, 1,  3, 16},  // j (0x6A)
+    {10612, 15, 22, 1,  3, 17},  // k (0x6B)
+    {10788, 10, 22, 1,  3, 12},  // l (0x6C)
+    {10898, 15, 16, 1,  9, 17},  // m (0x6D)
+    {11026, 15, 16, 1,  9, 17},  // n (0x6E)
+    {11154, 15, 16, 1,  9, 17},  // o (0x6F)
+    {11282, 15, 18, 1,  9, 17},  // p (0x70)
+    {11426, 15, 18, 1,  9, 17},  // q (0x71)
+    {11570, 15, 16, 1,  9, 17},  // r (0x72)
+    {11698, 15, 16, 1,  9, 17},  // s (0x73)
+    {11826, 15, 22, 1,  3, 17},  // t (0x74)
+    {12002, 15, 16, 1,  9, 17},  // u (0x75)
+    {12130, 15, 16, 1,  9, 17},  // v (0x76)
+    {12258, 15, 16, 1,  9, 17},  // w (0x77)
+    {12386, 15, 16, 1,  9, 17},  // x (0x78)
+    {12514, 15, 18, 1,  9, 17},  // y (0x79)
+    {12658, 15, 16, 1,  9, 17},  // z (0x7A)
+    {12786, 14, 22, 1,  3, 16},  // { (0x7B)
+    {12940,  6, 22, 1,  3,  8},  // | (0x7C)
+    {13006, 14, 22, 1,  3, 16},  // } (0x7D)
+    {13160, 15,  6, 1,  3, 17},  // ~ (0x7E)
+    {13208, 14, 22, 1,  3, 16},  // Неизвестный символ
+};
+
+static const PropFontRange font_aa16x32_ranges[] = {
+    {0x0020, 95, 0},  // ASCII
+};
+
+const PropFont FontAA16x32 = {
+    font_aa16x32_bitmap,
+    font_aa16x32_glyphs,
+    font_aa16x32_ranges,
+    sizeof(font_aa16x32_ranges) / sizeof(font_aa16x32_ranges[0]),
+    95,   // Глиф для неизвестных символов
+    32,   // Высота строки
+    4     // Бит на пиксель
+};
\ No newline at end of file
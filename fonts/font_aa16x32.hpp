@@ -0,0 +1,9 @@
+#ifndef FONT_AA16X32_HPP
+#define FONT_AA16X32_HPP
+
+#include "prop_font.hpp"
+
+// Сглаженный шрифт 16x32 (4 бита на пиксель, ASCII)
+extern const PropFont FontAA16x32;
+
+#endif
@@ -0,0 +1,515 @@
+#include "font_prop8x16.hpp"
+
+// Пропорциональный вариант font8x16: пустые строки и столбцы обрезаны,
+// каждая строка глифа хранится одним байтом, выровненным по старшему биту
+static const uint8_t font_prop8x16_bitmap[] = {
+    // ! (0x21)
+    0x60, 0xF0, 0xF0, 0xF0, 0x60, 0x60, 0x60, 0x00, 0x60, 0x60,
+    // " (0x22)
+    0xCC, 0xCC, 0xCC, 0x48,
+    // # (0x23)
+    0x6C, 0x6C, 0xFE, 0x6C, 0x6C, 0x6C, 0xFE, 0x6C, 0x6C,
+    // $ (0x24)
+    0x10, 0x10, 0x7C, 0xD6, 0xD0, 0xD0, 0x7C, 0x16, 0x16, 0xD6, 0x7C, 0x10, 0x10,
+    // % (0x25)
+    0xC2, 0xC6, 0x0C, 0x18, 0x30, 0x60, 0xC6, 0x86,
+    // & (0x26)
+    0x38, 0x6C, 0x6C, 0x38, 0x76, 0xDC, 0xCC, 0xCC, 0xCC, 0x76,
+    // ' (0x27)
+    0x60, 0x60, 0x60, 0xC0,
+    // ( (0x28)
+    0x30, 0x60, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0x60, 0x30,
+    // ) (0x29)
+    0xC0, 0x60, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x60, 0xC0,
+    // * (0x2A)
+    0x66, 0x3C, 0xFF, 0x3C, 0x66,
+    // + (0x2B)
+    0x30, 0x30, 0xFC, 0x30, 0x30,
+    // , (0x2C)
+    0x60, 0x60, 0x60, 0xC0,
+    // - (0x2D)
+    0xFE,
+    // . (0x2E)
+    0xC0, 0xC0,
+    // / (0x2F)
+    0x02, 0x06, 0x0C, 0x18, 0x30, 0x60, 0xC0, 0x80,
+    // 0 (0x30)
+    0x7C, 0xC6, 0xC6, 0xCE, 0xDE, 0xF6, 0xE6, 0xC6, 0xC6, 0x7C,
+    // 1 (0x31)
+    0x30, 0x70, 0xF0, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0xFC,
+    // 2 (0x32)
+    0x7C, 0xC6, 0x06, 0x0C, 0x18, 0x30, 0x60, 0xC0, 0xC6, 0xFE,
+    // 3 (0x33)
+    0x7C, 0xC6, 0x06, 0x06, 0x3C, 0x06, 0x06, 0x06, 0xC6, 0x7C,
+    // 4 (0x34)
+    0x0C, 0x1C, 0x3C, 0x6C, 0xCC, 0xFE, 0x0C, 0x0C, 0x0C, 0x1E,
+    // 5 (0x35)
+    0xFE, 0xC0, 0xC0, 0xC0, 0xFC, 0x06, 0x06, 0x06, 0xC6, 0x7C,
+    // 6 (0x36)
+    0x38, 0x60, 0xC0, 0xC0, 0xFC, 0xC6, 0xC6, 0xC6, 0xC6, 0x7C,
+    // 7 (0x37)
+    0xFE, 0xC6, 0x06, 0x06, 0x0C, 0x18, 0x30, 0x30, 0x30, 0x30,
+    // 8 (0x38)
+    0x7C, 0xC6, 0xC6, 0xC6, 0x7C, 0xC6, 0xC6, 0xC6, 0xC6, 0x7C,
+    // 9 (0x39)
+    0x7C, 0xC6, 0xC6, 0xC6, 0x7E, 0x06, 0x06, 0x06, 0x0C, 0x78,
+    // : (0x3A)
+    0xC0, 0xC0, 0x00, 0x00, 0x00, 0xC0, 0xC0,
+    // ; (0x3B)
+    0x60, 0x60, 0x00, 0x00, 0x00, 0x60, 0x60, 0xC0,
+    // < (0x3C)
+    0x0C, 0x18, 0x30, 0x60, 0xC0, 0x60, 0x30, 0x18, 0x0C,
+    // = (0x3D)
+    0xFC, 0x00, 0x00, 0xFC,
+    // > (0x3E)
+    0xC0, 0x60, 0x30, 0x18, 0x0C, 0x18, 0x30, 0x60, 0xC0,
+    // ? (0x3F)
+    0x7C, 0xC6, 0xC6, 0x0C, 0x18, 0x18, 0x18, 0x00, 0x18, 0x18,
+    // @ (0x40)
+    0x7C, 0xC6, 0xC6, 0xDE, 0xDE, 0xDE, 0xDC, 0xC0, 0xC0, 0x7C,
+    // A (0x41)
+    0x10, 0x38, 0x6C, 0xC6, 0xC6, 0xFE, 0xC6, 0xC6, 0xC6, 0xC6,
+    // B (0x42)
+    0xFC, 0x66, 0x66, 0x66, 0x7C, 0x66, 0x66, 0x66, 0x66, 0xFC,
+    // C (0x43)
+    0x3C, 0x66, 0xC2, 0xC0, 0xC0, 0xC0, 0xC0, 0xC2, 0x66, 0x3C,
+    // D (0x44)
+    0xF8, 0x6C, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x6C, 0xF8,
+    // E (0x45)
+    0xFE, 0x66, 0x62, 0x68, 0x78, 0x68, 0x60, 0x62, 0x66, 0xFE,
+    // F (0x46)
+    0xFE, 0x66, 0x62, 0x68, 0x78, 0x68, 0x60, 0x60, 0x60, 0xF0,
+    // G (0x47)
+    0x3C, 0x66, 0xC2, 0xC0, 0xC0, 0xDE, 0xC6, 0xC6, 0x66, 0x3A,
+    // H (0x48)
+    0xC6, 0xC6, 0xC6, 0xC6, 0xFE, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6,
+    // I (0x49)
+    0xF0, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0xF0,
+    // J (0x4A)
+    0x1E, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0xCC, 0xCC, 0xCC, 0x78,
+    // K (0x4B)
+    0xE6, 0x66, 0x6C, 0x78, 0x70, 0x78, 0x6C, 0x66, 0x66, 0xE6,
+    // L (0x4C)
+    0xF0, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x62, 0x66, 0xFE,
+    // M (0x4D)
+    0xC6, 0xEE, 0xFE, 0xFE, 0xD6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6,
+    // N (0x4E)
+    0xC6, 0xE6, 0xF6, 0xFE, 0xDE, 0xCE, 0xC6, 0xC6, 0xC6, 0xC6,
+    // O (0x4F)
+    0x7C, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0x7C,
+    // P (0x50)
+    0xFC, 0x66, 0x66, 0x66, 0x7C, 0x60, 0x60, 0x60, 0x60, 0xF0,
+    // Q (0x51)
+    0x7C, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xD6, 0xDE, 0x7C, 0x0C, 0x0E,
+    // R (0x52)
+    0xFC, 0x66, 0x66, 0x66, 0x7C, 0x6C, 0x66, 0x66, 0x66, 0xE6,
+    // S (0x53)
+    0x7C, 0xC6, 0xC6, 0x60, 0x38, 0x0C, 0x06, 0xC6, 0xC6, 0x7C,
+    // T (0x54)
+    0xFC, 0xFC, 0xB4, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x78,
+    // U (0x55)
+    0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0x7C,
+    // V (0x56)
+    0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0x6C, 0x38, 0x10,
+    // W (0x57)
+    0xC6, 0xC6, 0xC6, 0xC6, 0xD6, 0xD6, 0xD6, 0xFE, 0xEE, 0x6C,
+    // X (0x58)
+    0xC6, 0xC6, 0x6C, 0x7C, 0x38, 0x38, 0x7C, 0x6C, 0xC6, 0xC6,
+    // Y (0x59)
+    0xCC, 0xCC, 0xCC, 0xCC, 0x78, 0x30, 0x30, 0x30, 0x30, 0x78,
+    // Z (0x5A)
+    0xFE, 0xC6, 0x86, 0x0C, 0x18, 0x30, 0x60, 0xC2, 0xC6, 0xFE,
+    // [ (0x5B)
+    0xF0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xF0,
+    // \ (0x5C)
+    0x80, 0xC0, 0x60, 0x30, 0x18, 0x0C, 0x06, 0x02,
+    // ] (0x5D)
+    0xF0, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0xF0,
+    // ^ (0x5E)
+    0x10, 0x38, 0x6C, 0xC6,
+    // _ (0x5F)
+    0xFF,
+    // ` (0x60)
+    0xC0, 0x60, 0x30,
+    // a (0x61)
+    0x78, 0x0C, 0x7C, 0xCC, 0xCC, 0xCC, 0x76,
+    // b (0x62)
+    0xE0, 0x60, 0x60, 0x78, 0x6C, 0x66, 0x66, 0x66, 0x66, 0x7C,
+    // c (0x63)
+    0x7C, 0xC6, 0xC0, 0xC0, 0xC0, 0xC6, 0x7C,
+    // d (0x64)
+    0x1C, 0x0C, 0x0C, 0x3C, 0x6C, 0xCC, 0xCC, 0xCC, 0xCC, 0x76,
+    // e (0x65)
+    0x7C, 0xC6, 0xFE, 0xC0, 0xC0, 0xC6, 0x7C,
+    // f (0x66)
+    0x38, 0x6C, 0x64, 0x60, 0xF0, 0x60, 0x60, 0x60, 0x60, 0xF0,
+    // g (0x67)
+    0x76, 0xCC, 0xCC, 0xCC, 0x7C, 0x0C, 0xCC, 0x78,
+    // h (0x68)
+    0xE0, 0x60, 0x60, 0x6C, 0x76, 0x66, 0x66, 0x66, 0x66, 0xE6,
+    // i (0x69)
+    0x60, 0x60, 0x00, 0xE0, 0x60, 0x60, 0x60, 0x60, 0x60, 0xF0,
+    // j (0x6A)
+    0x0C, 0x0C, 0x00, 0x1C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0xCC, 0x78,
+    // k (0x6B)
+    0xE0, 0x60, 0x60, 0x66, 0x6C, 0x78, 0x6C, 0x66, 0x66, 0xE6,
+    // l (0x6C)
+    0xE0, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0xF0,
+    // m (0x6D)
+    0xEC, 0xFE, 0xD6, 0xD6, 0xD6, 0xD6, 0xC6,
+    // n (0x6E)
+    0xDC, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
+    // o (0x6F)
+    0x7C, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0x7C,
+    // p (0x70)
+    0xDC, 0x66, 0x66, 0x66, 0x66, 0x7C, 0x60, 0xF0,
+    // q (0x71)
+    0x76, 0xCC, 0xCC, 0xCC, 0xCC, 0x7C, 0x0C, 0x1E,
+    // r (0x72)
+    0xDC, 0x76, 0x66, 0x60, 0x60, 0x60, 0xF0,
+    // s (0x73)
+    0x7C, 0xC6, 0x70, 0x1C, 0xC6, 0xC6, 0x7C,
+    // t (0x74)
+    0x10, 0x30, 0x30, 0xFC, 0x30, 0x30, 0x30, 0x30, 0x36, 0x1C,
+    // u (0x75)
+    0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0x76,
+    // v (0x76)
+    0xC6, 0xC6, 0xC6, 0xC6, 0x6C, 0x38, 0x10,
+    // w (0x77)
+    0xC6, 0xC6, 0xD6, 0xD6, 0xD6, 0xFE, 0x6C,
+    // x (0x78)
+    0xC6, 0x6C, 0x38, 0x38, 0x6C, 0xC6, 0xC6,
+    // y (0x79)
+    0xC6, 0xC6, 0xC6, 0xC6, 0x7E, 0x06, 0x0C, 0xF8,
+    // z (0x7A)
+    0xFE, 0xCC, 0x18, 0x30, 0x66, 0xC6, 0xFE,
+    // { (0x7B)
+    0x1C, 0x30, 0x30, 0x30, 0xE0, 0x30, 0x30, 0x30, 0x30, 0x1C,
+    // | (0x7C)
+    0xC0, 0xC0, 0xC0, 0xC0, 0x00, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0,
+    // } (0x7D)
+    0xE0, 0x30, 0x30, 0x30, 0x1C, 0x30, 0x30, 0x30, 0x30, 0xE0,
+    // ~ (0x7E)
+    0x76, 0xDC,
+    // DEL (0x7F)
+    0x10, 0x38, 0x6C, 0xC6, 0xC6, 0xC6, 0xFE,
+    // А (0x0410)
+    0x10, 0x38, 0x6C, 0xC6, 0xC6, 0xFE, 0xC6, 0xC6, 0xC6, 0xC6,
+    // Б (0x0411)
+    0xFE, 0x62, 0x60, 0x60, 0x7C, 0x66, 0x66, 0x66, 0x66, 0xFC,
+    // В (0x0412)
+    0xFC, 0x66, 0x66, 0x66, 0x7C, 0x66, 0x66, 0x66, 0x66, 0xFC,
+    // Г (0x0413)
+    0xFE, 0x66, 0x62, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0xF0,
+    // Д (0x0414)
+    0x1E, 0x36, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0xFF, 0xC3,
+    // Е (0x0415)
+    0xFE, 0x66, 0x62, 0x68, 0x78, 0x68, 0x60, 0x62, 0x66, 0xFE,
+    // Ж (0x0416)
+    0xC6, 0xD6, 0xD6, 0x6C, 0x38, 0x38, 0x6C, 0xD6, 0xD6, 0xC6,
+    // З (0x0417)
+    0x7C, 0xC6, 0x06, 0x06, 0x3C, 0x06, 0x06, 0x06, 0xC6, 0x7C,
+    // И (0x0418)
+    0xC6, 0xC6, 0xCE, 0xDE, 0xF6, 0xE6, 0xC6, 0xC6, 0xC6, 0xC6,
+    // Й (0x0419)
+    0x6C, 0xC6, 0xC6, 0xCE, 0xDE, 0xF6, 0xE6, 0xC6, 0xC6, 0xC6, 0xC6,
+    // К (0x041A)
+    0xE6, 0x66, 0x6C, 0x78, 0x70, 0x78, 0x6C, 0x66, 0x66, 0xE6,
+    // Л (0x041B)
+    0x1E, 0x36, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0xC6,
+    // М (0x041C)
+    0xC6, 0xEE, 0xFE, 0xFE, 0xD6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6,
+    // Н (0x041D)
+    0xC6, 0xC6, 0xC6, 0xC6, 0xFE, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6,
+    // О (0x041E)
+    0x7C, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0x7C,
+    // П (0x041F)
+    0xFE, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6,
+    // Р (0x0420)
+    0xFC, 0x66, 0x66, 0x66, 0x7C, 0x60, 0x60, 0x60, 0x60, 0xF0,
+    // С (0x0421)
+    0x7C, 0xC6, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC6, 0x7C,
+    // Т (0x0422)
+    0xFC, 0xFC, 0xB4, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x78,
+    // У (0x0423)
+    0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0x7E, 0x06, 0x0C, 0x18, 0xF0,
+    // Ф (0x0424)
+    0x18, 0x18, 0x7E, 0xDB, 0xDB, 0xDB, 0xDB, 0x7E, 0x18, 0x18,
+    // Х (0x0425)
+    0xC6, 0xC6, 0x6C, 0x6C, 0x38, 0x38, 0x6C, 0x6C, 0xC6, 0xC6,
+    // Ц (0x0426)
+    0xE6, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x7E, 0x06,
+    // Ч (0x0427)
+    0xC6, 0xC6, 0xC6, 0xC6, 0x7E, 0x06, 0x06, 0x06, 0x06, 0x06,
+    // Ш (0x0428)
+    0xD6, 0xD6, 0xD6, 0xD6, 0xD6, 0xD6, 0xD6, 0xD6, 0xD6, 0xFE,
+    // Щ (0x0429)
+    0xD6, 0xD6, 0xD6, 0xD6, 0xD6, 0xD6, 0xD6, 0xD6, 0xFE, 0x02,
+    // Ъ (0x042A)
+    0xF0, 0x60, 0x60, 0x60, 0x7C, 0x66, 0x66, 0x66, 0x66, 0x7C,
+    // Ы (0x042B)
+    0xC6, 0xC6, 0xC6, 0xC6, 0xF6, 0xDE, 0xDE, 0xDE, 0xDE, 0xF6,
+    // Ь (0x042C)
+    0xC0, 0xC0, 0xC0, 0xC0, 0xFC, 0xC6, 0xC6, 0xC6, 0xC6, 0xFC,
+    // Э (0x042D)
+    0x7C, 0xC6, 0x06, 0x06, 0x3E, 0x06, 0x06, 0x06, 0xC6, 0x7C,
+    // Ю (0x042E)
+    0xCC, 0xD6, 0xD6, 0xD6, 0xF6, 0xD6, 0xD6, 0xD6, 0xD6, 0xCC,
+    // Я (0x042F)
+    0x7E, 0xC6, 0xC6, 0xC6, 0x7E, 0x36, 0x66, 0xC6, 0xC6, 0xC6,
+    // а (0x0430)
+    0x7C, 0x06, 0x7E, 0xC6, 0xC6, 0xC6, 0x7E,
+    // б (0x0431)
+    0xFC, 0xC0, 0xC0, 0xF8, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xF8,
+    // в (0x0432)
+    0xF8, 0xCC, 0xCC, 0xF8, 0xCC, 0xCC, 0xF8,
+    // г (0x0433)
+    0xFC, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0,
+    // д (0x0434)
+    0x3E, 0x66, 0x66, 0x66, 0x66, 0x7F, 0xC3,
+    // е (0x0435)
+    0x7C, 0xC6, 0xFE, 0xC0, 0xC0, 0xC6, 0x7C,
+    // ж (0x0436)
+    0xC6, 0xD6, 0x6C, 0x38, 0x6C, 0xD6, 0xC6,
+    // з (0x0437)
+    0xF8, 0x0C, 0x0C, 0x78, 0x0C, 0x0C, 0xF8,
+    // и (0x0438)
+    0xC6, 0xCE, 0xDE, 0xF6, 0xE6, 0xC6, 0xC6,
+    // й (0x0439)
+    0x6C, 0x00, 0x00, 0xC6, 0xCE, 0xDE, 0xF6, 0xE6, 0xC6, 0xC6,
+    // к (0x043A)
+    0xCC, 0xD8, 0xF0, 0xF0, 0xD8, 0xCC, 0xC6,
+    // л (0x043B)
+    0x3E, 0x66, 0x66, 0x66, 0x66, 0x66, 0xC6,
+    // м (0x043C)
+    0xC6, 0xEE, 0xFE, 0xD6, 0xC6, 0xC6, 0xC6,
+    // н (0x043D)
+    0xC6, 0xC6, 0xFE, 0xC6, 0xC6, 0xC6, 0xC6,
+    // о (0x043E)
+    0x7C, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0x7C,
+    // п (0x043F)
+    0xFE, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6,
+    // р (0x0440)
+    0xFC, 0xC6, 0xC6, 0xC6, 0xFC, 0xC0, 0xC0, 0xC0,
+    // с (0x0441)
+    0x7C, 0xC6, 0xC0, 0xC0, 0xC0, 0xC6, 0x7C,
+    // т (0x0442)
+    0xFC, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30,
+    // у (0x0443)
+    0xC6, 0xC6, 0xC6, 0xC6, 0x7E, 0x06, 0x0C, 0x78,
+    // ф (0x0444)
+    0x18, 0x18, 0x7E, 0xDB, 0xDB, 0xDB, 0x7E, 0x18, 0x18,
+    // х (0x0445)
+    0xC6, 0x6C, 0x38, 0x38, 0x6C, 0xC6, 0xC6,
+    // ц (0x0446)
+    0xE6, 0x66, 0x66, 0x66, 0x66, 0x7E, 0x06,
+    // ч (0x0447)
+    0xC6, 0xC6, 0xC6, 0x7E, 0x06, 0x06, 0x06,
+    // ш (0x0448)
+    0xD6, 0xD6, 0xD6, 0xD6, 0xD6, 0xD6, 0xFE,
+    // щ (0x0449)
+    0xD6, 0xD6, 0xD6, 0xD6, 0xD6, 0xFE, 0x02,
+    // ъ (0x044A)
+    0xF0, 0x60, 0x7C, 0x66, 0x66, 0x66, 0x7C,
+    // ы (0x044B)
+    0xC6, 0xC6, 0xF6, 0xDE, 0xDE, 0xDE, 0xF6,
+    // ь (0x044C)
+    0xC0, 0xC0, 0xFC, 0xC6, 0xC6, 0xC6, 0xFC,
+    // э (0x044D)
+    0xF8, 0x0C, 0x0C, 0x7C, 0x0C, 0x0C, 0xF8,
+    // ю (0x044E)
+    0xCC, 0xD6, 0xD6, 0xF6, 0xD6, 0xD6, 0xCC,
+    // я (0x044F)
+    0x7E, 0xC6, 0xC6, 0x7E, 0x36, 0x66, 0xC6,
+    // Ё (0x0401)
+    0x66, 0x00, 0xFE, 0x66, 0x62, 0x68, 0x78, 0x68, 0x60, 0x62, 0x66, 0xFE,
+    // ё (0x0451)
+    0x66, 0x00, 0x00, 0x7C, 0xC6, 0xFE, 0xC0, 0xC0, 0xC6, 0x7C,
+    // Неизвестный символ
+    0xFC, 0x84, 0x84, 0xB4, 0xB4, 0x84, 0xB4, 0xB4, 0x84, 0xFC,
+};
+
+// Описания глифов: смещение, ширина, высота, x_offset, y_offset, advance
+static const PropGlyph font_prop8x16_glyphs[] = {
+    {   0, 0,  0, 0,  0, 4},  // Пробел (0x20)
+    {   0, 4, 10, 0,  2, 5},  // ! (0x21)
+    {  10, 6,  4, 0,  1, 7},  // " (0x22)
+    {  14, 7,  9, 0,  3, 8},  // # (0x23)
+    {  23, 7, 13, 0,  1, 8},  // $ (0x24)
+    {  36, 7,  8, 0,  4, 8},  // % (0x25)
+    {  44, 7, 10, 0,  2, 8},  // & (0x26)
+    {  54, 3,  4, 0,  1, 4},  // ' (0x27)
+    {  58, 4, 10, 0,  2, 5},  // ( (0x28)
+    {  68, 4, 10, 0,  2, 5},  // ) (0x29)
+    {  78, 8,  5, 0,  5, 9},  // * (0x2A)
+    {  83, 6,  5, 0,  5, 7},  // + (0x2B)
+    {  88, 3,  4, 0,  9, 4},  // , (0x2C)
+    {  92, 7,  1, 0,  7, 8},  // - (0x2D)
+    {  93, 2,  2, 0, 10, 3},  // . (0x2E)
+    {  95, 7,  8, 0,  4, 8},  // / (0x2F)
+    { 103, 7, 10, 0,  2, 8},  // 0 (0x30)
+    { 113, 6, 10, 0,  2, 7},  // 1 (0x31)
+    { 123, 7, 10, 0,  2, 8},  // 2 (0x32)
+    { 133, 7, 10, 0,  2, 8},  // 3 (0x33)
+    { 143, 7, 10, 0,  2, 8},  // 4 (0x34)
+    { 153, 7, 10, 0,  2, 8},  // 5 (0x35)
+    { 163, 7, 10, 0,  2, 8},  // 6 (0x36)
+    { 173, 7, 10, 0,  2, 8},  // 7 (0x37)
+    { 183, 7, 10, 0,  2, 8},  // 8 (0x38)
+    { 193, 7, 10, 0,  2, 8},  // 9 (0x39)
+    { 203, 2,  7, 0,  4, 3},  // : (0x3A)
+    { 210, 3,  8, 0,  4, 4},  // ; (0x3B)
+    { 218, 6,  9, 0,  3, 7},  // < (0x3C)
+    { 227, 6,  4, 0,  5, 7},  // = (0x3D)
+    { 231, 6,  9, 0,  3, 7},  // > (0x3E)
+    { 240, 7, 10, 0,  2, 8},  // ? (0x3F)
+    { 250, 7, 10, 0,  2, 8},  // @ (0x40)
+    { 260, 7, 10, 0,  2, 8},  // A (0x41)
+    { 270, 7, 10, 0,  2, 8},  // B (0x42)
+    { 280, 7, 10, 0,  2, 8},  // C (0x43)
+    { 290, 7, 10, 0,  2, 8},  // D (0x44)
+    { 300, 7, 10, 0,  2, 8},  // E (0x45)
+    { 310, 7, 10, 0,  2, 8},  // F (0x46)
+    { 320, 7, 10, 0,  2, 8},  // G (0x47)
+    { 330, 7, 10, 0,  2, 8},  // H (0x48)
+    { 340, 4, 10, 0,  2, 5},  // I (0x49)
+    { 350, 7, 10, 0,  2, 8},  // J (0x4A)
+    { 360, 7, 10, 0,  2, 8},  // K (0x4B)
+    { 370, 7, 10, 0,  2, 8},  // L (0x4C)
+    { 380, 7, 10, 0,  2, 8},  // M (0x4D)
+    { 390, 7, 10, 0,  2, 8},  // N (0x4E)
+    { 400, 7, 10, 0,  2, 8},  // O (0x4F)
+    { 410, 7, 10, 0,  2, 8},  // P (0x50)
+    { 420, 7, 12, 0,  2, 8},  // Q (0x51)
+    { 432, 7, 10, 0,  2, 8},  // R (0x52)
+    { 442, 7, 10, 0,  2, 8},  // S (0x53)
+    { 452, 6, 10, 0,  2, 7},  // T (0x54)
+    { 462, 7, 10, 0,  2, 8},  // U (0x55)
+    { 472, 7, 10, 0,  2, 8},  // V (0x56)
+    { 482, 7, 10, 0,  2, 8},  // W (0x57)
+    { 492, 7, 10, 0,  2, 8},  // X (0x58)
+    { 502, 6, 10, 0,  2, 7},  // Y (0x59)
+    { 512, 7, 10, 0,  2, 8},  // Z (0x5A)
+    { 522, 4, 10, 0,  2, 5},  // [ (0x5B)
+    { 532, 7,  8, 0,  3, 8},  // \ (0x5C)
+    { 540, 4, 10, 0,  2, 5},  // ] (0x5D)
+    { 550, 7,  4, 0,  0, 8},  // ^ (0x5E)
+    { 554, 8,  1, 0, 13, 9},  // _ (0x5F)
+    { 555, 4,  3, 0,  1, 5},  // ` (0x60)
+    { 558, 7,  7, 0,  5, 8},  // a (0x61)
+    { 565, 7, 10, 0,  2, 8},  // b (0x62)
+    { 575, 7,  7, 0,  5, 8},  // c (0x63)
+    { 582, 7, 10, 0,  2, 8},  // d (0x64)
+    { 592, 7,  7, 0,  5, 8},  // e (0x65)
+    { 599, 6, 10, 0,  2, 7},  // f (0x66)
+    { 609, 7,  8, 0,  5, 8},  // g (0x67)
+    { 617, 7, 10, 0,  2, 8},  // h (0x68)
+    { 627, 4, 10, 0,  2, 5},  // i (0x69)
+    { 637, 6, 11, 0,  2, 7},  // j (0x6A)
+    { 648, 7, 10, 0,  2, 8},  // k (0x6B)
+    { 658, 4, 10, 0,  2, 5},  // l (0x6C)
+    { 668, 7,  7, 0,  5, 8},  // m (0x6D)
+    { 675, 7,  7, 0,  5, 8},  // n (0x6E)
+    { 682, 7,  7, 0,  5, 8},  // o (0x6F)
+    { 689, 7,  8, 0,  5, 8},  // p (0x70)
+    { 697, 7,  8, 0,  5, 8},  // q (0x71)
+    { 705, 7,  7, 0,  5, 8},  // r (0x72)
+    { 712, 7,  7, 0,  5, 8},  // s (0x73)
+    { 719, 7, 10, 0,  2, 8},  // t (0x74)
+    { 729, 7,  7, 0,  5, 8},  // u (0x75)
+    { 736, 7,  7, 0,  5, 8},  // v (0x76)
+    { 743, 7,  7, 0,  5, 8},  // w (0x77)
+    { 750, 7,  7, 0,  5, 8},  // x (0x78)
+    { 757, 7,  8, 0,  5, 8},  // y (0x79)
+    { 765, 7,  7, 0,  5, 8},  // z (0x7A)
+    { 772, 6, 10, 0,  2, 7},  // { (0x7B)
+    { 782, 2, 10, 0,  2, 3},  // | (0x7C)
+    { 792, 6, 10, 0,  2, 7},  // } (0x7D)
+    { 802, 7,  2, 0,  2, 8},  // ~ (0x7E)
+    { 804, 7,  7, 0,  4, 8},  // DEL (0x7F)
+    { 811, 7, 10, 0,  2, 8},  // А (0x0410)
+    { 821, 7, 10, 0,  2, 8},  // Б (0x0411)
+    { 831, 7, 10, 0,  2, 8},  // В (0x0412)
+    { 841, 7, 10, 0,  2, 8},  // Г (0x0413)
+    { 851, 8, 10, 0,  2, 9},  // Д (0x0414)
+    { 861, 7, 10, 0,  2, 8},  // Е (0x0415)
+    { 871, 7, 10, 0,  2, 8},  // Ж (0x0416)
+    { 881, 7, 10, 0,  2, 8},  // З (0x0417)
+    { 891, 7, 10, 0,  2, 8},  // И (0x0418)
+    { 901, 7, 11, 0,  1, 8},  // Й (0x0419)
+    { 912, 7, 10, 0,  2, 8},  // К (0x041A)
+    { 922, 7, 10, 0,  2, 8},  // Л (0x041B)
+    { 932, 7, 10, 0,  2, 8},  // М (0x041C)
+    { 942, 7, 10, 0,  2, 8},  // Н (0x041D)
+    { 952, 7, 10, 0,  2, 8},  // О (0x041E)
+    { 962, 7, 10, 0,  2, 8},  // П (0x041F)
+    { 972, 7, 10, 0,  2, 8},  // Р (0x0420)
+    { 982, 7, 10, 0,  2, 8},  // С (0x0421)
+    { 992, 6, 10, 0,  2, 7},  // Т (0x0422)
+    {1002, 7, 10, 0,  2, 8},  // У (0x0423)
+    {1012, 8, 10, 0,  2, 9},  // Ф (0x0424)
+    {1022, 7, 10, 0,  2, 8},  // Х (0x0425)
+    {1032, 7, 10, 0,  2, 8},  // Ц (0x0426)
+    {1042, 7, 10, 0,  2, 8},  // Ч (0x0427)
+    {1052, 7, 10, 0,  2, 8},  // Ш (0x0428)
+    {1062, 7, 10, 0,  2, 8},  // Щ (0x0429)
+    {1072, 7, 10, 0,  2, 8},  // Ъ (0x042A)
+    {1082, 7, 10, 0,  2, 8},  // Ы (0x042B)
+    {1092, 7, 10, 0,  2, 8},  // Ь (0x042C)
+    {1102, 7, 10, 0,  2, 8},  // Э (0x042D)
+    {1112, 7, 10, 0,  2, 8},  // Ю (0x042E)
+    {1122, 7, 10, 0,  2, 8},  // Я (0x042F)
+    {1132, 7,  7, 0,  5, 8},  // а (0x0430)
+    {1139, 6, 10, 0,  2, 7},  // б (0x0431)
+    {1149, 6,  7, 0,  5, 7},  // в (0x0432)
+    {1156, 6,  7, 0,  5, 7},  // г (0x0433)
+    {1163, 8,  7, 0,  5, 9},  // д (0x0434)
+    {1170, 7,  7, 0,  5, 8},  // е (0x0435)
+    {1177, 7,  7, 0,  5, 8},  // ж (0x0436)
+    {1184, 6,  7, 0,  5, 7},  // з (0x0437)
+    {1191, 7,  7, 0,  5, 8},  // и (0x0438)
+    {1198, 7, 10, 0,  2, 8},  // й (0x0439)
+    {1208, 7,  7, 0,  5, 8},  // к (0x043A)
+    {1215, 7,  7, 0,  5, 8},  // л (0x043B)
+    {1222, 7,  7, 0,  5, 8},  // м (0x043C)
+    {1229, 7,  7, 0,  5, 8},  // н (0x043D)
+    {1236, 7,  7, 0,  5, 8},  // о (0x043E)
+    {1243, 7,  7, 0,  5, 8},  // п (0x043F)
+    {1250, 7,  8, 0,  5, 8},  // р (0x0440)
+    {1258, 7,  7, 0,  5, 8},  // с (0x0441)
+    {1265, 6,  7, 0,  5, 7},  // т (0x0442)
+    {1272, 7,  8, 0,  5, 8},  // у (0x0443)
+    {1280, 8,  9, 0,  3, 9},  // ф (0x0444)
+    {1289, 7,  7, 0,  5, 8},  // х (0x0445)
+    {1296, 7,  7, 0,  5, 8},  // ц (0x0446)
+    {1303, 7,  7, 0,  5, 8},  // ч (0x0447)
+    {1310, 7,  7, 0,  5, 8},  // ш (0x0448)
+    {1317, 7,  7, 0,  5, 8},  // щ (0x0449)
+    {1324, 7,  7, 0,  5, 8},  // ъ (0x044A)
+    {1331, 7,  7, 0,  5, 8},  // ы (0x044B)
+    {1338, 7,  7, 0,  5, 8},  // ь (0x044C)
+    {1345, 6,  7, 0,  5, 7},  // э (0x044D)
+    {1352, 7,  7, 0,  5, 8},  // ю (0x044E)
+    {1359, 7,  7, 0,  5, 8},  // я (0x044F)
+    {1366, 7, 12, 0,  1, 8},  // Ё (0x0401)
+    {1378, 7, 10, 0,  1, 8},  // ё (0x0451)
+    {1388, 6, 10, 0,  2, 7},  // Неизвестный символ
+};
+
+// Диапазоны Unicode, отсортированные по возрастанию
+static const PropFontRange font_prop8x16_ranges[] = {
+    {0x0020, 96,   0},  // ASCII
+    {0x0401,  1, 160},  // Ё
+    {0x0410, 64,  96},  // Кириллица А-я
+    {0x0451,  1, 161},  // ё
+};
+
+const PropFont FontProp8x16 = {
+    font_prop8x16_bitmap,
+    font_prop8x16_glyphs,
+    font_prop8x16_ranges,
+    sizeof(font_prop8x16_ranges) / sizeof(font_prop8x16_ranges[0]),
+    162,  // Глиф для неизвестных символов
+    16,   // Высота строки
+    1     // Бит на пиксель
+};
\ No newline at end of file
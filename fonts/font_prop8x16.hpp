@@ -0,0 +1,9 @@
+#ifndef FONT_PROP8X16_HPP
+#define FONT_PROP8X16_HPP
+
+#include "prop_font.hpp"
+
+// Пропорциональная версия шрифта 8x16 (ASCII + кириллица)
+extern const PropFont FontProp8x16;
+
+#endif
@@ -0,0 +1,110 @@
+#include "number_format.hpp"
+#include <cstring>
+
+namespace {
+
+const uint32_t POWERS_OF_10[] = {1, 10, 100, 1000, 10000, 100000, 1000000};
+
+// Размещение готовых символов в поле заданной ширины
+uint8_t applyWidth(char* out, const char* digits, uint8_t length, bool negative,
+                   uint8_t width, NumberAlign align) {
+    uint8_t total = length + (negative ? 1 : 0);
+    
+    if (width == 0) {
+        uint8_t pos = 0;
+        if (negative) out[pos++] = '-';
+        memcpy(out + pos, digits, length);
+        return total;
+    }
+    
+    if (width > NUMBER_FORMAT_MAX_CHARS) width = NUMBER_FORMAT_MAX_CHARS;
+    
+    if (total > width) {
+        memset(out, '#', width);
+        return width;
+    }
+    
+    uint8_t padding = width - total;
+    uint8_t pos = 0;
+    
+    switch (align) {
+        case NumberAlign::LEFT:
+            if (negative) out[pos++] = '-';
+            memcpy(out + pos, digits, length);
+            memset(out + pos + length, ' ', padding);
+            break;
+        case NumberAlign::ZERO_PAD:
+            if (negative) out[pos++] = '-';
+            memset(out + pos, '0', padding);
+            memcpy(out + pos + padding, digits, length);
+            break;
+        case NumberAlign::RIGHT:
+        default:
+            memset(out, ' ', padding);
+            pos = padding;
+            if (negative) out[pos++] = '-';
+            memcpy(out + pos, digits, length);
+            break;
+    }
+    
+    return width;
+}
+
+// Цифры модуля числа с точкой перед последними decimals цифрами
+uint8_t formatMagnitude(char* digits, uint32_t magnitude, uint8_t decimals) {
+    char reversed[NUMBER_FORMAT_MAX_CHARS];
+    uint8_t count = 0;
+    
+    // Младшие цифры (дробная часть и минимум одна цифра целой)
+    do {
+        reversed[count++] = static_cast<char>('0' + magnitude % 10);
+        magnitude /= 10;
+        if (count == decimals) {
+            reversed[count++] = '.';
+            if (magnitude == 0) {
+                reversed[count++] = '0';
+            }
+        }
+    } while (magnitude != 0 || count < decimals);
+    
+    for (uint8_t i = 0; i < count; i++) {
+        digits[i] = reversed[count - 1 - i];
+    }
+    return count;
+}
+
+} // namespace
+
+uint8_t NumberFormat_Fixed(char* out, int32_t value, uint8_t decimals, uint8_t width, NumberAlign align) {
+    if (decimals > 9) decimals = 9;
+    
+    bool negative = value < 0;
+    uint32_t magnitude = negative ? 0u - static_cast<uint32_t>(value) : static_cast<uint32_t>(value);
+    
+    char digits[NUMBER_FORMAT_MAX_CHARS];
+    uint8_t length = formatMagnitude(digits, magnitude, decimals);
+    
+    return applyWidth(out, digits, length, negative, width, align);
+}
+
+uint8_t NumberFormat_Int(char* out, int32_t value, uint8_t width, NumberAlign align) {
+    return NumberFormat_Fixed(out, value, 0, width, align);
+}
+
+uint8_t NumberFormat_Float(char* out, float value, uint8_t decimals, uint8_t width, NumberAlign align) {
+    if (decimals > 6) decimals = 6;
+    
+    // NaN и значения вне диапазона int32 после масштабирования
+    float scaled = value * static_cast<float>(POWERS_OF_10[decimals]);
+    if (scaled != scaled || scaled >= 2147483520.0f || scaled <= -2147483520.0f) {
+        uint8_t length = (width > 0) ? width : 1;
+        if (length > NUMBER_FORMAT_MAX_CHARS) length = NUMBER_FORMAT_MAX_CHARS;
+        memset(out, '#', length);
+        return length;
+    }
+    
+    // Округление половины от нуля
+    int32_t fixed = static_cast<int32_t>(scaled < 0 ? scaled - 0.5f : scaled + 0.5f);
+    
+    return NumberFormat_Fixed(out, fixed, decimals, width, align);
+}
@@ -0,0 +1,28 @@
+#ifndef NUMBER_FORMAT_HPP
+#define NUMBER_FORMAT_HPP
+
+#include <cstdint>
+
+// Максимальная длина отформатированного числа (без завершающего нуля)
+constexpr uint8_t NUMBER_FORMAT_MAX_CHARS = 24;
+
+// Выравнивание числа в поле фиксированной ширины
+enum class NumberAlign : uint8_t {
+    LEFT,       // Пробелы справа
+    RIGHT,      // Пробелы слева
+    ZERO_PAD    // Нули слева после знака
+};
+
+// Форматирование чисел без printf. Результат - ASCII символы без завершающего нуля,
+// функции возвращают количество записанных символов. При width > 0 результат всегда
+// ровно width символов; не помещающееся число заменяется символами '#'.
+// Буфер out должен вмещать NUMBER_FORMAT_MAX_CHARS символов.
+uint8_t NumberFormat_Int(char* out, int32_t value, uint8_t width = 0, NumberAlign align = NumberAlign::RIGHT);
+
+// Число с фиксированной точкой: value = 12345, decimals = 2 -> "123.45"
+uint8_t NumberFormat_Fixed(char* out, int32_t value, uint8_t decimals, uint8_t width = 0, NumberAlign align = NumberAlign::RIGHT);
+
+// Число с плавающей точкой, округленное до decimals знаков (не более 6)
+uint8_t NumberFormat_Float(char* out, float value, uint8_t decimals, uint8_t width = 0, NumberAlign align = NumberAlign::RIGHT);
+
+#endif
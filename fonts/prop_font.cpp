@@ -0,0 +1,45 @@
+#include "prop_font.hpp"
+#include "font8x16.hpp"
+
+const PropGlyph* PropFont_GetGlyph(const PropFont* font, uint32_t unicode_char) {
+    // Диапазонов немного, линейный поиск быстрее бинарного
+    for (uint8_t i = 0; i < font->range_count; i++) {
+        const PropFontRange& range = font->ranges[i];
+        if (unicode_char < range.first) {
+            break;
+        }
+        if (unicode_char - range.first < range.count) {
+            return &font->glyphs[range.glyph_index + (unicode_char - range.first)];
+        }
+    }
+    
+    return &font->glyphs[font->fallback_glyph];
+}
+
+const PropGlyph* PropFont_GetGlyphUTF8(const PropFont* font, const char* utf8_char, uint8_t* bytes_consumed) {
+    uint32_t unicode = UTF8_Decode(utf8_char, bytes_consumed);
+    return PropFont_GetGlyph(font, unicode);
+}
+
+const uint8_t* PropFont_GetBitmap(const PropFont* font, const PropGlyph* glyph) {
+    return font->bitmap + glyph->bitmap_offset;
+}
+
+uint8_t PropFont_RowBytes(const PropFont* font, const PropGlyph* glyph) {
+    return static_cast<uint8_t>((glyph->width * font->bpp + 7) / 8);
+}
+
+uint16_t PropFont_TextWidth(const PropFont* font, const char* utf8_str) {
+    uint16_t width = 0;
+    const char* ptr = utf8_str;
+    uint32_t codepoints[FONT8X16_GLYPH_BATCH];
+    
+    while (*ptr) {
+        uint8_t count = UTF8_DecodeBatch(&ptr, codepoints, FONT8X16_GLYPH_BATCH);
+        for (uint8_t i = 0; i < count; i++) {
+            width += PropFont_GetGlyph(font, codepoints[i])->advance;
+        }
+    }
+    
+    return width;
+}
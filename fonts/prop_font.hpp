@@ -0,0 +1,62 @@
+#ifndef PROP_FONT_HPP
+#define PROP_FONT_HPP
+
+#include <cstdint>
+
+// Описание глифа пропорционального шрифта.
+// Хранится только "чернильный" прямоугольник (ink box) символа,
+// пустые строки и столбцы вокруг него в растр не попадают.
+struct PropGlyph {
+    uint16_t bitmap_offset;  // Смещение растра глифа в массиве bitmap
+    uint8_t width;           // Ширина ink box в пикселях
+    uint8_t height;          // Высота ink box в пикселях
+    uint8_t x_offset;        // Смещение ink box от позиции курсора
+    uint8_t y_offset;        // Смещение ink box от верха строки
+    uint8_t advance;         // Шаг курсора после символа
+};
+
+// Непрерывный диапазон кодов Unicode, отображаемый на таблицу глифов
+struct PropFontRange {
+    uint16_t first;          // Первый код диапазона
+    uint16_t count;          // Количество символов в диапазоне
+    uint16_t glyph_index;    // Индекс первого глифа диапазона
+};
+
+// Пропорциональный шрифт.
+// Строки растра выровнены по байту: (width * bpp + 7) / 8 байт на строку,
+// пиксели упакованы начиная со старшего бита. При bpp = 2 или 4 значение
+// пикселя - уровень покрытия для сглаживания.
+struct PropFont {
+    const uint8_t* bitmap;
+    const PropGlyph* glyphs;
+    const PropFontRange* ranges;   // Отсортированы по возрастанию first
+    uint8_t range_count;
+    uint16_t fallback_glyph;       // Глиф для отсутствующих символов
+    uint8_t line_height;           // Высота строки в пикселях
+    uint8_t bpp;                   // Бит на пиксель растра
+};
+
+// Поиск глифа по коду Unicode (всегда возвращает валидный глиф)
+const PropGlyph* PropFont_GetGlyph(const PropFont* font, uint32_t unicode_char);
+const PropGlyph* PropFont_GetGlyphUTF8(const PropFont* font, const char* utf8_char, uint8_t* bytes_consumed);
+
+// Растр глифа и размер его строки в байтах
+const uint8_t* PropFont_GetBitmap(const PropFont* font, const PropGlyph* glyph);
+uint8_t PropFont_RowBytes(const PropFont* font, const PropGlyph* glyph);
+
+// Поддерживаемые форматы растра: 1, 2 и 4 бита на пиксель (пиксель не пересекает границу байта)
+inline bool PropFont_IsValidBpp(uint8_t bpp) {
+    return bpp == 1 || bpp == 2 || bpp == 4;
+}
+
+// Уровень покрытия пикселя col в строке растра (0 .. (1 << bpp) - 1). bpp - 1, 2 или 4
+inline uint8_t PropFont_GetLevel(const uint8_t* row, uint8_t col, uint8_t bpp) {
+    uint16_t bit = static_cast<uint16_t>(col) * bpp;
+    uint8_t shift = static_cast<uint8_t>(8 - bpp - (bit & 7));
+    return static_cast<uint8_t>((row[bit >> 3] >> shift) & ((1 << bpp) - 1));
+}
+
+// Ширина UTF-8 строки в пикселях (сумма advance)
+uint16_t PropFont_TextWidth(const PropFont* font, const char* utf8_str);
+
+#endif
@@ -0,0 +1,165 @@
+#include "blend565.hpp"
+#include <algorithm>
+#include <cstring>
+
+#if ST7789V3_BLEND_SIMD && defined(__SSE2__)
+#include <emmintrin.h>
+#define BLEND565_SSE2 1
+#elif ST7789V3_BLEND_SIMD && defined(__ARM_NEON)
+#include <arm_neon.h>
+#define BLEND565_NEON 1
+#endif
+
+namespace {
+
+// Два пикселя в слове раскладываются на две половины с промежутками не меньше 5 бит
+// между каналами, чтобы произведение канала на прозрачность не задевало соседний:
+// младшая - синий и красный первого пикселя и зеленый второго,
+// старшая (слово сдвинуто на 5) - зеленый первого, синий и красный второго
+constexpr uint32_t PAIR_MASK_LO = 0x07E0F81Fu;
+constexpr uint32_t PAIR_MASK_HI = 0x07C0F83Fu;
+
+inline uint32_t blendPair(uint32_t fg, uint32_t bg, uint32_t a) {
+    uint32_t f_lo = fg & PAIR_MASK_LO;
+    uint32_t b_lo = bg & PAIR_MASK_LO;
+    uint32_t f_hi = (fg >> 5) & PAIR_MASK_HI;
+    uint32_t b_hi = (bg >> 5) & PAIR_MASK_HI;
+
+    // b + (f - b) * a / 32 по всем каналам сразу; заем отрицательной разности
+    // уходит в неиспользуемые старшие биты и снимается маской
+    uint32_t lo = ((((f_lo - b_lo) * a) >> 5) + b_lo) & PAIR_MASK_LO;
+    uint32_t hi = ((((f_hi - b_hi) * a) >> 5) + b_hi) & PAIR_MASK_HI;
+    return lo | (hi << 5);
+}
+
+inline uint32_t loadPair(const uint16_t* pixels) {
+    uint32_t word;
+    memcpy(&word, pixels, sizeof(word));    // Отрезок может начинаться с нечетного пикселя
+    return word;
+}
+
+inline void storePair(uint16_t* pixels, uint32_t word) {
+    memcpy(pixels, &word, sizeof(word));
+}
+
+#if defined(BLEND565_SSE2)
+
+// 8 пикселей: каналы в 16-битных дорожках, b + ((f - b) * a >> 5) со знаком
+inline __m128i blend8(__m128i f, __m128i b, __m128i a) {
+    const __m128i mask5 = _mm_set1_epi16(0x1F);
+    const __m128i mask6 = _mm_set1_epi16(0x3F);
+
+    __m128i fr = _mm_srli_epi16(f, 11);
+    __m128i br = _mm_srli_epi16(b, 11);
+    __m128i fg = _mm_and_si128(_mm_srli_epi16(f, 5), mask6);
+    __m128i bg = _mm_and_si128(_mm_srli_epi16(b, 5), mask6);
+    __m128i fb = _mm_and_si128(f, mask5);
+    __m128i bb = _mm_and_si128(b, mask5);
+
+    __m128i r = _mm_add_epi16(br, _mm_srai_epi16(_mm_mullo_epi16(_mm_sub_epi16(fr, br), a), 5));
+    __m128i g = _mm_add_epi16(bg, _mm_srai_epi16(_mm_mullo_epi16(_mm_sub_epi16(fg, bg), a), 5));
+    __m128i bl = _mm_add_epi16(bb, _mm_srai_epi16(_mm_mullo_epi16(_mm_sub_epi16(fb, bb), a), 5));
+
+    return _mm_or_si128(_mm_or_si128(_mm_slli_epi16(r, 11), _mm_slli_epi16(g, 5)), bl);
+}
+
+#elif defined(BLEND565_NEON)
+
+inline uint16x8_t blend8(uint16x8_t f, uint16x8_t b, int16_t a) {
+    int16x8_t fr = vreinterpretq_s16_u16(vshrq_n_u16(f, 11));
+    int16x8_t br = vreinterpretq_s16_u16(vshrq_n_u16(b, 11));
+    int16x8_t fg = vreinterpretq_s16_u16(vandq_u16(vshrq_n_u16(f, 5), vdupq_n_u16(0x3F)));
+    int16x8_t bg = vreinterpretq_s16_u16(vandq_u16(vshrq_n_u16(b, 5), vdupq_n_u16(0x3F)));
+    int16x8_t fb = vreinterpretq_s16_u16(vandq_u16(f, vdupq_n_u16(0x1F)));
+    int16x8_t bb = vreinterpretq_s16_u16(vandq_u16(b, vdupq_n_u16(0x1F)));
+
+    uint16x8_t r = vreinterpretq_u16_s16(vaddq_s16(br, vshrq_n_s16(vmulq_n_s16(vsubq_s16(fr, br), a), 5)));
+    uint16x8_t g = vreinterpretq_u16_s16(vaddq_s16(bg, vshrq_n_s16(vmulq_n_s16(vsubq_s16(fg, bg), a), 5)));
+    uint16x8_t bl = vreinterpretq_u16_s16(vaddq_s16(bb, vshrq_n_s16(vmulq_n_s16(vsubq_s16(fb, bb), a), 5)));
+
+    return vorrq_u16(vorrq_u16(vshlq_n_u16(r, 11), vshlq_n_u16(g, 5)), bl);
+}
+
+#endif
+
+} // namespace
+
+void Blend565_Span(uint16_t* dst, const uint16_t* src, uint32_t count, uint8_t alpha) {
+    uint32_t a = Blend565_Alpha5(alpha);
+    if (a == 0) return;
+    if (a == 32) {
+        memcpy(dst, src, count * sizeof(uint16_t));
+        return;
+    }
+
+    uint32_t i = 0;
+#if defined(BLEND565_SSE2)
+    __m128i a8 = _mm_set1_epi16(static_cast<int16_t>(a));
+    for (; i + 8 <= count; i += 8) {
+        __m128i f = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+        __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(dst + i));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), blend8(f, b, a8));
+    }
+#elif defined(BLEND565_NEON)
+    for (; i + 8 <= count; i += 8) {
+        vst1q_u16(dst + i, blend8(vld1q_u16(src + i), vld1q_u16(dst + i), static_cast<int16_t>(a)));
+    }
+#endif
+    for (; i + 2 <= count; i += 2) {
+        storePair(dst + i, blendPair(loadPair(src + i), loadPair(dst + i), a));
+    }
+    if (i < count) {
+        dst[i] = Blend565_Pixel(src[i], dst[i], alpha);
+    }
+}
+
+void Blend565_SpanColor(uint16_t* dst, uint16_t color, uint32_t count, uint8_t alpha) {
+    uint32_t a = Blend565_Alpha5(alpha);
+    if (a == 0) return;
+    if (a == 32) {
+        std::fill_n(dst, count, color);
+        return;
+    }
+
+    uint32_t i = 0;
+#if defined(BLEND565_SSE2)
+    __m128i a8 = _mm_set1_epi16(static_cast<int16_t>(a));
+    __m128i f = _mm_set1_epi16(static_cast<int16_t>(color));
+    for (; i + 8 <= count; i += 8) {
+        __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(dst + i));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), blend8(f, b, a8));
+    }
+#elif defined(BLEND565_NEON)
+    uint16x8_t f = vdupq_n_u16(color);
+    for (; i + 8 <= count; i += 8) {
+        vst1q_u16(dst + i, blend8(f, vld1q_u16(dst + i), static_cast<int16_t>(a)));
+    }
+#endif
+    uint32_t pair = color | (static_cast<uint32_t>(color) << 16);
+    for (; i + 2 <= count; i += 2) {
+        storePair(dst + i, blendPair(pair, loadPair(dst + i), a));
+    }
+    if (i < count) {
+        dst[i] = Blend565_Pixel(color, dst[i], alpha);
+    }
+}
+
+void Blend565_SpanMask(uint16_t* dst, const uint16_t* src, uint16_t color, const uint8_t* mask,
+                       AlphaFormat format, uint16_t mask_x, uint32_t count, uint8_t alpha) {
+    for (uint32_t i = 0; i < count; i++) {
+        uint32_t mx = mask_x + i;
+        uint8_t m;
+        if (format == AlphaFormat::A8) {
+            m = mask[mx];
+        } else {
+            uint8_t pair = mask[mx >> 1];
+            m = static_cast<uint8_t>(((mx & 1) ? (pair & 0x0F) : (pair >> 4)) * 17);
+        }
+        if (m == 0) continue;
+
+        // Прозрачность маски умножается на общую (при alpha = 255 остается m)
+        uint8_t a = static_cast<uint8_t>((m * alpha + 255) >> 8);
+        uint16_t fg = (src != nullptr) ? src[i] : color;
+        dst[i] = (a == 255) ? fg : Blend565_Pixel(fg, dst[i], a);
+    }
+}
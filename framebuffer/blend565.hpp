@@ -0,0 +1,46 @@
+#ifndef BLEND565_HPP
+#define BLEND565_HPP
+
+#include <cstdint>
+
+// Векторные варианты ядер (SSE2 / NEON) при сборке для процессоров, где они есть.
+// На Cortex-M используются ядра на 32-битных словах
+#ifndef ST7789V3_BLEND_SIMD
+#define ST7789V3_BLEND_SIMD 1
+#endif
+
+// Формат маски прозрачности: A8 - байт на пиксель, A4 - два пикселя в байте
+// (старшая тетрада - левый пиксель). Строка маски выровнена по байту
+enum class AlphaFormat : uint8_t {
+    A4,
+    A8
+};
+
+// Прозрачность 0..255 переводится в 0..32: смешивание идет с точностью 5 бит на канал
+inline uint8_t Blend565_Alpha5(uint8_t alpha) {
+    return static_cast<uint8_t>((alpha + 4) >> 3);
+}
+
+// Смешивание одного пикселя: alpha / 255 доли fg.
+// Каналы раздвигаются в 32-битное слово (зеленый - в старшую половину), одно умножение на пиксель
+inline uint16_t Blend565_Pixel(uint16_t fg, uint16_t bg, uint8_t alpha) {
+    uint32_t a = Blend565_Alpha5(alpha);
+    uint32_t f = (fg | (static_cast<uint32_t>(fg) << 16)) & 0x07E0F81Fu;
+    uint32_t b = (bg | (static_cast<uint32_t>(bg) << 16)) & 0x07E0F81Fu;
+    uint32_t r = ((((f - b) * a) >> 5) + b) & 0x07E0F81Fu;
+    return static_cast<uint16_t>(r | (r >> 16));
+}
+
+// dst = src * alpha + dst * (1 - alpha), общая прозрачность для всего отрезка.
+// Пиксели обрабатываются парами: два умножения на пару
+void Blend565_Span(uint16_t* dst, const uint16_t* src, uint32_t count, uint8_t alpha);
+
+// Смешивание отрезка с одним цветом (полупрозрачная заливка)
+void Blend565_SpanColor(uint16_t* dst, uint16_t color, uint32_t count, uint8_t alpha);
+
+// Смешивание с прозрачностью каждого пикселя из маски (умножается на alpha).
+// src == nullptr - смешивается цвет color. mask_x - номер первого пикселя в строке маски
+void Blend565_SpanMask(uint16_t* dst, const uint16_t* src, uint16_t color, const uint8_t* mask,
+                       AlphaFormat format, uint16_t mask_x, uint32_t count, uint8_t alpha = 255);
+
+#endif
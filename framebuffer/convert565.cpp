@@ -0,0 +1,340 @@
+#include "convert565.hpp"
+#include "gradient.hpp"
+#include <cstring>
+
+#if ST7789V3_CONVERT_SIMD && defined(__SSE2__)
+#include <emmintrin.h>
+#define CONVERT565_SSE2 1
+#if defined(__SSSE3__)
+#include <tmmintrin.h>
+#define CONVERT565_SSSE3 1
+#endif
+#if defined(__AVX2__)
+#include <immintrin.h>
+#define CONVERT565_AVX2 1
+#endif
+#elif ST7789V3_CONVERT_SIMD && defined(__ARM_NEON)
+#include <arm_neon.h>
+#define CONVERT565_NEON 1
+#endif
+
+namespace {
+
+// Пороги сглаживания для четырех столбцов, начиная с первого пикселя отрезка:
+// пиксель i берет порог [i & 3] (векторные шаги кратны 4, фаза сохраняется)
+struct DitherRow {
+    uint8_t t5[4];
+    uint8_t t6[4];
+};
+
+// Пара пикселей в 32-битном слове: первый - по младшему адресу
+inline uint32_t makePair(uint32_t first, uint32_t second) {
+#if defined(__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_BIG_ENDIAN__)
+    return (first << 16) | second;
+#else
+    return first | (second << 16);
+#endif
+}
+
+inline uint32_t swapPair(uint32_t word) {
+    return ((word & 0x00FF00FFu) << 8) | ((word >> 8) & 0x00FF00FFu);
+}
+
+inline void storePair(uint16_t* pixels, uint32_t word) {
+    memcpy(pixels, &word, sizeof(word));    // Отрезок может начинаться с нечетного пикселя
+}
+
+template <PixelFormat F>
+constexpr uint32_t bytesPerPixel() {
+    return (F == PixelFormat::RGB888 || F == PixelFormat::BGR888) ? 3 : (F == PixelFormat::ARGB8888 ? 4 : 1);
+}
+
+template <PixelFormat F, bool DITHER>
+inline uint32_t convertPixel(const uint8_t* p, uint32_t t5, uint32_t t6) {
+    uint32_t r, g, b;
+    if constexpr (F == PixelFormat::RGB888) {
+        r = p[0]; g = p[1]; b = p[2];
+    } else if constexpr (F == PixelFormat::BGR888) {
+        b = p[0]; g = p[1]; r = p[2];
+    } else if constexpr (F == PixelFormat::ARGB8888) {
+        uint32_t word;
+        memcpy(&word, p, sizeof(word));
+        if constexpr (!DITHER) {
+            // Без сглаживания каналы вырезаются из слова тремя сдвигами
+            return ((word >> 8) & 0xF800) | ((word >> 5) & 0x07E0) | ((word >> 3) & 0x001F);
+        }
+        r = (word >> 16) & 0xFF; g = (word >> 8) & 0xFF; b = word & 0xFF;
+    } else {
+        r = g = b = p[0];
+    }
+    if constexpr (DITHER) {
+        r += t5; g += t6; b += t5;
+        if (r > 255) r = 255;
+        if (g > 255) g = 255;
+        if (b > 255) b = 255;
+    }
+    return ((r & 0xF8) << 8) | ((g & 0xFC) << 3) | (b >> 3);
+}
+
+// Скалярный хвост (и весь отрезок на Cortex-M): два пикселя - одна запись слова
+template <PixelFormat F, bool DITHER>
+void convertScalar(uint16_t* dst, const uint8_t* src, uint32_t i, uint32_t count,
+                   const DitherRow& row, bool swap) {
+    constexpr uint32_t BPP = bytesPerPixel<F>();
+    for (; i + 2 <= count; i += 2) {
+        uint32_t p0 = convertPixel<F, DITHER>(src + i * BPP, row.t5[i & 3], row.t6[i & 3]);
+        uint32_t p1 = convertPixel<F, DITHER>(src + (i + 1) * BPP, row.t5[(i + 1) & 3], row.t6[(i + 1) & 3]);
+        uint32_t word = makePair(p0, p1);
+        storePair(dst + i, swap ? swapPair(word) : word);
+    }
+    if (i < count) {
+        uint32_t p = convertPixel<F, DITHER>(src + i * BPP, row.t5[i & 3], row.t6[i & 3]);
+        dst[i] = static_cast<uint16_t>(swap ? ((p << 8) | (p >> 8)) : p);
+    }
+}
+
+template <PixelFormat F>
+void convertScalar(uint16_t* dst, const uint8_t* src, uint32_t i, uint32_t count,
+                   const DitherRow& row, bool dither, bool swap) {
+    if (dither) {
+        convertScalar<F, true>(dst, src, i, count, row, swap);
+    } else {
+        convertScalar<F, false>(dst, src, i, count, row, swap);
+    }
+}
+
+#if defined(CONVERT565_SSE2)
+
+// Пороги для дорожек 0x00RRGGBB: байты B и R - t5, G - t6
+inline __m128i ditherLanes(const DitherRow& row) {
+    int32_t lane[4];
+    for (uint8_t k = 0; k < 4; k++) {
+        lane[k] = row.t5[k] | (row.t6[k] << 8) | (row.t5[k] << 16);
+    }
+    return _mm_setr_epi32(lane[0], lane[1], lane[2], lane[3]);
+}
+
+// 4 пикселя 0x??RRGGBB в 32-битных дорожках -> RGB565, расширенный знаком
+// (чтобы упаковка со знаковым насыщением не искажала значения больше 0x7FFF)
+inline __m128i convert4(__m128i v) {
+    __m128i r = _mm_and_si128(_mm_srli_epi32(v, 8), _mm_set1_epi32(0xF800));
+    __m128i g = _mm_and_si128(_mm_srli_epi32(v, 5), _mm_set1_epi32(0x07E0));
+    __m128i b = _mm_and_si128(_mm_srli_epi32(v, 3), _mm_set1_epi32(0x001F));
+    __m128i c = _mm_or_si128(_mm_or_si128(r, g), b);
+    return _mm_srai_epi32(_mm_slli_epi32(c, 16), 16);
+}
+
+inline __m128i swap8(__m128i v) {
+    return _mm_or_si128(_mm_slli_epi16(v, 8), _mm_srli_epi16(v, 8));
+}
+
+inline void store8(uint16_t* dst, __m128i lo, __m128i hi, __m128i dither, bool swap) {
+    __m128i c = _mm_packs_epi32(convert4(_mm_adds_epu8(lo, dither)), convert4(_mm_adds_epu8(hi, dither)));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(dst), swap ? swap8(c) : c);
+}
+
+#if defined(CONVERT565_AVX2)
+
+inline __m256i convert8(__m256i v) {
+    __m256i r = _mm256_and_si256(_mm256_srli_epi32(v, 8), _mm256_set1_epi32(0xF800));
+    __m256i g = _mm256_and_si256(_mm256_srli_epi32(v, 5), _mm256_set1_epi32(0x07E0));
+    __m256i b = _mm256_and_si256(_mm256_srli_epi32(v, 3), _mm256_set1_epi32(0x001F));
+    __m256i c = _mm256_or_si256(_mm256_or_si256(r, g), b);
+    return _mm256_srai_epi32(_mm256_slli_epi32(c, 16), 16);
+}
+
+// Упаковка идет внутри 128-битных половин: порядок восстанавливается перестановкой четвертей
+inline void store16(uint16_t* dst, __m256i lo, __m256i hi, __m256i dither, bool swap) {
+    __m256i c = _mm256_packs_epi32(convert8(_mm256_adds_epu8(lo, dither)), convert8(_mm256_adds_epu8(hi, dither)));
+    c = _mm256_permute4x64_epi64(c, 0xD8);
+    if (swap) {
+        c = _mm256_or_si256(_mm256_slli_epi16(c, 8), _mm256_srli_epi16(c, 8));
+    }
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst), c);
+}
+
+#endif
+
+#if defined(CONVERT565_SSSE3)
+
+// Перестановка 12 байт (4 пикселя по 3 байта) в дорожки 0x00RRGGBB
+inline __m128i unpack24Mask(PixelFormat format) {
+    if (format == PixelFormat::RGB888) {
+        return _mm_setr_epi8(2, 1, 0, -1, 5, 4, 3, -1, 8, 7, 6, -1, 11, 10, 9, -1);
+    }
+    return _mm_setr_epi8(0, 1, 2, -1, 3, 4, 5, -1, 6, 7, 8, -1, 9, 10, 11, -1);
+}
+
+#endif
+
+// Векторная часть отрезка; возвращает количество обработанных пикселей (кратно 4)
+uint32_t convertVector(uint16_t* dst, const uint8_t* src, PixelFormat format, uint32_t count,
+                       const DitherRow& row, bool swap) {
+    uint32_t i = 0;
+    __m128i dither = ditherLanes(row);
+
+    if (format == PixelFormat::ARGB8888) {
+#if defined(CONVERT565_AVX2)
+        __m256i dither2 = _mm256_broadcastsi128_si256(dither);
+        for (; i + 16 <= count; i += 16) {
+            __m256i lo = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i * 4));
+            __m256i hi = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i * 4 + 32));
+            store16(dst + i, lo, hi, dither2, swap);
+        }
+#endif
+        for (; i + 8 <= count; i += 8) {
+            __m128i lo = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i * 4));
+            __m128i hi = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i * 4 + 16));
+            store8(dst + i, lo, hi, dither, swap);
+        }
+    } else if (format == PixelFormat::GRAY8) {
+        // Яркость расширяется до 16 бит, красный и синий - из одного байта
+        uint8_t t5[16];
+        uint8_t t6[16];
+        for (uint8_t k = 0; k < 16; k++) {
+            t5[k] = row.t5[k & 3];
+            t6[k] = row.t6[k & 3];
+        }
+        __m128i d5 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(t5));
+        __m128i d6 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(t6));
+        const __m128i zero = _mm_setzero_si128();
+        const __m128i mask5 = _mm_set1_epi16(0xF8);
+        const __m128i mask6 = _mm_set1_epi16(0xFC);
+        for (; i + 16 <= count; i += 16) {
+            __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+            __m128i v5 = _mm_adds_epu8(v, d5);
+            __m128i v6 = _mm_adds_epu8(v, d6);
+            for (uint8_t half = 0; half < 2; half++) {
+                __m128i rb = half ? _mm_unpackhi_epi8(v5, zero) : _mm_unpacklo_epi8(v5, zero);
+                __m128i g = half ? _mm_unpackhi_epi8(v6, zero) : _mm_unpacklo_epi8(v6, zero);
+                __m128i c = _mm_or_si128(_mm_or_si128(_mm_slli_epi16(_mm_and_si128(rb, mask5), 8),
+                                                      _mm_slli_epi16(_mm_and_si128(g, mask6), 3)),
+                                         _mm_srli_epi16(rb, 3));
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i + half * 8), swap ? swap8(c) : c);
+            }
+        }
+    } else {
+#if defined(CONVERT565_SSSE3)
+        // Загрузки по 16 байт со смещением 12 заходят на 4 байта за последний пиксель шага:
+        // векторный шаг выполняется, только если за ним есть еще 2 пикселя
+        __m128i shuffle = unpack24Mask(format);
+#if defined(CONVERT565_AVX2)
+        __m256i shuffle2 = _mm256_broadcastsi128_si256(shuffle);
+        __m256i dither2 = _mm256_broadcastsi128_si256(dither);
+        for (; i + 18 <= count; i += 16) {
+            const uint8_t* p = src + i * 3;
+            __m256i lo = _mm256_inserti128_si256(
+                _mm256_castsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i*>(p))),
+                _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + 12)), 1);
+            __m256i hi = _mm256_inserti128_si256(
+                _mm256_castsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i*>(p + 24))),
+                _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + 36)), 1);
+            store16(dst + i, _mm256_shuffle_epi8(lo, shuffle2), _mm256_shuffle_epi8(hi, shuffle2), dither2, swap);
+        }
+#endif
+        for (; i + 10 <= count; i += 8) {
+            const uint8_t* p = src + i * 3;
+            __m128i lo = _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(p)), shuffle);
+            __m128i hi = _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(p + 12)), shuffle);
+            store8(dst + i, lo, hi, dither, swap);
+        }
+#endif
+    }
+    return i;
+}
+
+#elif defined(CONVERT565_NEON)
+
+// Каналы 16 пикселей -> RGB565: вставка со сдвигом собирает слово без масок
+inline void store16(uint16_t* dst, uint8x16_t r, uint8x16_t g, uint8x16_t b, bool swap) {
+    for (uint8_t half = 0; half < 2; half++) {
+        uint8x8_t r8 = half ? vget_high_u8(r) : vget_low_u8(r);
+        uint8x8_t g8 = half ? vget_high_u8(g) : vget_low_u8(g);
+        uint8x8_t b8 = half ? vget_high_u8(b) : vget_low_u8(b);
+        uint16x8_t c = vshll_n_u8(r8, 8);
+        c = vsriq_n_u16(c, vshll_n_u8(g8, 8), 5);
+        c = vsriq_n_u16(c, vshll_n_u8(b8, 8), 11);
+        if (swap) {
+            c = vreinterpretq_u16_u8(vrev16q_u8(vreinterpretq_u8_u16(c)));
+        }
+        vst1q_u16(dst + half * 8, c);
+    }
+}
+
+uint32_t convertVector(uint16_t* dst, const uint8_t* src, PixelFormat format, uint32_t count,
+                       const DitherRow& row, bool swap) {
+    uint8_t t5[16];
+    uint8_t t6[16];
+    for (uint8_t k = 0; k < 16; k++) {
+        t5[k] = row.t5[k & 3];
+        t6[k] = row.t6[k & 3];
+    }
+    uint8x16_t d5 = vld1q_u8(t5);
+    uint8x16_t d6 = vld1q_u8(t6);
+
+    uint32_t i = 0;
+    for (; i + 16 <= count; i += 16) {
+        uint8x16_t r, g, b;
+        if (format == PixelFormat::RGB888) {
+            uint8x16x3_t p = vld3q_u8(src + i * 3);
+            r = p.val[0]; g = p.val[1]; b = p.val[2];
+        } else if (format == PixelFormat::BGR888) {
+            uint8x16x3_t p = vld3q_u8(src + i * 3);
+            b = p.val[0]; g = p.val[1]; r = p.val[2];
+        } else if (format == PixelFormat::ARGB8888) {
+            // Слово 0xAARRGGBB в памяти (little-endian): B, G, R, A
+            uint8x16x4_t p = vld4q_u8(src + i * 4);
+            b = p.val[0]; g = p.val[1]; r = p.val[2];
+        } else {
+            r = g = b = vld1q_u8(src + i);
+        }
+        store16(dst + i, vqaddq_u8(r, d5), vqaddq_u8(g, d6), vqaddq_u8(b, d5), swap);
+    }
+    return i;
+}
+
+#else
+
+uint32_t convertVector(uint16_t*, const uint8_t*, PixelFormat, uint32_t, const DitherRow&, bool) {
+    return 0;
+}
+
+#endif
+
+} // namespace
+
+void Convert565_Span(uint16_t* dst, const uint8_t* src, PixelFormat format, uint32_t count,
+                     uint8_t flags, uint16_t x, uint16_t y) {
+    if (dst == nullptr || src == nullptr || count == 0) {
+        return;
+    }
+
+    // Пороги те же, что у градиентов (Gradient_DitherBias): 1/32..31/32 уровня,
+    // в единицах 8-битного канала - шаг 8 для 5 бит и 4 для 6 бит
+    DitherRow row = {};
+    bool dither = (flags & CONVERT565_DITHER) != 0;
+    if (dither) {
+        for (uint8_t k = 0; k < 4; k++) {
+            int32_t bias = Gradient_DitherBias(x + k, y);
+            row.t5[k] = static_cast<uint8_t>(bias >> 13);
+            row.t6[k] = static_cast<uint8_t>(bias >> 14);
+        }
+    }
+    bool swap = (flags & CONVERT565_SWAP) != 0;
+
+    uint32_t i = convertVector(dst, src, format, count, row, swap);
+    switch (format) {
+        case PixelFormat::RGB888:
+            convertScalar<PixelFormat::RGB888>(dst, src, i, count, row, dither, swap);
+            break;
+        case PixelFormat::BGR888:
+            convertScalar<PixelFormat::BGR888>(dst, src, i, count, row, dither, swap);
+            break;
+        case PixelFormat::ARGB8888:
+            convertScalar<PixelFormat::ARGB8888>(dst, src, i, count, row, dither, swap);
+            break;
+        default:
+            convertScalar<PixelFormat::GRAY8>(dst, src, i, count, row, dither, swap);
+            break;
+    }
+}
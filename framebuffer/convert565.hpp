@@ -0,0 +1,44 @@
+#ifndef CONVERT565_HPP
+#define CONVERT565_HPP
+
+#include <cstdint>
+
+// Векторные варианты преобразования (SSE2 / SSSE3 / AVX2 / NEON) при сборке для
+// процессоров, где они есть. На Cortex-M пиксели собираются парами в 32-битные слова
+#ifndef ST7789V3_CONVERT_SIMD
+#define ST7789V3_CONVERT_SIMD 1
+#endif
+
+// Формат исходных пикселей (камеры, декодеры изображений)
+enum class PixelFormat : uint8_t {
+    RGB888,     // Три байта: R, G, B
+    BGR888,     // Три байта: B, G, R
+    ARGB8888,   // 32-битное слово 0xAARRGGBB в порядке процессора, альфа не учитывается
+    GRAY8       // Байт яркости
+};
+
+// Флаги преобразования (можно объединять)
+constexpr uint8_t CONVERT565_NONE = 0x00;
+constexpr uint8_t CONVERT565_DITHER = 0x01;  // Упорядоченное сглаживание 4x4 вместо отбрасывания младших битов
+constexpr uint8_t CONVERT565_SWAP = 0x02;    // Результат в порядке байтов дисплея (старший первым в памяти)
+
+// Размер исходного пикселя в байтах
+inline uint8_t Convert565_BytesPerPixel(PixelFormat format) {
+    switch (format) {
+        case PixelFormat::RGB888:
+        case PixelFormat::BGR888:
+            return 3;
+        case PixelFormat::ARGB8888:
+            return 4;
+        default:
+            return 1;
+    }
+}
+
+// Преобразование count пикселей одной строки в RGB565. (x, y) - экранные координаты
+// первого пикселя: по ним выбирается фаза матрицы сглаживания, чтобы соседние отрезки
+// и кадры давали один и тот же узор. src может быть не выровнен
+void Convert565_Span(uint16_t* dst, const uint8_t* src, PixelFormat format, uint32_t count,
+                     uint8_t flags = CONVERT565_NONE, uint16_t x = 0, uint16_t y = 0);
+
+#endif
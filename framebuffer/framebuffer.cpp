@@ -1,9 +1,9 @@
 #include "framebuffer.hpp"
-#include "../fonts/font8x16.hpp"
 #include "main.h"
+#include "color_ramp.hpp"
 #include <algorithm>
-#include <cmath>
 #include <cstdlib>
+#include <cstring>
 
 // Внешние переменные из main.c
 extern SPI_HandleTypeDef hspi1;
@@ -11,49 +11,34 @@ extern SPI_HandleTypeDef hspi1;
 // Глобальная переменная для отслеживания состояния DMA
 volatile bool dma_transfer_complete = true;
 
-// Статический буфер кадра и флаг инициализации
-static uint16_t static_framebuffer[240 * 136];
-static bool static_framebuffer_initialized = false;
-
-// Определение статического буфера
-uint16_t Framebuffer::static_buffer_[STATIC_FB_MAX_PIXELS];
+// Статический пул выдается только одному экземпляру (сам пул - в framebuffer_pool.cpp)
+bool Framebuffer::static_buffer_taken_ = false;
 
 Framebuffer::Framebuffer(uint16_t width, uint16_t height)
-    : buffer_(nullptr), width_(width), height_(height), allocated_(false), use_static_buffer_(false) {
+    : buffer_(nullptr), width_(width), height_(height), allocated_(false), use_static_buffer_(false),
+      external_buffer_(false), dma_capable_(false), write_x_(0), write_w_(0), write_col_(0), write_row_(0), write_end_row_(0) {
 }
 
-Framebuffer::~Framebuffer() {
-    release();
+Framebuffer::Framebuffer(uint16_t* storage, uint16_t width, uint16_t height)
+    : Framebuffer(FramebufferMemory{storage, static_cast<uint32_t>(width) * height * 2u, FramebufferMemoryType::SRAM},
+                  width, height) {
 }
 
-bool Framebuffer::init() {
-    if (allocated_) {
-        return true; // Уже инициализирован
-    }
-    
-    uint32_t total_pixels = static_cast<uint32_t>(width_) * height_;
-    
-    // Проверяем, можем ли использовать статический буфер
-    if (total_pixels <= STATIC_FB_MAX_PIXELS) {
-        buffer_ = static_buffer_;
-        use_static_buffer_ = true;
-        allocated_ = true;
-        clear(); // Очищаем буфер
-        return true;
-    }
-    
-    // Пытаемся выделить динамический буфер
-    uint32_t buffer_size = total_pixels * sizeof(uint16_t);
-    buffer_ = static_cast<uint16_t*>(malloc(buffer_size));
-    
-    if (buffer_ == nullptr) {
-        return false; // Не удалось выделить память
+Framebuffer::Framebuffer(const FramebufferMemory& memory, uint16_t width, uint16_t height)
+    : buffer_(nullptr), width_(width), height_(height), allocated_(false), use_static_buffer_(false),
+      external_buffer_(true), dma_capable_(false), write_x_(0), write_w_(0), write_col_(0), write_row_(0), write_end_row_(0) {
+    uint32_t needed = static_cast<uint32_t>(width) * height * sizeof(uint16_t);
+    if (memory.base == nullptr || memory.size_bytes < needed) {
+        return; // Области не хватает для буфера
     }
     
-    use_static_buffer_ = false;
+    buffer_ = memory.base;
     allocated_ = true;
-    clear(); // Очищаем буфер
-    return true;
+    dma_capable_ = FramebufferMemory_IsDMACapable(memory);
+}
+
+Framebuffer::~Framebuffer() {
+    release();
 }
 
 void Framebuffer::clear(uint16_t color) {
@@ -68,25 +53,26 @@ void Framebuffer::clear(uint16_t color) {
 }
 
 void Framebuffer::release() {
+    // Память вызывающего кода не освобождается
+    if (external_buffer_) {
+        return;
+    }
+    
     if (allocated_ && buffer_ != nullptr) {
-        if (!use_static_buffer_) {
+        if (use_static_buffer_) {
+            static_buffer_taken_ = false;
+        } else {
+#if ST7789V3_FB_USE_MALLOC
             free(buffer_);
+#endif
         }
         buffer_ = nullptr;
         allocated_ = false;
         use_static_buffer_ = false;
+        dma_capable_ = false;
     }
 }
 
-void Framebuffer::setPixel(uint16_t x, uint16_t y, uint16_t color) {
-    if (!allocated_ || buffer_ == nullptr || x >= width_ || y >= height_) {
-        return;
-    }
-    
-    uint32_t index = static_cast<uint32_t>(y) * width_ + x;
-    buffer_[index] = color;
-}
-
 uint16_t Framebuffer::getPixel(uint16_t x, uint16_t y) const {
     if (!allocated_ || buffer_ == nullptr || x >= width_ || y >= height_) {
         return 0x0000; // Черный по умолчанию
@@ -96,281 +82,129 @@ uint16_t Framebuffer::getPixel(uint16_t x, uint16_t y) const {
     return buffer_[index];
 }
 
-void Framebuffer::drawLine(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, uint16_t color) {
-    int16_t dx = abs(static_cast<int16_t>(x1) - static_cast<int16_t>(x0));
-    int16_t dy = abs(static_cast<int16_t>(y1) - static_cast<int16_t>(y0));
-    int16_t sx = (x0 < x1) ? 1 : -1;
-    int16_t sy = (y0 < y1) ? 1 : -1;
-    int16_t err = dx - dy;
-    
-    int16_t x = x0, y = y0;
-    
-    while (true) {
-        setPixel(x, y, color);
-        
-        if (x == x1 && y == y1) break;
-        
-        int16_t e2 = 2 * err;
-        if (e2 > -dy) {
-            err -= dy;
-            x += sx;
-        }
-        if (e2 < dx) {
-            err += dx;
-            y += sy;
-        }
-    }
+uint16_t Framebuffer::rgb565(uint8_t r, uint8_t g, uint8_t b) {
+    return ((r & 0xF8) << 8) | ((g & 0xFC) << 3) | (b >> 3);
 }
 
-void Framebuffer::drawRect(uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint16_t color) {
-    // Верхняя и нижняя горизонтальные линии
-    for (uint16_t i = 0; i < w; i++) {
-        setPixel(x + i, y, color);
-        setPixel(x + i, y + h - 1, color);
-    }
-    
-    // Левая и правая вертикальные линии
-    for (uint16_t i = 0; i < h; i++) {
-        setPixel(x, y + i, color);
-        setPixel(x + w - 1, y + i, color);
-    }
-}
+// ===================== ЦЕЛЬ ХОЛСТА =====================
 
-void Framebuffer::fillRect(uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint16_t color) {
-    if (x + w > width_ || y + h > height_) {
-        return; // Выход за границы
-    }
-    
+void Framebuffer::writeFillRect(uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint16_t color) {
+    // Заливка построчно непрерывными отрезками
+    uint16_t* row_ptr = buffer_ + static_cast<uint32_t>(y) * width_ + x;
     for (uint16_t row = 0; row < h; row++) {
-        for (uint16_t col = 0; col < w; col++) {
-            setPixel(x + col, y + row, color);
-        }
-    }
-}
-
-void Framebuffer::drawCircle(uint16_t x0, uint16_t y0, uint16_t r, uint16_t color) {
-    int16_t x = r;
-    int16_t y = 0;
-    int16_t err = 0;
-    
-    while (x >= y) {
-        setPixel(x0 + x, y0 + y, color);
-        setPixel(x0 + y, y0 + x, color);
-        setPixel(x0 - y, y0 + x, color);
-        setPixel(x0 - x, y0 + y, color);
-        setPixel(x0 - x, y0 - y, color);
-        setPixel(x0 - y, y0 - x, color);
-        setPixel(x0 + y, y0 - x, color);
-        setPixel(x0 + x, y0 - y, color);
-        
-        if (err <= 0) {
-            y += 1;
-            err += 2*y + 1;
-        }
-        
-        if (err > 0) {
-            x -= 1;
-            err -= 2*x + 1;
-        }
+        std::fill_n(row_ptr, w, color);
+        row_ptr += width_;
     }
 }
 
-void Framebuffer::fillCircle(uint16_t x0, uint16_t y0, uint16_t r, uint16_t color) {
-    for (int16_t y = -r; y <= r; y++) {
-        for (int16_t x = -r; x <= r; x++) {
-            if (x*x + y*y <= r*r) {
-                setPixel(x0 + x, y0 + y, color);
-            }
-        }
-    }
+void Framebuffer::writeBegin(uint16_t x, uint16_t y, uint16_t w, uint16_t h) {
+    write_x_ = x;
+    write_w_ = w;
+    write_col_ = 0;
+    write_row_ = y;
+    write_end_row_ = y + h;
 }
 
-void Framebuffer::drawChar(uint16_t x, uint16_t y, char ch, uint16_t color, uint16_t bg_color) {
-    if (x + 8 > width_ || y + 16 > height_) return;
-    
-    const uint8_t* font_data = Font8x16_GetChar(static_cast<uint8_t>(ch));
-    
-    for (uint8_t row = 0; row < 16; row++) {
-        uint8_t line = font_data[row];
-        for (uint8_t col = 0; col < 8; col++) {
-            if (line & (0x80 >> col)) {
-                setPixel(x + col, y + row, color);
-            } else if (bg_color != 0x0000) {
-                setPixel(x + col, y + row, bg_color);
-            }
+void Framebuffer::writePush(const uint16_t* pixels, uint32_t count) {
+    // Пиксели заполняют окно построчно, как RAMWR дисплея; лишние отбрасываются
+    while (count > 0 && write_row_ < write_end_row_) {
+        uint16_t n = static_cast<uint16_t>(std::min<uint32_t>(count, write_w_ - write_col_));
+        memcpy(buffer_ + static_cast<uint32_t>(write_row_) * width_ + write_x_ + write_col_, pixels, n * sizeof(uint16_t));
+        
+        pixels += n;
+        count -= n;
+        write_col_ += n;
+        if (write_col_ == write_w_) {
+            write_col_ = 0;
+            write_row_++;
         }
     }
 }
 
-void Framebuffer::drawString(uint16_t x, uint16_t y, const char* str, uint16_t color, uint16_t bg_color) {
-    uint16_t current_x = x;
-    const char* ptr = str;
-    
-    while (*ptr) {
-        if (current_x + 8 > width_) break;
-        
-        drawChar(current_x, y, *ptr, color, bg_color);
-        current_x += 8;
-        ptr++;
-    }
+void Framebuffer::writeBlendPixel(uint16_t x, uint16_t y, uint16_t color, uint8_t alpha) {
+    uint16_t& pixel = buffer_[static_cast<uint32_t>(y) * width_ + x];
+    pixel = ColorRamp_Blend565(color, pixel, alpha, 255);
 }
 
-void Framebuffer::drawStringUTF8(uint16_t x, uint16_t y, const char* utf8_str, uint16_t color, uint16_t bg_color) {
-    uint16_t current_x = x;
-    const char* ptr = utf8_str;
-    
-    while (*ptr) {
-        if (current_x + 8 > width_) break;
-        
-        uint8_t bytes_consumed;
-        const uint8_t* font_data = Font8x16_GetCharUTF8(ptr, &bytes_consumed);
-        
-        // Рисуем символ
-        for (uint8_t row = 0; row < 16; row++) {
-            uint8_t line = font_data[row];
-            for (uint8_t col = 0; col < 8; col++) {
-                if (line & (0x80 >> col)) {
-                    setPixel(current_x + col, y + row, color);
-                } else if (bg_color != 0x0000) {
-                    setPixel(current_x + col, y + row, bg_color);
-                }
-            }
-        }
-        
-        current_x += 8;
-        ptr += bytes_consumed;
-    }
-}
+// ===================== ПОЛУПРОЗРАЧНОСТЬ =====================
 
-uint16_t Framebuffer::rgb565(uint8_t r, uint8_t g, uint8_t b) {
-    return ((r & 0xF8) << 8) | ((g & 0xFC) << 3) | (b >> 3);
-}
+void Framebuffer::fillRectAlpha(int16_t x, int16_t y, uint16_t w, uint16_t h, uint16_t color, uint8_t alpha) {
+    CanvasDetail::BlitWindow win;
+    if (!blitWindow(x, y, w, h, BLIT_NONE, win)) return;
 
-// Реализация масштабированного текста
-void Framebuffer::drawCharScaled(uint16_t x, uint16_t y, char ch, uint16_t color, uint8_t scale, uint16_t bg_color) {
-    if (scale == 0) scale = 1; // Минимальный масштаб 1
-    if (scale > 8) scale = 8;  // Максимальный масштаб 8
-    
-    uint16_t char_width = 8 * scale;
-    uint16_t char_height = 16 * scale;
-    
-    if (x + char_width > width_ || y + char_height > height_) return;
-    
-    const uint8_t* font_data = Font8x16_GetChar(static_cast<uint8_t>(ch));
-    
-    for (uint8_t row = 0; row < 16; row++) {
-        uint8_t line = font_data[row];
-        for (uint8_t col = 0; col < 8; col++) {
-            uint16_t pixel_color = (line & (0x80 >> col)) ? color : bg_color;
-            
-            // Рисуем увеличенный пиксель только если нужно
-            if (pixel_color != 0x0000 || bg_color != 0x0000) {
-                for (uint8_t sy = 0; sy < scale; sy++) {
-                    for (uint8_t sx = 0; sx < scale; sx++) {
-                        uint16_t px = x + col * scale + sx;
-                        uint16_t py = y + row * scale + sy;
-                        if (px < width_ && py < height_) {
-                            setPixel(px, py, pixel_color);
-                        }
-                    }
-                }
-            }
-        }
+    uint16_t* row_ptr = buffer_ + static_cast<uint32_t>(win.y) * width_ + win.x;
+    for (uint16_t row = 0; row < win.h; row++) {
+        Blend565_SpanColor(row_ptr, color, win.w, alpha);
+        row_ptr += width_;
     }
 }
 
-void Framebuffer::drawStringScaled(uint16_t x, uint16_t y, const char* str, uint16_t color, uint8_t scale, uint16_t bg_color) {
-    if (scale == 0) scale = 1;
-    if (scale > 8) scale = 8;
-    
-    uint16_t current_x = x;
-    uint16_t char_width = 8 * scale;
-    
-    const char* ptr = str;
-    
-    while (*ptr) {
-        if (current_x + char_width > width_) break;
-        
-        uint8_t bytes_consumed;
-        const uint8_t* font_data = Font8x16_GetCharUTF8(ptr, &bytes_consumed);
-        
-        // Рисуем увеличенный символ
-        for (uint8_t row = 0; row < 16; row++) {
-            uint8_t line = font_data[row];
-            for (uint8_t col = 0; col < 8; col++) {
-                uint16_t pixel_color = (line & (0x80 >> col)) ? color : bg_color;
-                
-                if (pixel_color != 0x0000 || bg_color != 0x0000) {
-                    for (uint8_t sy = 0; sy < scale; sy++) {
-                        for (uint8_t sx = 0; sx < scale; sx++) {
-                            uint16_t px = current_x + col * scale + sx;
-                            uint16_t py = y + row * scale + sy;
-                            if (px < width_ && py < height_) {
-                                setPixel(px, py, pixel_color);
-                            }
-                        }
-                    }
-                }
-            }
-        }
-        
-        current_x += char_width;
-        ptr += bytes_consumed;
-    }
-}
+void Framebuffer::blitAlpha(int16_t x, int16_t y, uint16_t w, uint16_t h, const uint16_t* pixels, uint8_t alpha,
+                            uint16_t stride) {
+    CanvasDetail::BlitWindow win;
+    if (pixels == nullptr || !blitWindow(x, y, w, h, BLIT_NONE, win)) return;
+    if (stride == 0) stride = w;
 
-void Framebuffer::drawStringUTF8Scaled(uint16_t x, uint16_t y, const char* utf8_str, uint16_t color, uint8_t scale, uint16_t bg_color) {
-    drawStringScaled(x, y, utf8_str, color, scale, bg_color);
+    const uint16_t* src = pixels + win.src_y * stride + win.src_x;
+    uint16_t* row_ptr = buffer_ + static_cast<uint32_t>(win.y) * width_ + win.x;
+    for (uint16_t row = 0; row < win.h; row++) {
+        Blend565_Span(row_ptr, src, win.w, alpha);
+        src += stride;
+        row_ptr += width_;
+    }
 }
 
-// ===================== СТАТИЧЕСКИЙ БУФЕР КАДРА =====================
-
-bool initStaticFramebuffer() {
-    // Очистка буфера при инициализации
-    clearStaticFramebuffer(0x0000);
-    static_framebuffer_initialized = true;
-    return true;
-}
+void Framebuffer::blitAlpha(int16_t x, int16_t y, uint16_t w, uint16_t h, const uint16_t* pixels, const uint8_t* mask,
+                            AlphaFormat format, uint8_t alpha, uint16_t stride) {
+    CanvasDetail::BlitWindow win;
+    if (pixels == nullptr || mask == nullptr || !blitWindow(x, y, w, h, BLIT_NONE, win)) return;
+    if (stride == 0) stride = w;
 
-void clearStaticFramebuffer(uint16_t color) {
-    for (uint32_t i = 0; i < FB_WIDTH * STATIC_FB_HEIGHT; i++) {
-        static_framebuffer[i] = color;
+    uint16_t mask_stride = (format == AlphaFormat::A8) ? w : (w + 1) / 2;
+    const uint16_t* src = pixels + win.src_y * stride + win.src_x;
+    const uint8_t* mask_row = mask + win.src_y * mask_stride;
+    uint16_t* row_ptr = buffer_ + static_cast<uint32_t>(win.y) * width_ + win.x;
+    for (uint16_t row = 0; row < win.h; row++) {
+        Blend565_SpanMask(row_ptr, src, 0, mask_row, format, static_cast<uint16_t>(win.src_x), win.w, alpha);
+        src += stride;
+        mask_row += mask_stride;
+        row_ptr += width_;
     }
 }
 
-void setStaticPixel(uint16_t x, uint16_t y, uint16_t color) {
-    if (x < FB_WIDTH && y < STATIC_FB_HEIGHT) {
-        static_framebuffer[y * FB_WIDTH + x] = color;
-    }
-}
+void Framebuffer::blitConverted(int16_t x, int16_t y, uint16_t w, uint16_t h, const uint8_t* pixels, PixelFormat format,
+                                uint8_t flags, uint16_t stride) {
+    CanvasDetail::BlitWindow win;
+    if (pixels == nullptr || !blitWindow(x, y, w, h, BLIT_NONE, win)) return;
+    if (stride == 0) stride = w;
 
-uint16_t getStaticPixel(uint16_t x, uint16_t y) {
-    if (x < FB_WIDTH && y < STATIC_FB_HEIGHT) {
-        return static_framebuffer[y * FB_WIDTH + x];
+    uint8_t bpp = Convert565_BytesPerPixel(format);
+    const uint8_t* src = pixels + (static_cast<uint32_t>(win.src_y) * stride + win.src_x) * bpp;
+    uint16_t* row_ptr = buffer_ + static_cast<uint32_t>(win.y) * width_ + win.x;
+    for (uint16_t row = 0; row < win.h; row++) {
+        Convert565_Span(row_ptr, src, format, win.w, flags & CONVERT565_DITHER, win.x, win.y + row);
+        src += static_cast<uint32_t>(stride) * bpp;
+        row_ptr += width_;
     }
-    return 0x0000; // Возвращаем черный цвет для недопустимых координат
 }
 
-// Получить указатель на статический буфер
-uint16_t* getStaticFramebuffer() {
-    return static_framebuffer;
-}
+void Framebuffer::fillAlphaMask(int16_t x, int16_t y, uint16_t w, uint16_t h, uint16_t color, const uint8_t* mask,
+                                AlphaFormat format, uint8_t alpha) {
+    CanvasDetail::BlitWindow win;
+    if (mask == nullptr || !blitWindow(x, y, w, h, BLIT_NONE, win)) return;
 
-// Проверить, инициализирован ли статический буфер
-bool isStaticFramebufferInitialized() {
-    return static_framebuffer_initialized;
-}
-
-void flushStaticFramebuffer() {
-    // Эта функция будет вызывать метод дисплея для передачи буфера
-    // Для правильной работы нужно использовать экземпляр ST7789V3
-    // Пока оставляем заглушку - пользователь должен вызывать методы дисплея напрямую
+    uint16_t mask_stride = (format == AlphaFormat::A8) ? w : (w + 1) / 2;
+    const uint8_t* mask_row = mask + win.src_y * mask_stride;
+    uint16_t* row_ptr = buffer_ + static_cast<uint32_t>(win.y) * width_ + win.x;
+    for (uint16_t row = 0; row < win.h; row++) {
+        Blend565_SpanMask(row_ptr, nullptr, color, mask_row, format, static_cast<uint16_t>(win.src_x), win.w, alpha);
+        mask_row += mask_stride;
+        row_ptr += width_;
+    }
 }
 
 // ===================== DMA ФУНКЦИИ =====================
 
-// ===================== DMA ФУНКЦИИ =====================
-
 void waitForDMAComplete() {
     while (!dma_transfer_complete) {
         // Ждем завершения передачи
@@ -378,176 +212,16 @@ void waitForDMAComplete() {
     }
 }
 
-bool isDMABusy() {
-    return !dma_transfer_complete;
-}
-
-// ===================== HAL CALLBACK ФУНКЦИИ =====================
-
-// Callback функция определена в program.cpp
-
-// ===================== ДОПОЛНИТЕЛЬНЫЕ ФУНКЦИИ ДЛЯ РИСОВАНИЯ =====================
-
-// Функции рисования в статическом буфере (простые реализации)
-void drawStaticRect(uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint16_t color) {
-    for (uint16_t i = 0; i < h; i++) {
-        for (uint16_t j = 0; j < w; j++) {
-            setStaticPixel(x + j, y + i, color);
-        }
-    }
-}
-
-void drawStaticLine(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, uint16_t color) {
-    int dx = abs((int)x1 - (int)x0);
-    int dy = abs((int)y1 - (int)y0);
-    int sx = x0 < x1 ? 1 : -1;
-    int sy = y0 < y1 ? 1 : -1;
-    int err = dx - dy;
-    
-    while (true) {
-        setStaticPixel(x0, y0, color);
-        
-        if (x0 == x1 && y0 == y1) break;
-        
-        int e2 = 2 * err;
-        if (e2 > -dy) {
-            err -= dy;
-            x0 += sx;
-        }
-        if (e2 < dx) {
-            err += dx;
-            y0 += sy;
-        }
-    }
-}
-
-// ===================== ФУНКЦИИ ДЛЯ РИСОВАНИЯ ТЕКСТА В СТАТИЧЕСКОМ БУФЕРЕ =====================
-
-void drawStaticChar(uint16_t x, uint16_t y, char ch, uint16_t color, uint16_t bg_color) {
-    if (x + 8 > FB_WIDTH || y + 16 > STATIC_FB_HEIGHT) return;
-    
-    const uint8_t* font_data = Font8x16_GetChar(static_cast<uint8_t>(ch));
-    
-    for (uint8_t row = 0; row < 16; row++) {
-        uint8_t line = font_data[row];
-        for (uint8_t col = 0; col < 8; col++) {
-            uint16_t pixel_color = (line & (0x80 >> col)) ? color : bg_color;
-            if (pixel_color != 0x0000 || bg_color != 0x0000) {
-                setStaticPixel(x + col, y + row, pixel_color);
-            }
-        }
-    }
-}
-
-void drawStaticString(uint16_t x, uint16_t y, const char* str, uint16_t color, uint16_t bg_color) {
-    uint16_t current_x = x;
-    
-    while (*str) {
-        if (current_x + 8 > FB_WIDTH) break;
-        drawStaticChar(current_x, y, *str, color, bg_color);
-        current_x += 8;
-        str++;
+void waitForDMAChunk() {
+    // Часть передается доли миллисекунды: задержка на тик была бы дольше самой передачи
+    while (!dma_transfer_complete) {
     }
 }
 
-void drawStaticStringUTF8(uint16_t x, uint16_t y, const char* utf8_str, uint16_t color, uint16_t bg_color) {
-    uint16_t current_x = x;
-    const char* ptr = utf8_str;
-    
-    while (*ptr) {
-        if (current_x + 8 > FB_WIDTH) break;
-        
-        uint8_t bytes_consumed;
-        const uint8_t* font_data = Font8x16_GetCharUTF8(ptr, &bytes_consumed);
-        
-        // Рисуем символ
-        for (uint8_t row = 0; row < 16; row++) {
-            uint8_t line = font_data[row];
-            for (uint8_t col = 0; col < 8; col++) {
-                uint16_t pixel_color = (line & (0x80 >> col)) ? color : bg_color;
-                if (pixel_color != 0x0000 || bg_color != 0x0000) {
-                    setStaticPixel(current_x + col, y + row, pixel_color);
-                }
-            }
-        }
-        
-        current_x += 8;
-        ptr += bytes_consumed;
-    }
+bool isDMABusy() {
+    return !dma_transfer_complete;
 }
 
-void drawStaticStringScaled(uint16_t x, uint16_t y, const char* str, uint16_t color, uint8_t scale, uint16_t bg_color) {
-    if (scale == 0) scale = 1;
-    if (scale > 8) scale = 8;
-    
-    uint16_t current_x = x;
-    uint16_t char_width = 8 * scale;
-    
-    while (*str) {
-        if (current_x + char_width > FB_WIDTH) break;
-        
-        const uint8_t* font_data = Font8x16_GetChar(static_cast<uint8_t>(*str));
-        
-        // Рисуем увеличенный символ
-        for (uint8_t row = 0; row < 16; row++) {
-            uint8_t line = font_data[row];
-            for (uint8_t col = 0; col < 8; col++) {
-                uint16_t pixel_color = (line & (0x80 >> col)) ? color : bg_color;
-                
-                if (pixel_color != 0x0000 || bg_color != 0x0000) {
-                    for (uint8_t sy = 0; sy < scale; sy++) {
-                        for (uint8_t sx = 0; sx < scale; sx++) {
-                            uint16_t px = current_x + col * scale + sx;
-                            uint16_t py = y + row * scale + sy;
-                            if (px < FB_WIDTH && py < STATIC_FB_HEIGHT) {
-                                setStaticPixel(px, py, pixel_color);
-                            }
-                        }
-                    }
-                }
-            }
-        }
-        
-        current_x += char_width;
-        str++;
-    }
-}
+// ===================== HAL CALLBACK ФУНКЦИИ =====================
 
-void drawStaticStringUTF8Scaled(uint16_t x, uint16_t y, const char* utf8_str, uint16_t color, uint8_t scale, uint16_t bg_color) {
-    if (scale == 0) scale = 1;
-    if (scale > 8) scale = 8;
-    
-    uint16_t current_x = x;
-    uint16_t char_width = 8 * scale;
-    const char* ptr = utf8_str;
-    
-    while (*ptr) {
-        if (current_x + char_width > FB_WIDTH) break;
-        
-        uint8_t bytes_consumed;
-        const uint8_t* font_data = Font8x16_GetCharUTF8(ptr, &bytes_consumed);
-        
-        // Рисуем увеличенный символ
-        for (uint8_t row = 0; row < 16; row++) {
-            uint8_t line = font_data[row];
-            for (uint8_t col = 0; col < 8; col++) {
-                uint16_t pixel_color = (line & (0x80 >> col)) ? color : bg_color;
-                
-                if (pixel_color != 0x0000 || bg_color != 0x0000) {
-                    for (uint8_t sy = 0; sy < scale; sy++) {
-                        for (uint8_t sx = 0; sx < scale; sx++) {
-                            uint16_t px = current_x + col * scale + sx;
-                            uint16_t py = y + row * scale + sy;
-                            if (px < FB_WIDTH && py < STATIC_FB_HEIGHT) {
-                                setStaticPixel(px, py, pixel_color);
-                            }
-                        }
-                    }
-                }
-            }
-        }
-        
-        current_x += char_width;
-        ptr += bytes_consumed;
-    }
-}
+// HAL_SPI_TxCpltCallback определяется в приложении и вызывает ST7789V3_OnDMAComplete()
@@ -3,62 +3,116 @@
 
 #include <cstdint>
 #include "stm32f4xx_hal.h"
+#include "canvas.hpp"
+#include "framebuffer_memory.hpp"
+#include "blend565.hpp"
 
 // Размеры дисплея
 constexpr uint16_t FB_WIDTH = 240;
 constexpr uint16_t FB_HEIGHT = 320;
 constexpr uint32_t FB_SIZE = FB_WIDTH * FB_HEIGHT;
 
-// Максимальный размер статического буфера (64KB = 32K пикселей)
-constexpr uint32_t STATIC_FB_MAX_PIXELS = 32768;
+// Размер статического пула для Framebuffer::init() (по умолчанию 64KB = 32K пикселей, 0 - без пула).
+// Пул и статическая полоса находятся в отдельных единицах трансляции и попадают
+// в прошивку, только если используются init() или функции статической полосы
+#ifndef ST7789V3_FB_POOL_PIXELS
+#define ST7789V3_FB_POOL_PIXELS 32768
+#endif
+
+// Разрешить Framebuffer::init() выделять память через malloc
+#ifndef ST7789V3_FB_USE_MALLOC
+#define ST7789V3_FB_USE_MALLOC 1
+#endif
+
+constexpr uint32_t STATIC_FB_MAX_PIXELS = ST7789V3_FB_POOL_PIXELS;
 constexpr uint16_t STATIC_FB_HEIGHT = 136; // 240 * 136 = 32640 пикселей ≈ 64KB
 
 // Внешние переменные для SPI и DMA
 extern SPI_HandleTypeDef hspi1;
 extern volatile bool dma_transfer_complete;
 
-// Класс буфера кадра
-class Framebuffer {
+// Класс буфера кадра. Все примитивы рисования наследуются от Canvas
+class Framebuffer : public Canvas<Framebuffer> {
+    friend class Canvas<Framebuffer>;
+    friend class ST7789V3;
+    
 private:
     uint16_t* buffer_;
     uint16_t width_;
     uint16_t height_;
     bool allocated_;
     bool use_static_buffer_;
+    bool external_buffer_;
+    bool dma_capable_;
+    
+    // Окно потоковой записи (writeBegin/writePush)
+    uint16_t write_x_;
+    uint16_t write_w_;
+    uint16_t write_col_;
+    uint16_t write_row_;
+    uint16_t write_end_row_;
+    
+    // Статический пул для небольших размеров выдается только одному экземпляру
+    static bool static_buffer_taken_;
     
-    // Статический буфер для небольших размеров
-    static uint16_t static_buffer_[STATIC_FB_MAX_PIXELS];
+    // Методы цели холста (координаты уже отсечены)
+    uint16_t canvasWidth() const { return allocated_ ? width_ : 0; }
+    uint16_t canvasHeight() const { return allocated_ ? height_ : 0; }
+    void writePixel(uint16_t x, uint16_t y, uint16_t color) {
+        buffer_[static_cast<uint32_t>(y) * width_ + x] = color;
+    }
+    void writeFillRect(uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint16_t color);
+    void writeBegin(uint16_t x, uint16_t y, uint16_t w, uint16_t h);
+    void writePush(const uint16_t* pixels, uint32_t count);
+    void writeEnd() {}
+    void writeBlendPixel(uint16_t x, uint16_t y, uint16_t color, uint8_t alpha);
     
 public:
     // Конструктор и деструктор
     Framebuffer(uint16_t width = FB_WIDTH, uint16_t height = FB_HEIGHT);
+    // Буфер поверх памяти вызывающего кода (width * height пикселей), init() не требуется
+    Framebuffer(uint16_t* storage, uint16_t width, uint16_t height);
+    // То же с описанием области памяти; при нехватке размера буфер остается невыделенным
+    Framebuffer(const FramebufferMemory& memory, uint16_t width, uint16_t height);
     ~Framebuffer();
     
-    // Управление буфером
+    // Управление буфером. init() берет память из статического пула или malloc
+    // (для буфера поверх внешней памяти только возвращает isAllocated())
     bool init();
     void clear(uint16_t color = 0x0000);
     void release();
     
-    // Основные операции рисования
-    void setPixel(uint16_t x, uint16_t y, uint16_t color);
+    // Основные операции рисования (примитивы и текст - см. Canvas)
+    void setPixel(int16_t x, int16_t y, uint16_t color) { drawPixel(x, y, color); }
     uint16_t getPixel(uint16_t x, uint16_t y) const;
     
-    // Геометрические примитивы
-    void drawLine(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, uint16_t color);
-    void drawRect(uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint16_t color);
-    void fillRect(uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint16_t color);
-    void drawCircle(uint16_t x0, uint16_t y0, uint16_t r, uint16_t color);
-    void fillCircle(uint16_t x0, uint16_t y0, uint16_t r, uint16_t color);
+    // Полупрозрачное рисование (alpha 0..255, 255 - непрозрачно) с отсечением по области отсечения.
+    // Маска прозрачности A4/A8 задается на каждый пиксель изображения w x h и умножается на alpha
+    void fillRectAlpha(int16_t x, int16_t y, uint16_t w, uint16_t h, uint16_t color, uint8_t alpha);
+    void blitAlpha(int16_t x, int16_t y, uint16_t w, uint16_t h, const uint16_t* pixels, uint8_t alpha,
+                   uint16_t stride = 0);
+    void blitAlpha(int16_t x, int16_t y, uint16_t w, uint16_t h, const uint16_t* pixels, const uint8_t* mask,
+                   AlphaFormat format, uint8_t alpha = 255, uint16_t stride = 0);
+    // Заливка цветом через маску прозрачности (тени, сглаженные значки)
+    void fillAlphaMask(int16_t x, int16_t y, uint16_t w, uint16_t h, uint16_t color, const uint8_t* mask,
+                       AlphaFormat format, uint8_t alpha = 255);
     
-    // Текст
-    void drawChar(uint16_t x, uint16_t y, char ch, uint16_t color, uint16_t bg_color = 0x0000);
-    void drawString(uint16_t x, uint16_t y, const char* str, uint16_t color, uint16_t bg_color = 0x0000);
-    void drawStringUTF8(uint16_t x, uint16_t y, const char* utf8_str, uint16_t color, uint16_t bg_color = 0x0000);
+    // Изображение в другом формате (см. Canvas::blitConverted): строки преобразуются
+    // прямо в буфер, без строчного буфера и копирования
+    void blitConverted(int16_t x, int16_t y, uint16_t w, uint16_t h, const uint8_t* pixels, PixelFormat format,
+                       uint8_t flags = CONVERT565_NONE, uint16_t stride = 0);
     
-    // Масштабированный текст
-    void drawCharScaled(uint16_t x, uint16_t y, char ch, uint16_t color, uint8_t scale, uint16_t bg_color = 0x0000);
-    void drawStringScaled(uint16_t x, uint16_t y, const char* str, uint16_t color, uint8_t scale, uint16_t bg_color = 0x0000);
-    void drawStringUTF8Scaled(uint16_t x, uint16_t y, const char* utf8_str, uint16_t color, uint8_t scale, uint16_t bg_color = 0x0000);
+    // Сглаженные линии и окружности (framebuffer_aa.cpp): покрытие пикселей смешивается
+    // с содержимым буфера, полностью закрытые отрезки строк заливаются целиком.
+    // Учитывают область отсечения Canvas (pushClipRect).
+    // width - толщина в пикселях; углы дуги в градусах: 0 - вверх, по часовой стрелке.
+    // Радиус окружностей - до 1000 пикселей
+    void drawLineAA(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color);
+    void drawThickLineAA(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint8_t width, uint16_t color);
+    void drawCircleAA(int16_t x0, int16_t y0, uint16_t r, uint16_t color, uint8_t width = 1);
+    void fillCircleAA(int16_t x0, int16_t y0, uint16_t r, uint16_t color);
+    void drawArcAA(int16_t x0, int16_t y0, uint16_t r, int16_t start_angle, int16_t end_angle,
+                   uint8_t width, uint16_t color);
     
     // Доступ к буферу
     const uint16_t* getBuffer() const { return buffer_; }
@@ -67,6 +121,7 @@ public:
     uint16_t getWidth() const { return width_; }
     uint16_t getHeight() const { return height_; }
     bool isAllocated() const { return allocated_; }
+    bool isDMACapable() const { return dma_capable_; }  // Иначе передача идет без DMA
       // Утилиты
     static uint16_t rgb565(uint8_t r, uint8_t g, uint8_t b);
 };
@@ -77,11 +132,14 @@ void clearStaticFramebuffer(uint16_t color = 0x0000);
 void setStaticPixel(uint16_t x, uint16_t y, uint16_t color);
 uint16_t getStaticPixel(uint16_t x, uint16_t y);
 uint16_t* getStaticFramebuffer();
+Framebuffer& getStaticCanvas();     // Статическая полоса как холст (все примитивы Canvas)
 bool isStaticFramebufferInitialized();
 void flushStaticFramebuffer();
 
 // DMA функции (примечание: простая реализация находится в program.cpp)
 void waitForDMAComplete();
+// Ожидание короткой части передачи (строка, кусок сбора) опросом флага без HAL_Delay
+void waitForDMAChunk();
 bool isDMABusy();
 
 // Дополнительные функции рисования
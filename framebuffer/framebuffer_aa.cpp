@@ -0,0 +1,291 @@
+#include "framebuffer.hpp"
+#include "fixed_math.hpp"
+#include <algorithm>
+#include <cstdlib>
+
+// Сглаженные примитивы буфера кадра. Вся арифметика целочисленная:
+// линии Ву - в формате 16.16, толстые линии - расстояния в Q12,
+// окружности - расстояния в 1/32 пикселя (точность смешивания Blend565 - тоже 5 бит)
+
+namespace {
+
+constexpr int32_t AA_ONE = 32;      // Полное покрытие окружностей (1/32 пикселя)
+constexpr int32_t AA_HALF = 16;
+constexpr int32_t LINE_ONE = 4096;  // Полное покрытие толстых линий (Q12)
+
+// Радиус, при котором (dx*dx + dy*dy) << 10 еще помещается в 32 бита
+constexpr uint16_t AA_MAX_RADIUS = 1000;
+
+// Буфер и область отсечения Canvas: столбцы [x0, x1), строки [y0, y1)
+struct AATarget {
+    uint16_t* buffer;
+    int32_t stride;
+    int32_t x0;
+    int32_t y0;
+    int32_t x1;
+    int32_t y1;
+    uint16_t color;
+};
+
+inline AATarget aaTarget(uint16_t* buffer, uint16_t stride, const CanvasClip& clip, uint16_t color) {
+    return {buffer, stride, clip.x0, clip.y0, clip.x1, clip.y1, color};
+}
+
+inline void aaPixel(const AATarget& t, int32_t x, int32_t y, uint8_t alpha) {
+    if (alpha == 0 || x < t.x0 || y < t.y0 || x >= t.x1 || y >= t.y1) return;
+    uint16_t& pixel = t.buffer[y * t.stride + x];
+    pixel = Blend565_Pixel(t.color, pixel, alpha);
+}
+
+// Непрозрачный отрезок [x0, x1] строки y с отсечением
+inline void aaSpan(const AATarget& t, int32_t x0, int32_t x1, int32_t y) {
+    if (y < t.y0 || y >= t.y1) return;
+    x0 = std::max<int32_t>(x0, t.x0);
+    x1 = std::min<int32_t>(x1, t.x1 - 1);
+    if (x0 > x1) return;
+    std::fill_n(t.buffer + y * t.stride + x0, x1 - x0 + 1, t.color);
+}
+
+inline uint8_t coverageAlpha(int32_t coverage, int32_t one, uint8_t shift) {
+    if (coverage >= one) return 255;
+    return (coverage <= 0) ? 0 : static_cast<uint8_t>(coverage << shift);
+}
+
+// Ограничение дуги двумя лучами из центра (направления в Q14)
+struct ArcLimits {
+    int32_t start_x;
+    int32_t start_y;
+    int32_t end_x;
+    int32_t end_y;
+    bool wide;      // Больше 180 градусов: объединение полуплоскостей, иначе пересечение
+};
+
+inline int32_t arcCoverage(const ArcLimits& arc, int32_t dx, int32_t dy) {
+    // Расстояния до лучей со знаком (внутри дуги - положительные), в 1/32 пикселя
+    int32_t c0 = ((arc.start_x * dy - arc.start_y * dx) >> 9) + AA_HALF;
+    int32_t c1 = ((dx * arc.end_y - dy * arc.end_x) >> 9) + AA_HALF;
+    return arc.wide ? std::max(c0, c1) : std::min(c0, c1);
+}
+
+// Кольцо inner32 < d < outer32 (в 1/32 пикселя; inner32 < 0 - круг) с необязательной дугой.
+// По строкам: полностью закрытые пиксели заливаются отрезками, покрытие считается только на краях
+void ringAA(const AATarget& t, int32_t cx, int32_t cy, int32_t inner32, int32_t outer32, const ArcLimits* arc) {
+    int32_t reach = (outer32 + AA_HALF) / AA_ONE + 1;
+    int32_t y_start = std::max<int32_t>(cy - reach, t.y0);
+    int32_t y_end = std::min<int32_t>(cy + reach, t.y1 - 1);
+
+    // Квадраты границ зон в пикселях
+    int32_t outer_reach2 = ((outer32 + AA_HALF) * (outer32 + AA_HALF) + 1023) / 1024;
+    int32_t outer_full2 = (outer32 >= AA_HALF) ? (outer32 - AA_HALF) * (outer32 - AA_HALF) / 1024 : -1;
+    int32_t inner_full2 = (inner32 >= 0) ? ((inner32 + AA_HALF) * (inner32 + AA_HALF) + 1023) / 1024 : 0;
+    int32_t inner_zero2 = (inner32 >= AA_HALF) ? (inner32 - AA_HALF) * (inner32 - AA_HALF) / 1024 : -1;
+
+    auto coverage = [&](int32_t dx, int32_t dy) {
+        int32_t d32 = static_cast<int32_t>(FixedMath_Sqrt(static_cast<uint32_t>(dx * dx + dy * dy) << 10));
+        int32_t c = outer32 + AA_HALF - d32;
+        if (inner32 >= 0) c = std::min(c, d32 - inner32 + AA_HALF);
+        if (arc != nullptr) c = std::min(c, arcCoverage(*arc, dx, dy));
+        return c;
+    };
+
+    // Край: покрытие каждого пикселя
+    auto edge = [&](int32_t from, int32_t to, int32_t dy) {
+        from = std::max(from, t.x0 - cx);
+        to = std::min(to, t.x1 - 1 - cx);
+        for (int32_t dx = from; dx <= to; dx++) {
+            aaPixel(t, cx + dx, cy + dy, coverageAlpha(coverage(dx, dy), AA_ONE, 3));
+        }
+    };
+
+    // Полностью закрытая часть кольца; дуга режет ее по лучам
+    auto full = [&](int32_t from, int32_t to, int32_t dy) {
+        if (arc == nullptr) {
+            aaSpan(t, cx + from, cx + to, cy + dy);
+            return;
+        }
+        from = std::max(from, t.x0 - cx);
+        to = std::min(to, t.x1 - 1 - cx);
+        int32_t run = from;
+        for (int32_t dx = from; dx <= to + 1; dx++) {
+            int32_t c = (dx <= to) ? arcCoverage(*arc, dx, dy) : 0;
+            if (c >= AA_ONE) continue;
+            if (dx > run) aaSpan(t, cx + run, cx + dx - 1, cy + dy);
+            if (dx <= to) aaPixel(t, cx + dx, cy + dy, coverageAlpha(c, AA_ONE, 3));
+            run = dx + 1;
+        }
+    };
+
+    for (int32_t y = y_start; y <= y_end; y++) {
+        int32_t dy = y - cy;
+        int32_t dy2 = dy * dy;
+        if (dy2 >= outer_reach2) continue;
+
+        // |dx| <= xo: покрытие может быть ненулевым; xfi <= |dx| <= xfo: полное; |dx| <= xh: нулевое
+        int32_t xo = static_cast<int32_t>(FixedMath_Sqrt(static_cast<uint32_t>(outer_reach2 - dy2))) + 1;
+        int32_t xfo = (outer_full2 >= dy2) ? static_cast<int32_t>(FixedMath_Sqrt(static_cast<uint32_t>(outer_full2 - dy2))) : -1;
+        int32_t xfi = static_cast<int32_t>(FixedMath_CeilSqrt(inner_full2 - dy2));
+        int32_t xh = (inner_zero2 >= dy2) ? static_cast<int32_t>(FixedMath_Sqrt(static_cast<uint32_t>(inner_zero2 - dy2))) : -1;
+
+        if (xfo < xfi) {
+            if (xh < 0) {
+                edge(-xo, xo, dy);
+            } else {
+                edge(-xo, -xh - 1, dy);
+                edge(xh + 1, xo, dy);
+            }
+            continue;
+        }
+
+        edge(-xo, -xfo - 1, dy);
+        if (xfi == 0) {
+            full(-xfo, xfo, dy);
+        } else {
+            full(-xfo, -xfi, dy);
+            if (xh < 0) {
+                edge(-xfi + 1, xfi - 1, dy);
+            } else {
+                edge(-xfi + 1, -xh - 1, dy);
+                edge(xh + 1, xfi - 1, dy);
+            }
+            full(xfi, xfo, dy);
+        }
+        edge(xfo + 1, xo, dy);
+    }
+}
+
+} // namespace
+
+void Framebuffer::drawLineAA(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color) {
+    if (!allocated_) return;
+    AATarget t = aaTarget(buffer_, width_, getClipRect(), color);
+
+    // Горизонтальная линия - одним отрезком
+    if (y0 == y1) {
+        aaSpan(t, std::min(x0, x1), std::max(x0, x1), y0);
+        return;
+    }
+
+    // Линия Ву: вдоль главной оси по пикселю, по второй оси - два пикселя с долями покрытия
+    bool steep = abs(y1 - y0) > abs(x1 - x0);
+    int32_t a0 = steep ? y0 : x0;
+    int32_t b0 = steep ? x0 : y0;
+    int32_t a1 = steep ? y1 : x1;
+    int32_t b1 = steep ? x1 : y1;
+    if (a0 > a1) {
+        std::swap(a0, a1);
+        std::swap(b0, b1);
+    }
+
+    int32_t gradient = static_cast<int32_t>((static_cast<int64_t>(b1 - b0) * 65536) / (a1 - a0));
+    int32_t a_start = std::max<int32_t>(a0, steep ? t.y0 : t.x0);
+    int32_t a_end = std::min<int32_t>(a1, (steep ? t.y1 : t.x1) - 1);
+    if (a_start > a_end) return;
+
+    int32_t inter = static_cast<int32_t>((static_cast<int64_t>(b0) * 65536) + static_cast<int64_t>(gradient) * (a_start - a0));
+    for (int32_t a = a_start; a <= a_end; a++) {
+        int32_t b = inter >> 16;
+        uint8_t frac = static_cast<uint8_t>(inter >> 8);
+        if (steep) {
+            aaPixel(t, b, a, 255 - frac);
+            aaPixel(t, b + 1, a, frac);
+        } else {
+            aaPixel(t, a, b, 255 - frac);
+            aaPixel(t, a, b + 1, frac);
+        }
+        inter += gradient;
+    }
+}
+
+void Framebuffer::drawThickLineAA(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint8_t width, uint16_t color) {
+    if (!allocated_) return;
+    if (width <= 1) {
+        drawLineAA(x0, y0, x1, y1, color);
+        return;
+    }
+    AATarget t = aaTarget(buffer_, width_, getClipRect(), color);
+
+    // Единичный вектор направления в Q12 (точка - направление по оси X)
+    int32_t dx = x1 - x0;
+    int32_t dy = y1 - y0;
+    uint32_t len16 = FixedMath_Length16(dx, dy);
+    int32_t ux = LINE_ONE;
+    int32_t uy = 0;
+    if (len16 != 0) {
+        ux = static_cast<int32_t>((static_cast<int64_t>(dx) * LINE_ONE * 16) / len16);
+        uy = static_cast<int32_t>((static_cast<int64_t>(dy) * LINE_ONE * 16) / len16);
+    }
+
+    // Прямоугольник из четырех полуплоскостей; покрытие пикселя - минимум по ним.
+    // s - расстояние поперек линии, t - вдоль; торцы продлены на полпикселя
+    int32_t radius = width * (LINE_ONE / 2) + LINE_ONE / 2;
+    int32_t length = static_cast<int32_t>(len16) * (LINE_ONE / 16);
+    int32_t reach = width / 2 + 2;
+
+    int32_t y_start = std::max<int32_t>(std::min(y0, y1) - reach, t.y0);
+    int32_t y_end = std::min<int32_t>(std::max(y0, y1) + reach, t.y1 - 1);
+
+    for (int32_t y = y_start; y <= y_end; y++) {
+        int32_t ry = y - y0;
+        // c(rx) = a * rx + b для каждой стороны
+        int32_t a[4] = {uy, -uy, ux, -ux};
+        int32_t b[4] = {radius - ux * ry, radius + ux * ry, uy * ry + LINE_ONE, length + LINE_ONE - uy * ry};
+
+        int32_t lo = t.x0 - x0;
+        int32_t hi = t.x1 - 1 - x0;
+        int32_t full_lo = lo;
+        int32_t full_hi = hi;
+        for (uint8_t k = 0; k < 4; k++) {
+            FixedMath_LimitRange(a[k], b[k], 1, lo, hi);
+            FixedMath_LimitRange(a[k], b[k], LINE_ONE, full_lo, full_hi);
+        }
+        if (lo > hi) continue;
+
+        auto edge = [&](int32_t from, int32_t to) {
+            for (int32_t rx = from; rx <= to; rx++) {
+                int32_t c = LINE_ONE;
+                for (uint8_t k = 0; k < 4; k++) {
+                    c = std::min(c, a[k] * rx + b[k]);
+                }
+                aaPixel(t, x0 + rx, y, coverageAlpha(c >> 4, 256, 0));
+            }
+        };
+
+        full_lo = std::max(full_lo, lo);
+        full_hi = std::min(full_hi, hi);
+        if (full_lo > full_hi) {
+            edge(lo, hi);
+        } else {
+            edge(lo, full_lo - 1);
+            aaSpan(t, x0 + full_lo, x0 + full_hi, y);
+            edge(full_hi + 1, hi);
+        }
+    }
+}
+
+void Framebuffer::drawCircleAA(int16_t x0, int16_t y0, uint16_t r, uint16_t color, uint8_t width) {
+    if (!allocated_ || r > AA_MAX_RADIUS || width == 0) return;
+    AATarget t = aaTarget(buffer_, width_, getClipRect(), color);
+    ringAA(t, x0, y0, r * AA_ONE - width * AA_HALF, r * AA_ONE + width * AA_HALF, nullptr);
+}
+
+void Framebuffer::fillCircleAA(int16_t x0, int16_t y0, uint16_t r, uint16_t color) {
+    if (!allocated_ || r > AA_MAX_RADIUS) return;
+    AATarget t = aaTarget(buffer_, width_, getClipRect(), color);
+    ringAA(t, x0, y0, -1, r * AA_ONE + AA_HALF, nullptr);
+}
+
+void Framebuffer::drawArcAA(int16_t x0, int16_t y0, uint16_t r, int16_t start_angle, int16_t end_angle,
+                            uint8_t width, uint16_t color) {
+    if (!allocated_ || r > AA_MAX_RADIUS || width == 0) return;
+    AATarget t = aaTarget(buffer_, width_, getClipRect(), color);
+
+    int32_t sweep = (end_angle - start_angle) % 360;
+    if (sweep < 0) sweep += 360;
+    if (sweep == 0 && end_angle != start_angle) sweep = 360;
+    if (sweep == 0) return;
+
+    // Направление угла: 0 - вверх, по часовой стрелке
+    ArcLimits arc = {FixedMath_Sin(start_angle), -FixedMath_Cos(start_angle),
+                     FixedMath_Sin(end_angle), -FixedMath_Cos(end_angle), sweep > 180};
+    ringAA(t, x0, y0, r * AA_ONE - width * AA_HALF, r * AA_ONE + width * AA_HALF, (sweep == 360) ? nullptr : &arc);
+}
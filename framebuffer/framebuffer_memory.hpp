@@ -0,0 +1,48 @@
+#ifndef FRAMEBUFFER_MEMORY_HPP
+#define FRAMEBUFFER_MEMORY_HPP
+
+#include <cstdint>
+
+// Выравнивание памяти буфера кадра (32 байта - строка кэша Cortex-M7, достаточно и для DMA)
+#ifndef ST7789V3_FB_ALIGNMENT
+#define ST7789V3_FB_ALIGNMENT 32
+#endif
+
+// Минимальное выравнивание, при котором буфер передается через DMA
+constexpr uint32_t FB_DMA_MIN_ALIGNMENT = 4;
+
+// Размещение памяти буфера в секции компоновщика (".ccmram", ".sram2", ".ext_sram" и т.п.).
+// Секция должна быть описана в скрипте компоновщика проекта
+#define ST7789V3_FB_ALIGNED __attribute__((aligned(ST7789V3_FB_ALIGNMENT)))
+#define ST7789V3_FB_SECTION(section_name) __attribute__((section(section_name), aligned(ST7789V3_FB_ALIGNMENT)))
+
+// Объявление памяти буфера кадра в заданной секции:
+//   ST7789V3_FB_STORAGE(ccm_fb, 240, 100, ".ccmram");
+#define ST7789V3_FB_STORAGE(name, width, height, section_name) \
+    uint16_t name[static_cast<uint32_t>(width) * (height)] ST7789V3_FB_SECTION(section_name)
+
+// Тип области памяти
+enum class FramebufferMemoryType : uint8_t {
+    SRAM,       // Основная SRAM
+    SRAM2,      // Дополнительный банк SRAM
+    CCM,        // CCM RAM (STM32F4: недоступна для DMA)
+    DTCM,       // DTCM RAM (на STM32H7 недоступна для DMA1/DMA2)
+    EXTERNAL    // Внешняя SRAM/SDRAM через FMC
+};
+
+// Описание памяти буфера кадра, предоставленной вызывающим кодом
+struct FramebufferMemory {
+    uint16_t* base;
+    uint32_t size_bytes;
+    FramebufferMemoryType type;
+};
+
+// Можно ли передавать буфер из этой области через DMA
+inline bool FramebufferMemory_IsDMACapable(const FramebufferMemory& memory) {
+    if (memory.type == FramebufferMemoryType::CCM || memory.type == FramebufferMemoryType::DTCM) {
+        return false;
+    }
+    return (reinterpret_cast<uintptr_t>(memory.base) % FB_DMA_MIN_ALIGNMENT) == 0;
+}
+
+#endif
@@ -0,0 +1,100 @@
+#include "framebuffer_pair.hpp"
+#include "st7789v3.hpp"
+#include <algorithm>
+#include <cstring>
+
+FramebufferPair::FramebufferPair(uint16_t width, uint16_t height, bool copy_forward)
+    : first_(width, height), second_(width, height), front_(&first_), back_(&second_),
+      copy_forward_(copy_forward), damage_count_(0) {
+}
+
+FramebufferPair::FramebufferPair(const FramebufferMemory& first, const FramebufferMemory& second,
+                                 uint16_t width, uint16_t height, bool copy_forward)
+    : first_(first, width, height), second_(second, width, height), front_(&first_), back_(&second_),
+      copy_forward_(copy_forward), damage_count_(0) {
+}
+
+bool FramebufferPair::init() {
+    if (!first_.init() || !second_.init()) {
+        release();
+        return false;
+    }
+    damage_count_ = 0;
+    return true;
+}
+
+void FramebufferPair::release() {
+    // Передний буфер может еще читаться DMA
+    waitForDMAComplete();
+    first_.release();
+    second_.release();
+    damage_count_ = 0;
+}
+
+void FramebufferPair::markDamaged(uint16_t x, uint16_t y, uint16_t w, uint16_t h) {
+    uint16_t width = back_->getWidth();
+    uint16_t height = back_->getHeight();
+    if (x >= width || y >= height || w == 0 || h == 0) return;
+    if (w > width - x) w = width - x;
+    if (h > height - y) h = height - y;
+
+    if (damage_count_ < FRAMEBUFFER_PAIR_MAX_DAMAGE) {
+        damage_[damage_count_++] = {x, y, w, h};
+        return;
+    }
+
+    // Переполнение: все области объединяются в один охватывающий прямоугольник
+    uint16_t x0 = x, y0 = y;
+    uint16_t x1 = x + w, y1 = y + h;
+    for (uint8_t i = 0; i < damage_count_; i++) {
+        x0 = std::min(x0, damage_[i].x);
+        y0 = std::min(y0, damage_[i].y);
+        x1 = std::max<uint16_t>(x1, damage_[i].x + damage_[i].w);
+        y1 = std::max<uint16_t>(y1, damage_[i].y + damage_[i].h);
+    }
+    damage_[0] = {x0, y0, static_cast<uint16_t>(x1 - x0), static_cast<uint16_t>(y1 - y0)};
+    damage_count_ = 1;
+}
+
+void FramebufferPair::copyDamageForward() {
+    // Новый задний буфер отстает на один кадр: переносим в него изменения этого кадра.
+    // DMA в это время тоже только читает передний буфер
+    const uint16_t* src = front_->getBuffer();
+    uint16_t* dst = back_->getBuffer();
+    uint16_t width = front_->getWidth();
+
+    for (uint8_t i = 0; i < damage_count_; i++) {
+        const DamageRect& rect = damage_[i];
+        uint32_t offset = static_cast<uint32_t>(rect.y) * width + rect.x;
+        for (uint16_t row = 0; row < rect.h; row++) {
+            memcpy(dst + offset, src + offset, rect.w * sizeof(uint16_t));
+            offset += width;
+        }
+    }
+}
+
+void FramebufferPair::swap(ST7789V3& display) {
+    if (!isAllocated()) return;
+
+    // Предыдущий кадр еще передается из буфера, который станет задним
+    waitForDMAComplete();
+
+    Framebuffer* drawn = back_;
+    back_ = front_;
+    front_ = drawn;
+
+    if (display.getFramebuffer() == drawn) {
+        display.setFramebuffer(back_);
+    }
+
+    if (front_->isDMACapable()) {
+        display.flushStaticBufferDMA(front_->getBuffer(), front_->getWidth(), front_->getHeight());
+    } else {
+        display.flushStaticBuffer(front_->getBuffer(), front_->getWidth(), front_->getHeight());
+    }
+
+    if (copy_forward_) {
+        copyDamageForward();
+    }
+    damage_count_ = 0;
+}
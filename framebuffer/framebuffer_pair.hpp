@@ -0,0 +1,61 @@
+#ifndef FRAMEBUFFER_PAIR_HPP
+#define FRAMEBUFFER_PAIR_HPP
+
+#include <cstdint>
+#include "framebuffer.hpp"
+
+class ST7789V3;
+
+// Максимальное количество поврежденных областей за кадр (при переполнении они объединяются)
+constexpr uint8_t FRAMEBUFFER_PAIR_MAX_DAMAGE = 8;
+
+// Пара буферов кадра для двойной буферизации.
+// Рисование идет в задний буфер, пока передний передается на дисплей через DMA.
+// swap() ждет только окончания предыдущей передачи, меняет буферы местами
+// и запускает DMA нового переднего буфера без копирования кадра.
+// Если включен перенос (copy forward), в новый задний буфер копируются только
+// отмеченные за кадр области, и следующий кадр можно дорисовывать поверх предыдущего.
+class FramebufferPair {
+private:
+    struct DamageRect {
+        uint16_t x;
+        uint16_t y;
+        uint16_t w;
+        uint16_t h;
+    };
+
+    Framebuffer first_;
+    Framebuffer second_;
+    Framebuffer* front_;
+    Framebuffer* back_;
+    bool copy_forward_;
+    uint8_t damage_count_;
+    DamageRect damage_[FRAMEBUFFER_PAIR_MAX_DAMAGE];
+
+    void copyDamageForward();
+
+public:
+    FramebufferPair(uint16_t width = FB_WIDTH, uint16_t height = FB_HEIGHT, bool copy_forward = false);
+    // Пара поверх памяти вызывающего кода (init() не требуется)
+    FramebufferPair(const FramebufferMemory& first, const FramebufferMemory& second,
+                    uint16_t width = FB_WIDTH, uint16_t height = FB_HEIGHT, bool copy_forward = false);
+
+    // Выделение обоих буферов (каждый получает собственную память)
+    bool init();
+    void release();
+    bool isAllocated() const { return first_.isAllocated() && second_.isAllocated(); }
+
+    // Задний буфер - для рисования, передний - передается на дисплей
+    Framebuffer& back() { return *back_; }
+    const Framebuffer& front() const { return *front_; }
+
+    // Область, измененная в заднем буфере за текущий кадр (для переноса)
+    void markDamaged(uint16_t x, uint16_t y, uint16_t w, uint16_t h);
+    void setCopyForward(bool enable) { copy_forward_ = enable; }
+
+    // Показать нарисованный кадр. Если к дисплею подключен задний буфер,
+    // подключение переводится на новый задний буфер
+    void swap(ST7789V3& display);
+};
+
+#endif
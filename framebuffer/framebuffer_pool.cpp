@@ -0,0 +1,51 @@
+#include "framebuffer.hpp"
+#include <cstdlib>
+
+// Статический пул и malloc нужны только Framebuffer::init(). Эта единица трансляции
+// не попадает в прошивку, если все буферы создаются поверх памяти вызывающего кода
+#if ST7789V3_FB_POOL_PIXELS > 0
+static uint16_t static_buffer[ST7789V3_FB_POOL_PIXELS] ST7789V3_FB_ALIGNED;
+#endif
+
+bool Framebuffer::init() {
+    if (allocated_) {
+        return true; // Уже инициализирован
+    }
+    if (external_buffer_) {
+        return false; // Внешней памяти не хватило при создании
+    }
+    
+    uint32_t total_pixels = static_cast<uint32_t>(width_) * height_;
+    
+#if ST7789V3_FB_POOL_PIXELS > 0
+    // Статический буфер можно использовать, если он не занят другим экземпляром
+    if (total_pixels <= STATIC_FB_MAX_PIXELS && !static_buffer_taken_) {
+        buffer_ = static_buffer;
+        static_buffer_taken_ = true;
+        use_static_buffer_ = true;
+        dma_capable_ = true;
+        allocated_ = true;
+        clear(); // Очищаем буфер
+        return true;
+    }
+#endif
+    
+#if ST7789V3_FB_USE_MALLOC
+    // Пытаемся выделить динамический буфер
+    uint32_t buffer_size = total_pixels * sizeof(uint16_t);
+    buffer_ = static_cast<uint16_t*>(malloc(buffer_size));
+    
+    if (buffer_ == nullptr) {
+        return false; // Не удалось выделить память
+    }
+    
+    use_static_buffer_ = false;
+    dma_capable_ = true;
+    allocated_ = true;
+    clear(); // Очищаем буфер
+    return true;
+#else
+    (void)total_pixels;
+    return false; // Динамическое выделение отключено
+#endif
+}
@@ -0,0 +1,243 @@
+#include "label_cache.hpp"
+#include "framebuffer.hpp"
+#include "../fonts/font8x16.hpp"
+#include "../fonts/prop_font.hpp"
+#include "../fonts/color_ramp.hpp"
+#include <algorithm>
+#include <cstring>
+
+namespace {
+
+// FNV-1a по байтам строки
+uint32_t hashString(const char* str) {
+    uint32_t hash = 2166136261u;
+    while (*str) {
+        hash ^= static_cast<uint8_t>(*str++);
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+// Размер копии строки в арене (в пикселях, с завершающим нулем)
+uint32_t textPixels(const char* str) {
+    return static_cast<uint32_t>(strlen(str) + 2) / 2;
+}
+
+} // namespace
+
+LabelCache::LabelCache(uint16_t* arena, uint32_t arena_pixels)
+    : arena_(arena), arena_size_(arena_pixels), arena_used_(0), clock_(0), hits_(0), misses_(0), entries_() {
+}
+
+void LabelCache::clear() {
+    for (uint8_t i = 0; i < LABEL_CACHE_MAX_ENTRIES; i++) {
+        entries_[i].used = false;
+    }
+    arena_used_ = 0;
+}
+
+LabelCache::Entry* LabelCache::find(uint32_t hash, const char* utf8_str, const PropFont* font, uint8_t scale, uint16_t color, uint16_t bg_color) {
+    for (uint8_t i = 0; i < LABEL_CACHE_MAX_ENTRIES; i++) {
+        Entry& entry = entries_[i];
+        if (!entry.used || entry.hash != hash || entry.font != font || entry.scale != scale ||
+            entry.color != color || entry.bg_color != bg_color) {
+            continue;
+        }
+        
+        // Копия строки лежит сразу за пикселями блока
+        const char* stored = reinterpret_cast<const char*>(
+            arena_ + entry.offset + static_cast<uint32_t>(entry.width) * entry.height);
+        if (strcmp(stored, utf8_str) == 0) {
+            return &entry;
+        }
+    }
+    return nullptr;
+}
+
+void LabelCache::evict(Entry* entry) {
+    // Уплотняем арену: блоки после вытесняемого сдвигаются на его место
+    uint32_t end = entry->offset + entry->size;
+    memmove(arena_ + entry->offset, arena_ + end, (arena_used_ - end) * sizeof(uint16_t));
+    
+    for (uint8_t i = 0; i < LABEL_CACHE_MAX_ENTRIES; i++) {
+        if (entries_[i].used && entries_[i].offset >= end) {
+            entries_[i].offset -= entry->size;
+        }
+    }
+    
+    arena_used_ -= entry->size;
+    entry->used = false;
+}
+
+LabelCache::Entry* LabelCache::allocate(uint32_t size) {
+    if (size > arena_size_) {
+        return nullptr;
+    }
+    
+    while (true) {
+        Entry* free_entry = nullptr;
+        Entry* oldest = nullptr;
+        for (uint8_t i = 0; i < LABEL_CACHE_MAX_ENTRIES; i++) {
+            Entry& entry = entries_[i];
+            if (!entry.used) {
+                if (free_entry == nullptr) free_entry = &entry;
+            } else if (oldest == nullptr || entry.last_used < oldest->last_used) {
+                oldest = &entry;
+            }
+        }
+        
+        if (free_entry != nullptr && arena_used_ + size <= arena_size_) {
+            free_entry->offset = arena_used_;
+            free_entry->size = size;
+            arena_used_ += size;
+            return free_entry;
+        }
+        
+        if (oldest == nullptr) {
+            return nullptr;
+        }
+        evict(oldest);
+    }
+}
+
+void LabelCache::render(const Entry& entry, const char* utf8_str) {
+    uint16_t* block = arena_ + entry.offset;
+    uint32_t block_pixels = static_cast<uint32_t>(entry.width) * entry.height;
+    std::fill_n(block, block_pixels, entry.bg_color);
+    
+    const char* ptr = utf8_str;
+    uint32_t current_x = 0;
+    
+    if (entry.font == nullptr) {
+        // Встроенный шрифт: строка глифа разворачивается один раз и копируется scale раз.
+        // Глифы за шириной блока обрезаются, чтобы не задеть соседний блок и копию строки
+        uint8_t scale = entry.scale;
+        const uint8_t* glyphs[FONT8X16_GLYPH_BATCH];
+        while (*ptr && current_x < entry.width) {
+            uint8_t count = Font8x16_GetGlyphs(&ptr, glyphs, FONT8X16_GLYPH_BATCH);
+            for (uint8_t i = 0; i < count && current_x < entry.width; i++) {
+                uint32_t cols = std::min<uint32_t>(FONT8X16_WIDTH * scale, entry.width - current_x);
+                for (uint8_t row = 0; row < FONT8X16_HEIGHT; row++) {
+                    uint16_t* dst = block + static_cast<uint32_t>(row) * scale * entry.width + current_x;
+                    uint8_t line = glyphs[i][row];
+                    for (uint32_t col = 0; col * scale < cols; col++) {
+                        if (line & (0x80 >> col)) {
+                            std::fill_n(dst + col * scale, std::min<uint32_t>(scale, cols - col * scale), entry.color);
+                        }
+                    }
+                    for (uint8_t sy = 1; sy < scale; sy++) {
+                        memcpy(dst + static_cast<uint32_t>(sy) * entry.width, dst, cols * sizeof(uint16_t));
+                    }
+                }
+                current_x += FONT8X16_WIDTH * scale;
+            }
+        }
+    } else {
+        const PropFont* font = entry.font;
+        const uint16_t* ramp = ColorRamp_Get(entry.color, entry.bg_color, font->bpp);
+        while (*ptr) {
+            uint8_t bytes_consumed;
+            const PropGlyph* glyph = PropFont_GetGlyphUTF8(font, ptr, &bytes_consumed);
+            const uint8_t* bitmap = PropFont_GetBitmap(font, glyph);
+            uint8_t row_bytes = PropFont_RowBytes(font, glyph);
+            
+            // Блок - сумма advance x line_height: ink box, выходящий за шаг последнего глифа
+            // или ниже строки, обрезается, чтобы не задеть соседний блок и копию строки
+            int32_t ink_x = static_cast<int32_t>(current_x) + glyph->x_offset;
+            int32_t cols = std::min<int32_t>(glyph->width, static_cast<int32_t>(entry.width) - ink_x);
+            int32_t rows = std::min<int32_t>(glyph->height, static_cast<int32_t>(entry.height) - glyph->y_offset);
+            if (cols > 0 && rows > 0) {
+                uint16_t* dst = block + static_cast<uint32_t>(glyph->y_offset) * entry.width + ink_x;
+                
+                for (int32_t row = 0; row < rows; row++) {
+                    for (int32_t col = 0; col < cols; col++) {
+                        uint8_t level = PropFont_GetLevel(bitmap, static_cast<uint8_t>(col), font->bpp);
+                        if (level != 0) {
+                            dst[col] = ramp[level];
+                        }
+                    }
+                    bitmap += row_bytes;
+                    dst += entry.width;
+                }
+            }
+            
+            current_x += glyph->advance;
+            ptr += bytes_consumed;
+        }
+    }
+    
+    // Копия строки для проверки совпадения при поиске
+    strcpy(reinterpret_cast<char*>(block + block_pixels), utf8_str);
+}
+
+void LabelCache::drawCached(Framebuffer& fb, uint16_t x, uint16_t y, const char* utf8_str, const PropFont* font, uint8_t scale, uint16_t color, uint16_t bg_color) {
+    if (!fb.isAllocated() || utf8_str == nullptr || x >= fb.getWidth() || y >= fb.getHeight()) {
+        return;
+    }
+    
+    uint32_t hash = hashString(utf8_str);
+    Entry* entry = find(hash, utf8_str, font, scale, color, bg_color);
+    
+    if (entry != nullptr) {
+        hits_++;
+    } else {
+        misses_++;
+        
+        uint32_t width = 0;
+        uint16_t height = 0;
+        if (font == nullptr) {
+            uint32_t chars = 0;
+            uint32_t codepoints[FONT8X16_GLYPH_BATCH];
+            for (const char* ptr = utf8_str; *ptr; ) {
+                chars += UTF8_DecodeBatch(&ptr, codepoints, FONT8X16_GLYPH_BATCH);
+            }
+            width = chars * FONT8X16_WIDTH * scale;
+            height = FONT8X16_HEIGHT * scale;
+        } else {
+            width = PropFont_TextWidth(font, utf8_str);
+            height = font->line_height;
+        }
+        
+        // Ширина блока хранится в 16 битах: более широкая метка рисуется без кэша
+        entry = (width > 0 && width <= 0xFFFF) ? allocate(width * height + textPixels(utf8_str)) : nullptr;
+        if (entry == nullptr) {
+            // Метка не помещается в арену - рисуем без кэша
+            if (font == nullptr) {
+                fb.drawStringScaled(x, y, utf8_str, color, scale, bg_color);
+            } else {
+                fb.drawStringProp(x, y, utf8_str, font, color, bg_color);
+            }
+            return;
+        }
+        
+        entry->hash = hash;
+        entry->font = font;
+        entry->scale = scale;
+        entry->color = color;
+        entry->bg_color = bg_color;
+        entry->width = static_cast<uint16_t>(width);
+        entry->height = height;
+        entry->used = true;
+        render(*entry, utf8_str);
+    }
+    
+    entry->last_used = ++clock_;
+    
+    // Построчное копирование блока с отсечением по области отсечения буфера
+    fb.blit(static_cast<int16_t>(x), static_cast<int16_t>(y), entry->width, entry->height,
+            arena_ + entry->offset, BLIT_NONE, entry->width);
+}
+
+void LabelCache::draw(Framebuffer& fb, uint16_t x, uint16_t y, const char* utf8_str, uint16_t color, uint8_t scale, uint16_t bg_color) {
+    if (scale == 0) scale = 1;
+    if (scale > 8) scale = 8;
+    drawCached(fb, x, y, utf8_str, nullptr, scale, color, bg_color);
+}
+
+void LabelCache::draw(Framebuffer& fb, uint16_t x, uint16_t y, const char* utf8_str, const PropFont* font, uint16_t color, uint16_t bg_color) {
+    // Растр шрифта - 1, 2 или 4 бита на пиксель (таблица уровней на 16 цветов)
+    if (font != nullptr && !PropFont_IsValidBpp(font->bpp)) {
+        return;
+    }
+    drawCached(fb, x, y, utf8_str, font, 1, color, bg_color);
+}
@@ -0,0 +1,62 @@
+#ifndef LABEL_CACHE_HPP
+#define LABEL_CACHE_HPP
+
+#include <cstdint>
+
+class Framebuffer;
+struct PropFont;
+
+// Максимальное количество меток в кэше
+constexpr uint8_t LABEL_CACHE_MAX_ENTRIES = 16;
+
+// Кэш заранее отрисованных текстовых меток.
+// Метка (строка, шрифт, масштаб, цвет, фон) один раз растеризуется в блок RGB565
+// внутри арены фиксированного размера, повторные вызовы копируют блок построчно.
+// При нехватке места вытесняется давно не использованная метка.
+// Метки непрозрачны: фон заливается всегда, в том числе черный.
+class LabelCache {
+private:
+    struct Entry {
+        uint32_t hash;
+        const PropFont* font;    // nullptr - встроенный шрифт 8x16
+        uint16_t color;
+        uint16_t bg_color;
+        uint8_t scale;
+        bool used;
+        uint16_t width;
+        uint16_t height;
+        uint32_t offset;         // Смещение блока в арене (в пикселях)
+        uint32_t size;           // Размер блока вместе с копией строки (в пикселях)
+        uint32_t last_used;
+    };
+    
+    uint16_t* arena_;
+    uint32_t arena_size_;        // Размер арены в пикселях
+    uint32_t arena_used_;
+    uint32_t clock_;
+    uint32_t hits_;
+    uint32_t misses_;
+    Entry entries_[LABEL_CACHE_MAX_ENTRIES];
+    
+    Entry* find(uint32_t hash, const char* utf8_str, const PropFont* font, uint8_t scale, uint16_t color, uint16_t bg_color);
+    Entry* allocate(uint32_t size);
+    void evict(Entry* entry);
+    void render(const Entry& entry, const char* utf8_str);
+    void drawCached(Framebuffer& fb, uint16_t x, uint16_t y, const char* utf8_str, const PropFont* font, uint8_t scale, uint16_t color, uint16_t bg_color);
+    
+public:
+    // Арена предоставляется вызывающей стороной и должна жить дольше кэша
+    LabelCache(uint16_t* arena, uint32_t arena_pixels);
+    
+    // Рисует метку через кэш. Если метка не помещается в арену, рисуется напрямую
+    void draw(Framebuffer& fb, uint16_t x, uint16_t y, const char* utf8_str, uint16_t color, uint8_t scale = 1, uint16_t bg_color = 0x0000);
+    void draw(Framebuffer& fb, uint16_t x, uint16_t y, const char* utf8_str, const PropFont* font, uint16_t color, uint16_t bg_color = 0x0000);
+    
+    void clear();
+    
+    uint32_t getHits() const { return hits_; }
+    uint32_t getMisses() const { return misses_; }
+    uint32_t getArenaUsed() const { return arena_used_; }
+};
+
+#endif
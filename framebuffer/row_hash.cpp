@@ -0,0 +1,20 @@
+#include "row_hash.hpp"
+#include <cstring>
+
+uint32_t RowHash_Compute(const uint16_t* pixels, uint16_t count) {
+    uint32_t hash = 0x811C9DC5u ^ count;
+    uint16_t pairs = count / 2;
+
+    // Слово читается через memcpy: отрезок может начинаться с нечетного пикселя
+    for (uint16_t i = 0; i < pairs; i++) {
+        uint32_t word;
+        memcpy(&word, pixels + i * 2, sizeof(word));
+        hash = (hash ^ word) * 0x9E3779B1u;
+        hash ^= hash >> 15;
+    }
+    if (count & 1) {
+        hash = (hash ^ pixels[count - 1]) * 0x9E3779B1u;
+        hash ^= hash >> 15;
+    }
+    return hash;
+}
@@ -0,0 +1,10 @@
+#ifndef ROW_HASH_HPP
+#define ROW_HASH_HPP
+
+#include <cstdint>
+
+// 32-битный хэш отрезка строки пикселей RGB565.
+// Пиксели обрабатываются парами (по 32-битному слову): одно умножение и сдвиг на слово
+uint32_t RowHash_Compute(const uint16_t* pixels, uint16_t count);
+
+#endif
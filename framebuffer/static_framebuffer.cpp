@@ -0,0 +1,87 @@
+#include "framebuffer.hpp"
+
+// Статическая полоса 240x136 в отдельной единице трансляции: массив попадает
+// в прошивку, только если приложение вызывает функции статического буфера.
+// Секцию можно задать через ST7789V3_STATIC_FB_SECTION (например ".ccmram")
+#ifdef ST7789V3_STATIC_FB_SECTION
+static uint16_t static_framebuffer[FB_WIDTH * STATIC_FB_HEIGHT] ST7789V3_FB_SECTION(ST7789V3_STATIC_FB_SECTION);
+#else
+static uint16_t static_framebuffer[FB_WIDTH * STATIC_FB_HEIGHT] ST7789V3_FB_ALIGNED;
+#endif
+static bool static_framebuffer_initialized = false;
+static Framebuffer static_canvas(static_framebuffer, FB_WIDTH, STATIC_FB_HEIGHT);
+
+// ===================== СТАТИЧЕСКИЙ БУФЕР КАДРА =====================
+
+bool initStaticFramebuffer() {
+    // Очистка буфера при инициализации
+    clearStaticFramebuffer(0x0000);
+    static_framebuffer_initialized = true;
+    return true;
+}
+
+void clearStaticFramebuffer(uint16_t color) {
+    static_canvas.clear(color);
+}
+
+void setStaticPixel(uint16_t x, uint16_t y, uint16_t color) {
+    static_canvas.drawPixel(x, y, color);
+}
+
+uint16_t getStaticPixel(uint16_t x, uint16_t y) {
+    return static_canvas.getPixel(x, y); // Черный цвет для недопустимых координат
+}
+
+// Получить указатель на статический буфер
+uint16_t* getStaticFramebuffer() {
+    return static_framebuffer;
+}
+
+// Статическая полоса как холст: те же примитивы, что у Framebuffer и дисплея
+Framebuffer& getStaticCanvas() {
+    return static_canvas;
+}
+
+// Проверить, инициализирован ли статический буфер
+bool isStaticFramebufferInitialized() {
+    return static_framebuffer_initialized;
+}
+
+void flushStaticFramebuffer() {
+    // Эта функция будет вызывать метод дисплея для передачи буфера
+    // Для правильной работы нужно использовать экземпляр ST7789V3
+    // Пока оставляем заглушку - пользователь должен вызывать методы дисплея напрямую
+}
+
+// ===================== ДОПОЛНИТЕЛЬНЫЕ ФУНКЦИИ ДЛЯ РИСОВАНИЯ =====================
+
+// Функции рисования в статическом буфере (обертки над холстом статической полосы)
+void drawStaticRect(uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint16_t color) {
+    static_canvas.fillRect(x, y, w, h, color);
+}
+
+void drawStaticLine(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, uint16_t color) {
+    static_canvas.drawLine(x0, y0, x1, y1, color);
+}
+
+// ===================== ФУНКЦИИ ДЛЯ РИСОВАНИЯ ТЕКСТА В СТАТИЧЕСКОМ БУФЕРЕ =====================
+
+void drawStaticChar(uint16_t x, uint16_t y, char ch, uint16_t color, uint16_t bg_color) {
+    static_canvas.drawChar(x, y, ch, color, bg_color);
+}
+
+void drawStaticString(uint16_t x, uint16_t y, const char* str, uint16_t color, uint16_t bg_color) {
+    static_canvas.drawString(x, y, str, color, bg_color);
+}
+
+void drawStaticStringUTF8(uint16_t x, uint16_t y, const char* utf8_str, uint16_t color, uint16_t bg_color) {
+    static_canvas.drawStringUTF8(x, y, utf8_str, color, bg_color);
+}
+
+void drawStaticStringScaled(uint16_t x, uint16_t y, const char* str, uint16_t color, uint8_t scale, uint16_t bg_color) {
+    static_canvas.drawStringScaled(x, y, str, color, scale, bg_color);
+}
+
+void drawStaticStringUTF8Scaled(uint16_t x, uint16_t y, const char* utf8_str, uint16_t color, uint8_t scale, uint16_t bg_color) {
+    static_canvas.drawStringUTF8Scaled(x, y, utf8_str, color, scale, bg_color);
+}
@@ -0,0 +1,227 @@
+#include "tiled_framebuffer.hpp"
+#include "color_ramp.hpp"
+#include <algorithm>
+#include <cstring>
+
+TiledFramebuffer::TiledFramebuffer(uint16_t* pool, uint32_t pool_pixels, uint8_t tile_size,
+                                   uint16_t width, uint16_t height)
+    : pool_(pool), pool_tiles_(0), pool_used_(0), free_head_(TILED_FB_SOLID), overflows_(0),
+      width_(width), height_(height), tile_shift_(tile_size == 32 ? 5 : 4), tile_size_(0),
+      tile_pixels_(0), columns_(0), rows_(0), valid_(false),
+      write_x_(0), write_w_(0), write_col_(0), write_row_(0), write_end_row_(0) {
+    tile_size_ = static_cast<uint8_t>(1u << tile_shift_);
+    tile_pixels_ = static_cast<uint16_t>(tile_size_) * tile_size_;
+    columns_ = (width + tile_size_ - 1) >> tile_shift_;
+    rows_ = (height + tile_size_ - 1) >> tile_shift_;
+
+    // Таблица плиток фиксированного размера
+    if (width == 0 || height == 0 || static_cast<uint32_t>(columns_) * rows_ > TILED_FB_MAX_TILES) {
+        return;
+    }
+
+    if (pool_ != nullptr) {
+        pool_tiles_ = static_cast<uint16_t>(std::min<uint32_t>(pool_pixels / tile_pixels_, TILED_FB_SOLID - 1));
+    }
+    valid_ = true;
+    clear();
+}
+
+void TiledFramebuffer::clear(uint16_t color) {
+    if (!valid_) return;
+
+    for (uint16_t i = 0; i < columns_ * rows_; i++) {
+        tiles_[i].color = color;
+        tiles_[i].slot = TILED_FB_SOLID;
+    }
+
+    // Все плитки пула - в списке свободных
+    free_head_ = TILED_FB_SOLID;
+    for (uint16_t slot = pool_tiles_; slot > 0; slot--) {
+        slotPixels(slot - 1)[0] = free_head_;
+        free_head_ = slot - 1;
+    }
+    pool_used_ = 0;
+}
+
+bool TiledFramebuffer::materialize(Tile& tile) {
+    if (tile.slot != TILED_FB_SOLID) {
+        return true;
+    }
+    if (free_head_ == TILED_FB_SOLID) {
+        overflows_++; // Пул исчерпан
+        return false;
+    }
+
+    uint16_t slot = free_head_;
+    uint16_t* pixels = slotPixels(slot);
+    free_head_ = pixels[0];
+    pool_used_++;
+
+    std::fill_n(pixels, tile_pixels_, tile.color);
+    tile.slot = slot;
+    return true;
+}
+
+void TiledFramebuffer::makeSolid(Tile& tile, uint16_t color) {
+    if (tile.slot != TILED_FB_SOLID) {
+        slotPixels(tile.slot)[0] = free_head_;
+        free_head_ = tile.slot;
+        pool_used_--;
+        tile.slot = TILED_FB_SOLID;
+    }
+    tile.color = color;
+}
+
+uint16_t TiledFramebuffer::getPixel(uint16_t x, uint16_t y) const {
+    if (!valid_ || x >= width_ || y >= height_) {
+        return 0x0000; // Черный по умолчанию
+    }
+
+    const Tile& tile = tiles_[(y >> tile_shift_) * columns_ + (x >> tile_shift_)];
+    if (tile.slot == TILED_FB_SOLID) {
+        return tile.color;
+    }
+    uint16_t mask = tile_size_ - 1;
+    return slotPixels(tile.slot)[((y & mask) << tile_shift_) + (x & mask)];
+}
+
+const uint16_t* TiledFramebuffer::getTilePixels(uint16_t column, uint16_t row) const {
+    const Tile& tile = tiles_[row * columns_ + column];
+    return (tile.slot == TILED_FB_SOLID) ? nullptr : slotPixels(tile.slot);
+}
+
+uint16_t TiledFramebuffer::compact() {
+    uint16_t freed = 0;
+
+    for (uint16_t row = 0; row < rows_; row++) {
+        for (uint16_t column = 0; column < columns_; column++) {
+            Tile& tile = tiles_[row * columns_ + column];
+            if (tile.slot == TILED_FB_SOLID) continue;
+
+            // Проверяется только видимая часть крайних плиток
+            uint16_t tw = std::min<uint16_t>(tile_size_, width_ - (column << tile_shift_));
+            uint16_t th = std::min<uint16_t>(tile_size_, height_ - (row << tile_shift_));
+            const uint16_t* pixels = slotPixels(tile.slot);
+            uint16_t color = pixels[0];
+            bool uniform = true;
+
+            for (uint16_t y = 0; y < th && uniform; y++) {
+                const uint16_t* line = pixels + (y << tile_shift_);
+                for (uint16_t x = 0; x < tw; x++) {
+                    if (line[x] != color) {
+                        uniform = false;
+                        break;
+                    }
+                }
+            }
+
+            if (uniform) {
+                makeSolid(tile, color);
+                freed++;
+            }
+        }
+    }
+    return freed;
+}
+
+// ===================== ЦЕЛЬ ХОЛСТА =====================
+
+void TiledFramebuffer::writePixel(uint16_t x, uint16_t y, uint16_t color) {
+    Tile& tile = tileAt(x, y);
+    if (tile.slot == TILED_FB_SOLID && tile.color == color) return;
+    if (!materialize(tile)) return;
+
+    uint16_t mask = tile_size_ - 1;
+    slotPixels(tile.slot)[((y & mask) << tile_shift_) + (x & mask)] = color;
+}
+
+void TiledFramebuffer::writeBlendPixel(uint16_t x, uint16_t y, uint16_t color, uint8_t alpha) {
+    writePixel(x, y, ColorRamp_Blend565(color, getPixel(x, y), alpha, 255));
+}
+
+void TiledFramebuffer::writeFillRect(uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint16_t color) {
+    uint16_t x_end = x + w;
+    uint16_t y_end = y + h;
+
+    for (uint16_t row = y >> tile_shift_; row <= (y_end - 1) >> tile_shift_; row++) {
+        uint16_t tile_y = row << tile_shift_;
+        uint16_t tile_y_end = std::min<uint16_t>(tile_y + tile_size_, height_);
+        uint16_t y0 = std::max(y, tile_y);
+        uint16_t y1 = std::min(y_end, tile_y_end);
+
+        for (uint16_t column = x >> tile_shift_; column <= (x_end - 1) >> tile_shift_; column++) {
+            Tile& tile = tiles_[row * columns_ + column];
+            uint16_t tile_x = column << tile_shift_;
+            uint16_t tile_x_end = std::min<uint16_t>(tile_x + tile_size_, width_);
+            uint16_t x0 = std::max(x, tile_x);
+            uint16_t x1 = std::min(x_end, tile_x_end);
+
+            // Плитка закрыта целиком - становится однородной, память возвращается в пул
+            if (x0 == tile_x && x1 == tile_x_end && y0 == tile_y && y1 == tile_y_end) {
+                makeSolid(tile, color);
+                continue;
+            }
+
+            if (tile.slot == TILED_FB_SOLID && tile.color == color) continue;
+            if (!materialize(tile)) continue;
+
+            uint16_t* line = slotPixels(tile.slot) + ((y0 - tile_y) << tile_shift_) + (x0 - tile_x);
+            for (uint16_t yy = y0; yy < y1; yy++) {
+                std::fill_n(line, x1 - x0, color);
+                line += tile_size_;
+            }
+        }
+    }
+}
+
+void TiledFramebuffer::writeSpan(uint16_t x, uint16_t y, const uint16_t* pixels, uint16_t count) {
+    // Отрезок строки разбивается по границам плиток
+    uint16_t mask = tile_size_ - 1;
+    while (count > 0) {
+        Tile& tile = tileAt(x, y);
+        uint16_t n = std::min<uint16_t>(count, tile_size_ - (x & mask));
+
+        bool same = false;
+        if (tile.slot == TILED_FB_SOLID) {
+            same = true;
+            for (uint16_t i = 0; i < n; i++) {
+                if (pixels[i] != tile.color) {
+                    same = false;
+                    break;
+                }
+            }
+        }
+
+        if (!same && materialize(tile)) {
+            memcpy(slotPixels(tile.slot) + ((y & mask) << tile_shift_) + (x & mask), pixels, n * sizeof(uint16_t));
+        }
+
+        x += n;
+        pixels += n;
+        count -= n;
+    }
+}
+
+void TiledFramebuffer::writeBegin(uint16_t x, uint16_t y, uint16_t w, uint16_t h) {
+    write_x_ = x;
+    write_w_ = w;
+    write_col_ = 0;
+    write_row_ = y;
+    write_end_row_ = y + h;
+}
+
+void TiledFramebuffer::writePush(const uint16_t* pixels, uint32_t count) {
+    // Пиксели заполняют окно построчно, как RAMWR дисплея; лишние отбрасываются
+    while (count > 0 && write_row_ < write_end_row_) {
+        uint16_t n = static_cast<uint16_t>(std::min<uint32_t>(count, write_w_ - write_col_));
+        writeSpan(write_x_ + write_col_, write_row_, pixels, n);
+
+        pixels += n;
+        count -= n;
+        write_col_ += n;
+        if (write_col_ == write_w_) {
+            write_col_ = 0;
+            write_row_++;
+        }
+    }
+}
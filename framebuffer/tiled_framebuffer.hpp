@@ -0,0 +1,97 @@
+#ifndef TILED_FRAMEBUFFER_HPP
+#define TILED_FRAMEBUFFER_HPP
+
+#include <cstdint>
+#include "canvas.hpp"
+
+// Максимальное количество плиток (240x320 при плитке 16x16)
+constexpr uint16_t TILED_FB_MAX_TILES = 300;
+
+// Плитка без собственной памяти (залита одним цветом)
+constexpr uint16_t TILED_FB_SOLID = 0xFFFF;
+
+// Разреженный буфер кадра из плиток 16x16 или 32x32.
+// Плитка хранит либо один цвет (2 байта), либо ссылку на настоящую плитку в пуле
+// фиксированного размера. Плитка из пула выделяется при первой записи, которая
+// делает ее неоднородной, и возвращается в пул, когда ее целиком заливают одним цветом.
+// Если пул исчерпан, запись в однородную плитку отбрасывается и учитывается в getOverflows().
+// Передача на дисплей: ST7789V3::flushTiledFramebuffer()
+class TiledFramebuffer : public Canvas<TiledFramebuffer> {
+    friend class Canvas<TiledFramebuffer>;
+
+private:
+    struct Tile {
+        uint16_t color;     // Цвет однородной плитки
+        uint16_t slot;      // Номер плитки в пуле или TILED_FB_SOLID
+    };
+
+    uint16_t* pool_;
+    uint16_t pool_tiles_;
+    uint16_t pool_used_;
+    uint16_t free_head_;    // Список свободных плиток хранится в них самих
+    uint32_t overflows_;
+    uint16_t width_;
+    uint16_t height_;
+    uint8_t tile_shift_;
+    uint8_t tile_size_;
+    uint16_t tile_pixels_;
+    uint16_t columns_;
+    uint16_t rows_;
+    bool valid_;
+    Tile tiles_[TILED_FB_MAX_TILES];
+
+    // Окно потоковой записи (writeBegin/writePush)
+    uint16_t write_x_;
+    uint16_t write_w_;
+    uint16_t write_col_;
+    uint16_t write_row_;
+    uint16_t write_end_row_;
+
+    Tile& tileAt(uint16_t x, uint16_t y) { return tiles_[(y >> tile_shift_) * columns_ + (x >> tile_shift_)]; }
+    uint16_t* slotPixels(uint16_t slot) const { return pool_ + static_cast<uint32_t>(slot) * tile_pixels_; }
+    bool materialize(Tile& tile);
+    void makeSolid(Tile& tile, uint16_t color);
+    void writeSpan(uint16_t x, uint16_t y, const uint16_t* pixels, uint16_t count);
+
+    // Методы цели холста (координаты уже отсечены)
+    uint16_t canvasWidth() const { return valid_ ? width_ : 0; }
+    uint16_t canvasHeight() const { return valid_ ? height_ : 0; }
+    void writePixel(uint16_t x, uint16_t y, uint16_t color);
+    void writeFillRect(uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint16_t color);
+    void writeBegin(uint16_t x, uint16_t y, uint16_t w, uint16_t h);
+    void writePush(const uint16_t* pixels, uint32_t count);
+    void writeEnd() {}
+    void writeBlendPixel(uint16_t x, uint16_t y, uint16_t color, uint8_t alpha);
+
+public:
+    // Пул предоставляется вызывающей стороной (pool_pixels пикселей) и должен жить дольше буфера.
+    // tile_size - 16 или 32
+    TiledFramebuffer(uint16_t* pool, uint32_t pool_pixels, uint8_t tile_size = 16,
+                     uint16_t width = 240, uint16_t height = 320);
+
+    // Все плитки становятся однородными, пул освобождается
+    void clear(uint16_t color = 0x0000);
+    uint16_t getPixel(uint16_t x, uint16_t y) const;
+
+    // Возвращает в пул плитки, которые стали однородными. Возвращает число освобожденных
+    uint16_t compact();
+
+    // Доступ к плиткам (для передачи на дисплей)
+    uint16_t getWidth() const { return width_; }
+    uint16_t getHeight() const { return height_; }
+    uint8_t getTileSize() const { return tile_size_; }
+    uint16_t getColumns() const { return columns_; }
+    uint16_t getRows() const { return rows_; }
+    bool isTileSolid(uint16_t column, uint16_t row) const { return tiles_[row * columns_ + column].slot == TILED_FB_SOLID; }
+    uint16_t getTileColor(uint16_t column, uint16_t row) const { return tiles_[row * columns_ + column].color; }
+    // Пиксели плитки из пула (tile_size x tile_size, по строкам); nullptr для однородной
+    const uint16_t* getTilePixels(uint16_t column, uint16_t row) const;
+
+    // Статистика пула
+    bool isValid() const { return valid_; }
+    uint16_t getPoolTiles() const { return pool_tiles_; }
+    uint16_t getPoolUsed() const { return pool_used_; }
+    uint32_t getOverflows() const { return overflows_; }
+};
+
+#endif
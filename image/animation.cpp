@@ -0,0 +1,99 @@
+#include "animation.hpp"
+#include "image.hpp"
+#include "st7789v3.hpp"
+#include <cstring>
+
+static inline uint16_t read16(const uint8_t* p) {
+    return static_cast<uint16_t>(p[0] | (p[1] << 8));
+}
+
+static inline uint32_t read32(const uint8_t* p) {
+    return static_cast<uint32_t>(p[0]) | (static_cast<uint32_t>(p[1]) << 8) |
+           (static_cast<uint32_t>(p[2]) << 16) | (static_cast<uint32_t>(p[3]) << 24);
+}
+
+AnimationPlayer::AnimationPlayer()
+    : data_(nullptr), end_(nullptr), next_frame_(nullptr), width_(0), height_(0),
+      frame_count_(0), frame_index_(0), delay_(0), last_tick_(0), loop_(true), valid_(false) {
+}
+
+bool AnimationPlayer::open(const uint8_t* data, uint32_t size) {
+    valid_ = false;
+    if (data == nullptr || size < ANIMATION_HEADER_SIZE || memcmp(data, "S7AN", 4) != 0) {
+        return false;
+    }
+
+    data_ = data;
+    end_ = data + size;
+    width_ = read16(data + 4);
+    height_ = read16(data + 6);
+    frame_count_ = read16(data + 8);
+    valid_ = (width_ > 0 && height_ > 0 && frame_count_ > 0);
+    rewind();
+    return valid_;
+}
+
+void AnimationPlayer::rewind() {
+    next_frame_ = data_ + ANIMATION_HEADER_SIZE;
+    frame_index_ = 0;
+    delay_ = 0;
+}
+
+bool AnimationPlayer::drawNextFrame(ST7789V3& display, int16_t x, int16_t y) {
+    if (!valid_) {
+        return false;
+    }
+    if (frame_index_ >= frame_count_) {
+        if (!loop_) return false;
+        rewind();
+    }
+
+    const uint8_t* p = next_frame_;
+    if (static_cast<uint32_t>(end_ - p) < ANIMATION_FRAME_HEADER_SIZE) {
+        valid_ = false;
+        return false;
+    }
+    uint16_t delay = read16(p + 2);
+    uint16_t rect_count = read16(p + 4);
+    p += ANIMATION_FRAME_HEADER_SIZE;
+
+    for (uint16_t i = 0; i < rect_count; i++) {
+        if (static_cast<uint32_t>(end_ - p) < ANIMATION_RECT_HEADER_SIZE) {
+            valid_ = false;
+            return false;
+        }
+        uint16_t rx = read16(p);
+        uint16_t ry = read16(p + 2);
+        uint16_t rw = read16(p + 4);
+        uint16_t rh = read16(p + 6);
+        uint32_t size = read32(p + 8);
+        p += ANIMATION_RECT_HEADER_SIZE;
+
+        if (size > static_cast<uint32_t>(end_ - p) || rx + rw > width_ || ry + rh > height_) {
+            valid_ = false;
+            return false;
+        }
+
+        ImageDecoder rect;
+        if (!rect.openStream(p, size, rw, rh, ImageFormat::RLE565) ||
+            !Image_Draw(display, rect, static_cast<int16_t>(x + rx), static_cast<int16_t>(y + ry))) {
+            valid_ = false;
+            return false;
+        }
+        p += size;
+    }
+
+    next_frame_ = p;
+    frame_index_++;
+    delay_ = delay;
+    last_tick_ = HAL_GetTick();
+    return true;
+}
+
+bool AnimationPlayer::update(ST7789V3& display, int16_t x, int16_t y) {
+    // Первый кадр выводится сразу
+    if (frame_index_ > 0 && HAL_GetTick() - last_tick_ < delay_) {
+        return false;
+    }
+    return drawNextFrame(display, x, y);
+}
@@ -0,0 +1,60 @@
+#ifndef ANIMATION_HPP
+#define ANIMATION_HPP
+
+#include <cstdint>
+
+class ST7789V3;
+
+// Формат анимации (все поля - младшим байтом вперед):
+//   Заголовок (12 байт): "S7AN", ширина, высота, число кадров, резерв (uint16)
+//   Кадр (6 байт): флаги (uint8), резерв (uint8), задержка в мс (uint16), число областей (uint16)
+//   Область (12 байт): x, y, w, h (uint16), размер данных (uint32), данные Rle565 (w*h пикселей)
+// Ключевой кадр содержит одну область на весь кадр, остальные - только изменившиеся области.
+// Первый кадр всегда ключевой. Файлы создает st7789v3_anim (tools/)
+constexpr uint32_t ANIMATION_HEADER_SIZE = 12;
+constexpr uint32_t ANIMATION_FRAME_HEADER_SIZE = 6;
+constexpr uint32_t ANIMATION_RECT_HEADER_SIZE = 12;
+constexpr uint8_t ANIMATION_FLAG_KEYFRAME = 0x01;
+
+// Проигрыватель анимации. Области кадра распаковываются прямо из flash построчно
+// (два строчных буфера) и передаются на дисплей потоковой записью через DMA,
+// поэтому не нужен ни буфер кадра, ни передача полного кадра.
+// Вывод идет прямо на дисплей, минуя подключенный буфер кадра; части за краем экрана отсекаются
+class AnimationPlayer {
+private:
+    const uint8_t* data_;
+    const uint8_t* end_;
+    const uint8_t* next_frame_;
+    uint16_t width_;
+    uint16_t height_;
+    uint16_t frame_count_;
+    uint16_t frame_index_;      // Номер следующего кадра
+    uint16_t delay_;            // Задержка последнего выведенного кадра
+    uint32_t last_tick_;
+    bool loop_;
+    bool valid_;
+
+public:
+    AnimationPlayer();
+
+    // Проверка заголовка и переход к первому кадру
+    bool open(const uint8_t* data, uint32_t size);
+    void rewind();
+    void setLoop(bool loop) { loop_ = loop; }
+
+    // Вывод следующего кадра с левым верхним углом в (x, y). Возвращает false,
+    // если кадры закончились (без повтора) или данные повреждены
+    bool drawNextFrame(ST7789V3& display, int16_t x, int16_t y);
+    // Вывод следующего кадра, если истекла задержка предыдущего (по HAL_GetTick)
+    bool update(ST7789V3& display, int16_t x, int16_t y);
+
+    bool isValid() const { return valid_; }
+    bool isFinished() const { return valid_ && !loop_ && frame_index_ >= frame_count_; }
+    uint16_t getWidth() const { return width_; }
+    uint16_t getHeight() const { return height_; }
+    uint16_t getFrameCount() const { return frame_count_; }
+    uint16_t getFrameIndex() const { return frame_index_; }
+    uint16_t getFrameDelay() const { return delay_; }
+};
+
+#endif
@@ -0,0 +1,80 @@
+#include "asset.hpp"
+#include "st7789v3.hpp"
+#include "framebuffer.hpp"
+
+bool Asset_Open(const ImageAsset& asset, ImageDecoder& decoder) {
+    switch (asset.format) {
+        case AssetFormat::RGB565:
+            return decoder.openStream(asset.data, asset.size, asset.width, asset.height, ImageFormat::RAW565);
+        case AssetFormat::RGB565_WIRE:
+            return decoder.openStream(asset.data, asset.size, asset.width, asset.height, ImageFormat::RAW565_WIRE);
+        case AssetFormat::PALETTE8:
+            return decoder.openStream(asset.data, asset.size, asset.width, asset.height, ImageFormat::PALETTE8,
+                                      asset.palette, asset.palette_count);
+        case AssetFormat::IMAGE:
+            return decoder.open(asset.data, asset.size);
+        default:
+            return false;
+    }
+}
+
+// Маска рисуется отрезками единичных битов через холст цели
+template <typename Target>
+static bool drawMask(Target& target, const ImageAsset& asset, int16_t x, int16_t y, uint16_t color) {
+    uint32_t stride = (asset.width + 7u) / 8u;
+    if (asset.size < stride * asset.height) {
+        return false;
+    }
+
+    ImageClip clip;
+    if (!Image_Clip(x, y, asset.width, asset.height, target.getWidth(), target.getHeight(), clip)) {
+        return true;
+    }
+
+    for (uint16_t row = 0; row < clip.h; row++) {
+        const uint8_t* bits = asset.data + (clip.src_y + row) * stride;
+        uint16_t col = 0;
+        while (col < clip.w) {
+            uint16_t sx = clip.src_x + col;
+            if (!(bits[sx >> 3] & (0x80 >> (sx & 7)))) {
+                col++;
+                continue;
+            }
+            uint16_t start = col;
+            while (col < clip.w) {
+                sx = clip.src_x + col;
+                if (!(bits[sx >> 3] & (0x80 >> (sx & 7)))) break;
+                col++;
+            }
+            target.fillRect(clip.dst_x + start, clip.dst_y + row, col - start, 1, color);
+        }
+    }
+    return true;
+}
+
+// Размер области рисования дисплея для drawMask
+struct DisplayTarget {
+    ST7789V3& display;
+    uint16_t getWidth() const { return ST7789_WIDTH; }
+    uint16_t getHeight() const { return ST7789_HEIGHT; }
+    void fillRect(uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint16_t color) { display.fillRect(x, y, w, h, color); }
+};
+
+bool Asset_Draw(ST7789V3& display, const ImageAsset& asset, int16_t x, int16_t y, uint16_t color) {
+    if (asset.format == AssetFormat::MASK1) {
+        DisplayTarget target = {display};
+        return drawMask(target, asset, x, y, color);
+    }
+
+    ImageDecoder decoder;
+    return Asset_Open(asset, decoder) && Image_Draw(display, decoder, x, y);
+}
+
+bool Asset_Draw(Framebuffer& framebuffer, const ImageAsset& asset, int16_t x, int16_t y, uint16_t color) {
+    if (asset.format == AssetFormat::MASK1) {
+        return framebuffer.isAllocated() && drawMask(framebuffer, asset, x, y, color);
+    }
+
+    ImageDecoder decoder;
+    return Asset_Open(asset, decoder) && Image_Draw(framebuffer, decoder, x, y);
+}
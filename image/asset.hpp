@@ -0,0 +1,39 @@
+#ifndef ASSET_HPP
+#define ASSET_HPP
+
+#include <cstdint>
+#include "image.hpp"
+
+class ST7789V3;
+class Framebuffer;
+
+// Формат ресурса, созданного при сборке функцией CMake st7789v3_add_assets()
+enum class AssetFormat : uint8_t {
+    RGB565,         // Цвета младшим байтом вперед: DMA прямо из flash
+    RGB565_WIRE,    // Цвета в порядке передачи (старший байт первым): SPI прямо из flash
+    PALETTE8,       // Индекс 1 байт на пиксель и палитра
+    MASK1,          // 1 бит на пиксель, строка выровнена по байту, старший бит - левый пиксель
+    IMAGE           // Изображение S7IM (image.hpp), формат выбран по размеру
+};
+
+// Ресурс изображения во flash
+struct ImageAsset {
+    uint16_t width;
+    uint16_t height;
+    AssetFormat format;
+    const uint8_t* data;
+    uint32_t size;
+    const uint8_t* palette;     // PALETTE8: цвета RGB565 младшим байтом вперед
+    uint16_t palette_count;
+};
+
+// Распаковщик для ресурса (кроме MASK1)
+bool Asset_Open(const ImageAsset& asset, ImageDecoder& decoder);
+
+// Вывод ресурса с левым верхним углом в (x, y) и отсечением по краям.
+// MASK1 рисует единичные биты цветом color отрезками fillRect (на дисплее - с учетом
+// подключенного буфера кадра), нулевые остаются прозрачными
+bool Asset_Draw(ST7789V3& display, const ImageAsset& asset, int16_t x, int16_t y, uint16_t color = 0xFFFF);
+bool Asset_Draw(Framebuffer& framebuffer, const ImageAsset& asset, int16_t x, int16_t y, uint16_t color = 0xFFFF);
+
+#endif
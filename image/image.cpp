@@ -0,0 +1,277 @@
+#include "image.hpp"
+#include "st7789v3.hpp"
+#include "framebuffer.hpp"
+#include <algorithm>
+#include <cstring>
+
+// Видимая часть строки экрана помещается в один строчный буфер
+static_assert(ST7789_WIDTH <= CANVAS_LINE_PIXELS, "line buffer is narrower than the display");
+
+// Строчные буферы: один заполняется, пока другой передается через DMA
+static uint16_t line_buffers[2][CANVAS_LINE_PIXELS];
+
+static inline uint16_t read16(const uint8_t* p) {
+    return static_cast<uint16_t>(p[0] | (p[1] << 8));
+}
+
+ImageDecoder::ImageDecoder()
+    : pixels_(nullptr), size_(0), palette_(nullptr), palette_count_(0), width_(0), height_(0),
+      format_(ImageFormat::RAW565), row_(0), raw_row_(nullptr), valid_(false) {
+    Rle565_Init(reader_, nullptr, 0);
+}
+
+bool ImageDecoder::open(const uint8_t* data, uint32_t size) {
+    valid_ = false;
+    if (data == nullptr || size < IMAGE_HEADER_SIZE || memcmp(data, "S7IM", 4) != 0) {
+        return false;
+    }
+
+    uint16_t width = read16(data + 4);
+    uint16_t height = read16(data + 6);
+    ImageFormat format = static_cast<ImageFormat>(data[8]);
+    uint16_t palette_count = 0;
+    const uint8_t* palette = nullptr;
+    uint32_t offset = IMAGE_HEADER_SIZE;
+
+    if (format == ImageFormat::PALETTE_RLE || format == ImageFormat::PALETTE8) {
+        palette_count = (data[9] == 0) ? 256 : data[9];
+        palette = data + offset;
+        offset += palette_count * 2u;
+        if (offset > size) {
+            return false;
+        }
+    }
+    return openStream(data + offset, size - offset, width, height, format, palette, palette_count);
+}
+
+bool ImageDecoder::openStream(const uint8_t* pixels, uint32_t size, uint16_t width, uint16_t height, ImageFormat format,
+                              const uint8_t* palette, uint16_t palette_count) {
+    pixels_ = pixels;
+    size_ = size;
+    palette_ = palette;
+    palette_count_ = palette_count;
+    width_ = width;
+    height_ = height;
+    format_ = format;
+
+    valid_ = (pixels != nullptr && width > 0 && height > 0);
+    switch (format) {
+        case ImageFormat::RAW565:
+        case ImageFormat::RAW565_WIRE:
+            valid_ = valid_ && size >= static_cast<uint32_t>(width) * height * 2;
+            break;
+        case ImageFormat::RLE565:
+            break;
+        case ImageFormat::PALETTE_RLE:
+            valid_ = valid_ && palette != nullptr && palette_count > 0;
+            break;
+        case ImageFormat::PALETTE8:
+            valid_ = valid_ && palette != nullptr && palette_count > 0 && size >= static_cast<uint32_t>(width) * height;
+            break;
+        default:
+            valid_ = false;
+            break;
+    }
+
+    rewind();
+    return valid_;
+}
+
+void ImageDecoder::rewind() {
+    row_ = 0;
+    raw_row_ = pixels_;
+    if (format_ == ImageFormat::PALETTE_RLE) {
+        Rle565_InitPalette(reader_, pixels_, size_, palette_, palette_count_);
+    } else {
+        Rle565_Init(reader_, pixels_, size_);
+    }
+}
+
+bool ImageDecoder::readRow(uint16_t* out, uint16_t x, uint16_t count) {
+    if (!valid_ || row_ >= height_ || x > width_ || count > width_ - x) {
+        return false;
+    }
+    row_++;
+
+    switch (format_) {
+        case ImageFormat::RAW565:
+        case ImageFormat::RAW565_WIRE: {
+            const uint8_t* p = raw_row_ + x * 2u;
+            if (format_ == ImageFormat::RAW565) {
+                for (uint16_t i = 0; i < count; i++) out[i] = read16(p + i * 2u);
+            } else {
+                for (uint16_t i = 0; i < count; i++) out[i] = static_cast<uint16_t>((p[i * 2u] << 8) | p[i * 2u + 1]);
+            }
+            raw_row_ += width_ * 2u;
+            return true;
+        }
+        case ImageFormat::PALETTE8: {
+            const uint8_t* p = raw_row_ + x;
+            for (uint16_t i = 0; i < count; i++) {
+                out[i] = (p[i] < palette_count_) ? read16(palette_ + p[i] * 2u) : 0x0000;
+            }
+            raw_row_ += width_;
+            return true;
+        }
+        default:
+            break;
+    }
+
+    uint16_t right = width_ - x - count;
+    return Rle565_Skip(reader_, x) == x &&
+           Rle565_Read(reader_, out, count) == count &&
+           Rle565_Skip(reader_, right) == right;
+}
+
+const uint16_t* ImageDecoder::readRowDirect(uint16_t x) {
+    if (!valid_ || (format_ != ImageFormat::RAW565 && format_ != ImageFormat::RAW565_WIRE) || row_ >= height_ || x >= width_ ||
+        (reinterpret_cast<uintptr_t>(raw_row_) & 1) != 0) {
+        return nullptr;
+    }
+
+    const uint16_t* pixels = reinterpret_cast<const uint16_t*>(raw_row_) + x;
+    raw_row_ += width_ * 2u;
+    row_++;
+    return pixels;
+}
+
+bool ImageDecoder::skipRows(uint16_t count) {
+    if (!valid_ || count > height_ - row_) {
+        return false;
+    }
+    row_ += count;
+
+    if (format_ == ImageFormat::RAW565 || format_ == ImageFormat::RAW565_WIRE) {
+        raw_row_ += static_cast<uint32_t>(width_) * count * 2;
+        return true;
+    }
+    if (format_ == ImageFormat::PALETTE8) {
+        raw_row_ += static_cast<uint32_t>(width_) * count;
+        return true;
+    }
+    uint32_t pixels = static_cast<uint32_t>(width_) * count;
+    return Rle565_Skip(reader_, pixels) == pixels;
+}
+
+bool Image_Clip(int16_t x, int16_t y, uint16_t w, uint16_t h, uint16_t target_w, uint16_t target_h, ImageClip& clip) {
+    int32_t x0 = std::max<int32_t>(x, 0);
+    int32_t y0 = std::max<int32_t>(y, 0);
+    int32_t x1 = std::min<int32_t>(static_cast<int32_t>(x) + w, target_w);
+    int32_t y1 = std::min<int32_t>(static_cast<int32_t>(y) + h, target_h);
+    if (x0 >= x1 || y0 >= y1) {
+        return false;
+    }
+
+    clip.src_x = static_cast<uint16_t>(x0 - x);
+    clip.src_y = static_cast<uint16_t>(y0 - y);
+    clip.dst_x = static_cast<uint16_t>(x0);
+    clip.dst_y = static_cast<uint16_t>(y0);
+    clip.w = static_cast<uint16_t>(x1 - x0);
+    clip.h = static_cast<uint16_t>(y1 - y0);
+    return true;
+}
+
+bool Image_Draw(ST7789V3& display, ImageDecoder& image, int16_t x, int16_t y) {
+    if (!image.isValid()) {
+        return false;
+    }
+    image.rewind();
+
+    ImageClip clip;
+    if (!Image_Clip(x, y, image.getWidth(), image.getHeight(), ST7789_WIDTH, ST7789_HEIGHT, clip)) {
+        return true;
+    }
+    if (!image.skipRows(clip.src_y)) {
+        return false;
+    }
+
+    display.beginWrite(clip.dst_x, clip.dst_y, clip.w, clip.h);
+
+    // RAW565_WIRE уже в порядке передачи: строки уходят в 8-битном режиме без перестановки
+    ST7789_PixelOrder direct_order = (image.getFormat() == ImageFormat::RAW565_WIRE) ?
+                                     ST7789_PixelOrder::SWAPPED : ST7789_PixelOrder::NATIVE;
+    // Строки собираются в передачи по нескольку: несжатые строки во всю ширину изображения
+    // лежат во flash подряд и уходят одной передачей, декодированные - сколько поместится
+    // в строчный буфер. Смена буфера ждет только окончания предыдущей части (опрос флага)
+    uint16_t rows_per_line = std::max<uint16_t>(1, CANVAS_LINE_PIXELS / clip.w);
+    const uint16_t* run = nullptr;
+    uint32_t run_pixels = 0;
+    uint8_t current = 0;
+    uint16_t line_rows = 0;
+    auto pushRun = [&]() {
+        if (run != nullptr) {
+            display.pushPixelsDMA(run, run_pixels, direct_order);
+            run = nullptr;
+        }
+    };
+    auto pushLines = [&]() {
+        if (line_rows > 0) {
+            display.pushPixelsDMA(line_buffers[current], static_cast<uint32_t>(line_rows) * clip.w);
+            current ^= 1;
+            line_rows = 0;
+        }
+    };
+
+    bool ok = true;
+    for (uint16_t row = 0; row < clip.h && ok; row++) {
+        // Несжатые цвета передаются прямо из flash, остальное - через строчные буферы
+        const uint16_t* pixels = image.readRowDirect(clip.src_x);
+        if (pixels != nullptr) {
+            pushLines();
+            if (run != nullptr && pixels != run + run_pixels) {
+                pushRun();
+            }
+            if (run == nullptr) {
+                run = pixels;
+                run_pixels = 0;
+            }
+            run_pixels += clip.w;
+            continue;
+        }
+        pushRun();
+        ok = image.readRow(line_buffers[current] + line_rows * clip.w, clip.src_x, clip.w);
+        if (ok && ++line_rows == rows_per_line) {
+            pushLines();
+        }
+    }
+    pushRun();
+    pushLines();
+
+    display.endWrite();
+    return ok;
+}
+
+bool Image_Draw(Framebuffer& framebuffer, ImageDecoder& image, int16_t x, int16_t y) {
+    if (!image.isValid() || !framebuffer.isAllocated()) {
+        return false;
+    }
+    image.rewind();
+
+    ImageClip clip;
+    if (!Image_Clip(x, y, image.getWidth(), image.getHeight(), framebuffer.getWidth(), framebuffer.getHeight(), clip)) {
+        return true;
+    }
+    if (!image.skipRows(clip.src_y)) {
+        return false;
+    }
+
+    // Строки распаковываются прямо в буфер кадра
+    uint16_t* dst = framebuffer.getBuffer() + static_cast<uint32_t>(clip.dst_y) * framebuffer.getWidth() + clip.dst_x;
+    for (uint16_t row = 0; row < clip.h; row++) {
+        if (!image.readRow(dst, clip.src_x, clip.w)) {
+            return false;
+        }
+        dst += framebuffer.getWidth();
+    }
+    return true;
+}
+
+bool Image_Draw(ST7789V3& display, const uint8_t* data, uint32_t size, int16_t x, int16_t y) {
+    ImageDecoder image;
+    return image.open(data, size) && Image_Draw(display, image, x, y);
+}
+
+bool Image_Draw(Framebuffer& framebuffer, const uint8_t* data, uint32_t size, int16_t x, int16_t y) {
+    ImageDecoder image;
+    return image.open(data, size) && Image_Draw(framebuffer, image, x, y);
+}
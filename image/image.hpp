@@ -0,0 +1,90 @@
+#ifndef IMAGE_HPP
+#define IMAGE_HPP
+
+#include <cstdint>
+#include "rle565.hpp"
+
+class ST7789V3;
+class Framebuffer;
+
+// Формат изображения (все поля - младшим байтом вперед):
+//   Заголовок (12 байт): "S7IM", ширина, высота (uint16), формат (uint8),
+//   размер палитры (uint8, 0 - 256 цветов), резерв (uint16)
+//   Палитра (PALETTE_RLE, PALETTE8): цвета RGB565 по 2 байта
+//   Пиксели: RAW565 - w*h цветов, RAW565_WIRE - w*h цветов старшим байтом вперед (порядок
+//   передачи на дисплей), RLE565 - поток Rle565, PALETTE_RLE - поток Rle565 с индексами,
+//   PALETTE8 - w*h индексов по байту
+// Файлы создает st7789v3_image (tools/)
+enum class ImageFormat : uint8_t {
+    RAW565 = 0,
+    RLE565 = 1,
+    PALETTE_RLE = 2,
+    RAW565_WIRE = 3,
+    PALETTE8 = 4
+};
+
+constexpr uint32_t IMAGE_HEADER_SIZE = 12;
+
+// Построчный распаковщик изображения из flash. Память под кадр не нужна:
+// строка распаковывается сразу в место назначения или в строчный буфер
+class ImageDecoder {
+private:
+    const uint8_t* pixels_;
+    uint32_t size_;
+    const uint8_t* palette_;
+    uint16_t palette_count_;
+    uint16_t width_;
+    uint16_t height_;
+    ImageFormat format_;
+    uint16_t row_;              // Номер следующей строки
+    const uint8_t* raw_row_;    // RAW565: начало следующей строки
+    Rle565Reader reader_;
+    bool valid_;
+
+public:
+    ImageDecoder();
+
+    // Изображение с заголовком S7IM
+    bool open(const uint8_t* data, uint32_t size);
+    // Пиксели без заголовка (например, область кадра анимации)
+    bool openStream(const uint8_t* pixels, uint32_t size, uint16_t width, uint16_t height, ImageFormat format,
+                    const uint8_t* palette = nullptr, uint16_t palette_count = 0);
+    void rewind();
+
+    // Распаковка следующей строки: в out попадают ее пиксели [x, x + count)
+    bool readRow(uint16_t* out, uint16_t x, uint16_t count);
+    // Пиксели [x, ...) следующей строки RAW565/RAW565_WIRE прямо из памяти, без копирования
+    // (RAW565 - little-endian, как на Cortex-M). nullptr для остальных форматов
+    // и невыровненных данных - тогда используется readRow
+    const uint16_t* readRowDirect(uint16_t x);
+    bool skipRows(uint16_t count);
+
+    bool isValid() const { return valid_; }
+    uint16_t getWidth() const { return width_; }
+    uint16_t getHeight() const { return height_; }
+    ImageFormat getFormat() const { return format_; }
+};
+
+// Видимая часть прямоугольника w x h в точке (x, y) внутри области target_w x target_h
+struct ImageClip {
+    uint16_t src_x;
+    uint16_t src_y;
+    uint16_t dst_x;
+    uint16_t dst_y;
+    uint16_t w;
+    uint16_t h;
+};
+
+// false - прямоугольник целиком за пределами области
+bool Image_Clip(int16_t x, int16_t y, uint16_t w, uint16_t h, uint16_t target_w, uint16_t target_h, ImageClip& clip);
+
+// Вывод изображения с левым верхним углом в (x, y) и отсечением по краям.
+// На дисплей - потоковой записью через DMA из двух строчных буферов (минуя подключенный
+// буфер кадра), в Framebuffer - распаковкой прямо в строки буфера.
+// Возвращает false, если данные повреждены
+bool Image_Draw(ST7789V3& display, ImageDecoder& image, int16_t x, int16_t y);
+bool Image_Draw(Framebuffer& framebuffer, ImageDecoder& image, int16_t x, int16_t y);
+bool Image_Draw(ST7789V3& display, const uint8_t* data, uint32_t size, int16_t x, int16_t y);
+bool Image_Draw(Framebuffer& framebuffer, const uint8_t* data, uint32_t size, int16_t x, int16_t y);
+
+#endif
@@ -0,0 +1,97 @@
+#include "rle565.hpp"
+#include <algorithm>
+
+static inline uint16_t readColor(const uint8_t* p) {
+    return static_cast<uint16_t>(p[0] | (p[1] << 8));
+}
+
+// Очередной пиксель потока: цвет или индекс в палитре
+static inline uint16_t readPixel(Rle565Reader& reader) {
+    if (reader.palette != nullptr) {
+        uint8_t index = *reader.data++;
+        return (index < reader.palette_count) ? readColor(reader.palette + index * 2) : 0x0000;
+    }
+    uint16_t color = readColor(reader.data);
+    reader.data += 2;
+    return color;
+}
+
+// Переход к следующему пакету; false - поток закончился или пакет обрезан
+static bool nextPacket(Rle565Reader& reader) {
+    if (reader.data >= reader.end) {
+        return false;
+    }
+
+    uint8_t header = *reader.data++;
+    uint8_t count = (header & 0x7F) + 1;
+    uint32_t available = static_cast<uint32_t>(reader.end - reader.data);
+    uint32_t pixel_size = (reader.palette != nullptr) ? 1 : 2;
+
+    if (header & RLE565_RUN_FLAG) {
+        if (available < pixel_size) return false;
+        reader.run = true;
+        reader.color = readPixel(reader);
+    } else {
+        if (available < count * pixel_size) return false;
+        reader.run = false;
+    }
+    reader.left = count;
+    return true;
+}
+
+void Rle565_Init(Rle565Reader& reader, const uint8_t* data, uint32_t size) {
+    reader.data = data;
+    reader.end = data + size;
+    reader.palette = nullptr;
+    reader.palette_count = 0;
+    reader.left = 0;
+    reader.run = false;
+    reader.color = 0;
+}
+
+void Rle565_InitPalette(Rle565Reader& reader, const uint8_t* data, uint32_t size,
+                        const uint8_t* palette, uint16_t palette_count) {
+    Rle565_Init(reader, data, size);
+    reader.palette = palette;
+    reader.palette_count = palette_count;
+}
+
+uint16_t Rle565_Read(Rle565Reader& reader, uint16_t* out, uint16_t count) {
+    uint16_t done = 0;
+
+    while (done < count) {
+        if (reader.left == 0 && !nextPacket(reader)) {
+            break;
+        }
+
+        uint16_t n = std::min<uint16_t>(count - done, reader.left);
+        if (reader.run) {
+            std::fill_n(out + done, n, reader.color);
+        } else {
+            for (uint16_t i = 0; i < n; i++) {
+                out[done + i] = readPixel(reader);
+            }
+        }
+        reader.left -= n;
+        done += n;
+    }
+    return done;
+}
+
+uint32_t Rle565_Skip(Rle565Reader& reader, uint32_t count) {
+    uint32_t done = 0;
+
+    while (done < count) {
+        if (reader.left == 0 && !nextPacket(reader)) {
+            break;
+        }
+
+        uint8_t n = static_cast<uint8_t>(std::min<uint32_t>(count - done, reader.left));
+        if (!reader.run) {
+            reader.data += (reader.palette != nullptr) ? n : n * 2u;
+        }
+        reader.left -= n;
+        done += n;
+    }
+    return done;
+}
@@ -0,0 +1,37 @@
+#ifndef RLE565_HPP
+#define RLE565_HPP
+
+#include <cstdint>
+
+// Поток пикселей RGB565 со сжатием повторов. Каждый пакет начинается с байта заголовка:
+//   1nnnnnnn - повтор: n+1 пикселей одного цвета, за ним 2 байта цвета
+//   0nnnnnnn - литерал: n+1 пикселей, за ним (n+1)*2 байта
+// Цвета хранятся младшим байтом вперед. В потоке с палитрой вместо цвета - индекс (1 байт),
+// палитра - массив цветов RGB565 (тоже младшим байтом вперед)
+constexpr uint8_t RLE565_RUN_FLAG = 0x80;
+constexpr uint16_t RLE565_MAX_PACKET = 128;
+
+// Состояние распаковки (поток читается прямо из flash)
+struct Rle565Reader {
+    const uint8_t* data;
+    const uint8_t* end;
+    const uint8_t* palette; // nullptr - цвета в потоке
+    uint16_t palette_count;
+    uint8_t left;       // Оставшиеся пиксели текущего пакета
+    bool run;
+    uint16_t color;     // Цвет текущего повтора
+};
+
+void Rle565_Init(Rle565Reader& reader, const uint8_t* data, uint32_t size);
+// Индексы за пределами палитры дают черный цвет
+void Rle565_InitPalette(Rle565Reader& reader, const uint8_t* data, uint32_t size,
+                        const uint8_t* palette, uint16_t palette_count);
+
+// Распаковка до count пикселей в out. Возвращает количество распакованных:
+// меньше count - поток закончился или поврежден
+uint16_t Rle565_Read(Rle565Reader& reader, uint16_t* out, uint16_t count);
+
+// Пропуск пикселей (повторы пропускаются без чтения данных)
+uint32_t Rle565_Skip(Rle565Reader& reader, uint32_t count);
+
+#endif
@@ -0,0 +1,249 @@
+#ifndef CANVAS_HPP
+#define CANVAS_HPP
+
+#include <cstdint>
+#include "number_format.hpp"
+#include "gradient.hpp"
+#include "convert565.hpp"
+
+struct PropFont;
+
+// Размер строчного буфера холста в пикселях (ширина строки текста за одну передачу)
+constexpr uint16_t CANVAS_LINE_PIXELS = 256;
+
+// Флаги вывода изображений (blit*), можно объединять
+constexpr uint8_t BLIT_NONE = 0x00;
+constexpr uint8_t BLIT_FLIP_X = 0x01;   // Отражение по горизонтали
+constexpr uint8_t BLIT_FLIP_Y = 0x02;   // Отражение по вертикали
+
+// Режим масштабирования изображений (blitScaled)
+enum class ScaleMode : uint8_t {
+    NEAREST,    // Ближайший пиксель
+    BILINEAR    // Билинейная интерполяция (веса с точностью 5 бит, как у Blend565)
+};
+
+// Глубина стека областей отсечения (pushClipRect)
+constexpr uint8_t CANVAS_CLIP_DEPTH = 8;
+
+// Область отсечения: столбцы [x0, x1), строки [y0, y1)
+struct CanvasClip {
+    int16_t x0;
+    int16_t y0;
+    int16_t x1;
+    int16_t y1;
+};
+
+// Максимальное количество вершин многоугольника (таблица ребер - на стеке)
+constexpr uint8_t CANVAS_MAX_POLYGON_POINTS = 32;
+
+// Вершина многоугольника (в пикселях или в долях пикселя, см. fillPolygon)
+struct CanvasPoint {
+    int16_t x;
+    int16_t y;
+};
+
+// Правило заливки самопересекающихся многоугольников
+enum class FillRule : uint8_t {
+    EVEN_ODD,   // Внутри - нечетное число пересечений
+    NON_ZERO    // Внутри - ненулевая сумма направлений ребер
+};
+
+namespace CanvasDetail {
+
+// Ребро многоугольника в таблице ребер (x и наклон в формате 16.16).
+// Остаток деления ведется отдельно, поэтому x на каждой строке точно округлен вниз
+struct PolygonEdge {
+    int32_t x;          // x на центре текущей строки
+    int32_t dxdy;       // Целая часть приращения x на строку
+    int32_t error;      // Накопленный остаток (0..dy-1)
+    int32_t remainder;  // Остаток приращения на строку
+    int32_t dy;         // Высота ребра (16.16)
+    int16_t row_start;  // Первая строка
+    int16_t row_end;    // Строка после последней
+    int8_t winding;     // +1 - ребро идет вниз, -1 - вверх
+};
+
+// Видимая часть изображения: окно на холсте и соответствующий ему угол источника
+struct BlitWindow {
+    uint16_t x;
+    uint16_t y;
+    uint16_t w;
+    uint16_t h;
+    int32_t src_x;      // Столбец источника для левого столбца окна
+    int32_t src_y;      // Строка источника для верхней строки окна
+    int8_t step_x;      // -1 при отражении
+    int8_t step_y;
+};
+
+} // namespace CanvasDetail
+
+// Общий слой рисования для всех целей (дисплей, Framebuffer, статическая полоса).
+// Все примитивы реализованы один раз и обращаются к цели через статический полиморфизм
+// (CRTP), без виртуальных вызовов. Цель обязана реализовать следующие методы
+// (координаты уже отсечены по размеру холста и текущей области отсечения):
+//
+//   uint16_t canvasWidth() const;    // 0 - цель недоступна для рисования
+//   uint16_t canvasHeight() const;
+//   void writePixel(uint16_t x, uint16_t y, uint16_t color);
+//   void writeFillRect(uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint16_t color);
+//   void writeBegin(uint16_t x, uint16_t y, uint16_t w, uint16_t h);   // Окно потоковой записи
+//   void writePush(const uint16_t* pixels, uint32_t count);           // Пиксели по строкам окна
+//   void writeEnd();
+//
+// Необязательные методы (иначе используются реализации Canvas):
+//
+//   // Повтор строк в открытом окне: строка row - lines + (row % period) * count
+//   void writeRows(const uint16_t* lines, uint16_t count, uint16_t rows, uint8_t period);
+//   // Смешивание цвета с уже нарисованным пикселем (alpha 0..255). Цель без чтения
+//   // пикселей (дисплей без буфера кадра) рисует по порогу: alpha >= 128 - цвет
+//   void writeBlendPixel(uint16_t x, uint16_t y, uint16_t color, uint8_t alpha);
+//
+// Определения методов находятся в canvas_impl.hpp. Для целей библиотеки шаблон
+// инстанцируется в src/canvas.cpp; для собственной цели подключите canvas_impl.hpp
+// и объявите Canvas<Target> другом класса цели.
+template <typename Target>
+class Canvas {
+public:
+    // Стек областей отсечения. Координаты примитивов знаковые: фигура отсекается один раз
+    // по пересечению холста и вершины стека, внутренние циклы идут без проверок.
+    // pushClipRect пересекает прямоугольник с текущей областью; при переполнении
+    // стека возвращает false, и парный popClipRect не нужен
+    bool pushClipRect(int16_t x, int16_t y, uint16_t w, uint16_t h);
+    void popClipRect();
+    void resetClip() { clip_depth_ = 0; }
+    uint8_t getClipDepth() const { return clip_depth_; }
+    CanvasClip getClipRect() const;     // Текущая область с учетом размера холста
+
+    // Геометрические примитивы
+    void drawPixel(int16_t x, int16_t y, uint16_t color);
+    void drawHLine(int16_t x, int16_t y, uint16_t w, uint16_t color);
+    void drawVLine(int16_t x, int16_t y, uint16_t h, uint16_t color);
+    void drawLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color);
+    void drawRect(int16_t x, int16_t y, uint16_t w, uint16_t h, uint16_t color);
+    void fillRect(int16_t x, int16_t y, uint16_t w, uint16_t h, uint16_t color);
+    void fillScreen(uint16_t color);    // Заливка текущей области отсечения
+    void drawCircle(int16_t x0, int16_t y0, uint16_t r, uint16_t color);
+    void fillCircle(int16_t x0, int16_t y0, uint16_t r, uint16_t color);
+
+    // Заливка многоугольника по строкам (таблица ребер и список активных ребер).
+    // Пиксель закрашивается, если его центр внутри; каждый отрезок строки - одна заливка
+    // цели (в буфер кадра - fill_n, на дисплей - одно окно). Координаты вершин в 1/2^subpixel_bits
+    // пикселя (0..8) и по модулю меньше 8192 пикселей; вершин не больше CANVAS_MAX_POLYGON_POINTS
+    void fillPolygon(const CanvasPoint* points, uint8_t count, uint16_t color,
+                     FillRule rule = FillRule::NON_ZERO, uint8_t subpixel_bits = 0);
+    void fillTriangle(int16_t x0, int16_t y0, int16_t x1, int16_t y1, int16_t x2, int16_t y2, uint16_t color);
+
+    // Градиентная заливка прямоугольника. fillGradientH - цвет меняется слева направо:
+    // строка цветов вычисляется один раз и повторяется на всех строках (в буфер кадра - memcpy).
+    // fillGradientV - сверху вниз: один цвет на строку, строки одного цвета - одной заливкой.
+    // dither - упорядоченное сглаживание 4x4 между уровнями RGB565 (четыре строки цветов
+    // с периодом матрицы). fillMultiGradient* - до GRADIENT_MAX_STOPS опорных точек
+    void fillGradientH(int16_t x, int16_t y, uint16_t w, uint16_t h, uint16_t color0, uint16_t color1, bool dither = true);
+    void fillGradientV(int16_t x, int16_t y, uint16_t w, uint16_t h, uint16_t color0, uint16_t color1, bool dither = true);
+    void fillMultiGradientH(int16_t x, int16_t y, uint16_t w, uint16_t h, const GradientStop* stops, uint8_t count,
+                       bool dither = true);
+    void fillMultiGradientV(int16_t x, int16_t y, uint16_t w, uint16_t h, const GradientStop* stops, uint8_t count,
+                       bool dither = true);
+
+    // Скругленные прямоугольники, толстые линии и дуги: для каждой строки вычисляются точные
+    // границы отрезков, каждый пиксель закрашивается один раз. Прямые участки - одной заливкой.
+    // Углы дуги в градусах: 0 - вверх, по часовой стрелке; дуга от start_angle до end_angle.
+    // Концы толстой линии - по модулю меньше 8192 пикселей
+    void fillRoundRect(int16_t x, int16_t y, uint16_t w, uint16_t h, uint16_t r, uint16_t color);
+    void drawRoundRect(int16_t x, int16_t y, uint16_t w, uint16_t h, uint16_t r, uint16_t color, uint8_t thickness = 1);
+    void drawThickLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint8_t width, uint16_t color);
+    void fillArc(int16_t x0, int16_t y0, int16_t start_angle, int16_t end_angle,
+                 uint16_t inner_r, uint16_t outer_r, uint16_t color);
+
+    // Текст шрифтом 8x16. Черный фон (0x0000) означает прозрачный фон.
+    // Символы на краю области отсечения выводятся частично
+    void drawChar(int16_t x, int16_t y, char ch, uint16_t color, uint16_t bg_color = 0x0000);
+    void drawString(int16_t x, int16_t y, const char* str, uint16_t color, uint16_t bg_color = 0x0000);
+    void drawStringUTF8(int16_t x, int16_t y, const char* utf8_str, uint16_t color, uint16_t bg_color = 0x0000);
+
+    // Масштабированный текст (масштаб 1-8)
+    void drawCharScaled(int16_t x, int16_t y, char ch, uint16_t color, uint8_t scale, uint16_t bg_color = 0x0000);
+    void drawStringScaled(int16_t x, int16_t y, const char* str, uint16_t color, uint8_t scale, uint16_t bg_color = 0x0000);
+    void drawStringUTF8Scaled(int16_t x, int16_t y, const char* utf8_str, uint16_t color, uint8_t scale, uint16_t bg_color = 0x0000);
+
+    // Непрозрачные ячейки 8x16 (фон заливается всегда, в том числе черный)
+    void drawCharCell(int16_t x, int16_t y, uint32_t unicode_char, uint16_t color, uint8_t scale, uint16_t bg_color);
+    void drawTextCells(int16_t x, int16_t y, const uint32_t* codepoints, uint8_t count, uint16_t color, uint8_t scale, uint16_t bg_color);
+
+    // Пропорциональный текст (1/2/4 бита на пиксель)
+    // Сглаженный шрифт (bpp 2 / 4) с прозрачным фоном (bg_color = 0x0000) смешивает края
+    // глифов с уже нарисованным (writeBlendPixel): в прямом режиме дисплея без буфера кадра
+    // края рисуются по порогу, для сглаживания задайте непрозрачный bg_color.
+    // Шрифты с bpp, отличным от 1, 2 и 4, не выводятся
+    void drawStringProp(int16_t x, int16_t y, const char* utf8_str, const PropFont* font, uint16_t color, uint16_t bg_color = 0x0000);
+
+    // Вывод чисел без printf (ячейки непрозрачны)
+    void drawInt(int16_t x, int16_t y, int32_t value, uint16_t color, uint16_t bg_color = 0x0000,
+                 uint8_t width = 0, NumberAlign align = NumberAlign::RIGHT, uint8_t scale = 1);
+    void drawFixed(int16_t x, int16_t y, int32_t value, uint8_t decimals, uint16_t color, uint16_t bg_color = 0x0000,
+                   uint8_t width = 0, NumberAlign align = NumberAlign::RIGHT, uint8_t scale = 1);
+    void drawFloat(int16_t x, int16_t y, float value, uint8_t decimals, uint16_t color, uint16_t bg_color = 0x0000,
+                   uint8_t width = 0, NumberAlign align = NumberAlign::RIGHT, uint8_t scale = 1);
+
+    // Вывод изображений RGB565 (w x h, строки через stride пикселей; 0 - stride = w)
+    // с отсечением по области отсечения и отражением (BLIT_FLIP_X / BLIT_FLIP_Y).
+    // blit копирует строки целиком (в буфер кадра - memcpy), blitKeyed пропускает пиксели
+    // цвета key, blitMasked - пиксели с нулевым битом маски (1 бит на пиксель, строка
+    // выровнена по байту, старший бит - левый пиксель). Прозрачные изображения выводятся
+    // отрезками непрозрачных пикселей
+    void blit(int16_t x, int16_t y, uint16_t w, uint16_t h, const uint16_t* pixels,
+              uint8_t flags = BLIT_NONE, uint16_t stride = 0);
+    void blitKeyed(int16_t x, int16_t y, uint16_t w, uint16_t h, const uint16_t* pixels, uint16_t key,
+                   uint8_t flags = BLIT_NONE, uint16_t stride = 0);
+    void blitMasked(int16_t x, int16_t y, uint16_t w, uint16_t h, const uint16_t* pixels, const uint8_t* mask,
+                    uint8_t flags = BLIT_NONE, uint16_t stride = 0);
+    // Изображение с палитрой (индекс 1 байт). transparent_index от 0 до 255 - прозрачный индекс
+    void blitIndexed(int16_t x, int16_t y, uint16_t w, uint16_t h, const uint8_t* indices, const uint16_t* palette,
+                     int16_t transparent_index = -1, uint8_t flags = BLIT_NONE, uint16_t stride = 0);
+    // Изображение src_w x src_h, растянутое или сжатое до w x h (миниатюры, предпросмотр).
+    // Координаты источника - с 16 дробными битами по центрам пикселей. Строка источника
+    // масштабируется по горизонтали один раз и остается в кэше, пока нужна; подряд идущие
+    // одинаковые строки результата передаются одной группой (writeRows)
+    void blitScaled(int16_t x, int16_t y, uint16_t w, uint16_t h, const uint16_t* pixels, uint16_t src_w, uint16_t src_h,
+                    ScaleMode mode = ScaleMode::NEAREST, uint16_t stride = 0);
+    // Изображение в другом формате (камера, декодер): строки через stride пикселей
+    // переводятся в RGB565 кусками строчного буфера (Convert565_Span). flags - CONVERT565_DITHER
+    // (узор привязан к координатам экрана), CONVERT565_SWAP не учитывается
+    void blitConverted(int16_t x, int16_t y, uint16_t w, uint16_t h, const uint8_t* pixels, PixelFormat format,
+                       uint8_t flags = CONVERT565_NONE, uint16_t stride = 0);
+
+protected:
+    Canvas() = default;
+
+    // Отсечение изображения w x h в точке (x, y) по области отсечения с учетом отражения
+    bool blitWindow(int16_t x, int16_t y, uint16_t w, uint16_t h, uint8_t flags, CanvasDetail::BlitWindow& win);
+
+    // Реализации writeRows и writeBlendPixel по умолчанию (цель может определить собственные)
+    void writeRows(const uint16_t* lines, uint16_t count, uint16_t rows, uint8_t period);
+    void writeBlendPixel(uint16_t x, uint16_t y, uint16_t color, uint8_t alpha);
+
+private:
+    CanvasClip clip_stack_[CANVAS_CLIP_DEPTH];
+    uint8_t clip_depth_ = 0;
+
+    Target& target() { return static_cast<Target&>(*this); }
+    const Target& target() const { return static_cast<const Target&>(*this); }
+
+    template <typename Plot>
+    static void traceLine(int32_t x0, int32_t y0, int32_t x1, int32_t y1, Plot plot);
+    template <typename Plot>
+    static void traceCircle(int32_t r, Plot plot);
+
+    void fillClipped(int32_t x, int32_t y, int32_t w, int32_t h, uint16_t color);
+
+    void pushSourceRow(const uint16_t* first, int8_t step, uint16_t count);
+    template <typename Opaque>
+    void blitRuns(const CanvasDetail::BlitWindow& win, const uint16_t* pixels, uint16_t stride, Opaque opaque);
+
+    void drawGlyph(int32_t x, int32_t y, const uint8_t* glyph, uint16_t color, uint8_t scale, uint16_t bg_color);
+    void drawGlyphRun(int32_t x, int32_t y, const uint8_t* const* glyphs, uint8_t count, uint16_t color, uint8_t scale, uint16_t bg_color);
+    void drawText(int16_t x, int16_t y, const char* utf8_str, uint16_t color, uint8_t scale, uint16_t bg_color);
+    void drawNumberCells(int16_t x, int16_t y, const char* chars, uint8_t count, uint16_t color, uint8_t scale, uint16_t bg_color);
+};
+
+#endif
@@ -0,0 +1,1251 @@
+#ifndef CANVAS_IMPL_HPP
+#define CANVAS_IMPL_HPP
+
+// Определения методов Canvas. Подключается только там, где шаблон инстанцируется
+// (src/canvas.cpp или файл пользователя с собственной целью рисования).
+
+#include "canvas.hpp"
+#include "font8x16.hpp"
+#include "prop_font.hpp"
+#include "color_ramp.hpp"
+#include "fixed_math.hpp"
+#include "blend565.hpp"
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+
+namespace CanvasDetail {
+
+// Половина пикселя в координатах с 16 дробными битами
+constexpr uint32_t SCALE_HALF = 0x8000;
+
+// Горизонтальное масштабирование строки источника: count пикселей, позиция центра
+// первого пикселя pos, шаг step (в пикселях источника с 16 дробными битами)
+inline void scaleRow(uint16_t* out, const uint16_t* src, uint16_t src_w, uint32_t pos, uint32_t step,
+                     uint16_t count, ScaleMode mode) {
+    if (mode == ScaleMode::NEAREST) {
+        for (uint16_t i = 0; i < count; i++) {
+            out[i] = src[pos >> 16];
+            pos += step;
+        }
+        return;
+    }
+
+    // Левый сосед - пиксель, чей центр не правее точки; у краев берется крайний пиксель
+    for (uint16_t i = 0; i < count; i++) {
+        uint32_t p = (pos > SCALE_HALF) ? pos - SCALE_HALF : 0;
+        uint32_t sx = p >> 16;
+        out[i] = (sx + 1 >= src_w) ? src[src_w - 1]
+                                   : Blend565_Pixel(src[sx + 1], src[sx], static_cast<uint8_t>(p >> 8));
+        pos += step;
+    }
+}
+
+inline uint8_t clampScale(uint8_t scale) {
+    if (scale == 0) return 1;  // Минимальный масштаб 1
+    if (scale > 8) return 8;   // Максимальный масштаб 8
+    return scale;
+}
+
+// Отступ строки row (0..h-1) от края прямоугольника высотой h со скругленными углами радиуса r
+// (пиксель угла закрашивается, если его центр не дальше r от центра скругления)
+inline int32_t roundRectInset(int32_t h, int32_t r, int32_t row) {
+    int32_t dy = 0;
+    if (row < r) {
+        dy = r - row;
+    } else if (row >= h - r) {
+        dy = row - (h - 1 - r);
+    } else {
+        return 0;
+    }
+    return r - static_cast<int32_t>(FixedMath_Sqrt(static_cast<uint32_t>(r * r - dy * dy)));
+}
+
+} // namespace CanvasDetail
+
+// ===================== ОТСЕЧЕНИЕ =====================
+
+template <typename Target>
+bool Canvas<Target>::pushClipRect(int16_t x, int16_t y, uint16_t w, uint16_t h) {
+    if (clip_depth_ >= CANVAS_CLIP_DEPTH) return false;
+
+    // Новая область - пересечение с текущей (пустая область отсекает все)
+    int32_t x0 = std::max<int32_t>(x, 0);
+    int32_t y0 = std::max<int32_t>(y, 0);
+    int32_t x1 = std::min<int32_t>(static_cast<int32_t>(x) + w, INT16_MAX);
+    int32_t y1 = std::min<int32_t>(static_cast<int32_t>(y) + h, INT16_MAX);
+    if (clip_depth_ > 0) {
+        const CanvasClip& top = clip_stack_[clip_depth_ - 1];
+        x0 = std::max<int32_t>(x0, top.x0);
+        y0 = std::max<int32_t>(y0, top.y0);
+        x1 = std::min<int32_t>(x1, top.x1);
+        y1 = std::min<int32_t>(y1, top.y1);
+    }
+    x1 = std::max(x1, x0);
+    y1 = std::max(y1, y0);
+
+    clip_stack_[clip_depth_++] = {static_cast<int16_t>(x0), static_cast<int16_t>(y0),
+                                  static_cast<int16_t>(x1), static_cast<int16_t>(y1)};
+    return true;
+}
+
+template <typename Target>
+void Canvas<Target>::popClipRect() {
+    if (clip_depth_ > 0) clip_depth_--;
+}
+
+template <typename Target>
+CanvasClip Canvas<Target>::getClipRect() const {
+    CanvasClip clip = {0, 0, static_cast<int16_t>(target().canvasWidth()), static_cast<int16_t>(target().canvasHeight())};
+    if (clip_depth_ > 0) {
+        const CanvasClip& top = clip_stack_[clip_depth_ - 1];
+        clip.x0 = std::min(top.x0, clip.x1);
+        clip.y0 = std::min(top.y0, clip.y1);
+        clip.x1 = std::min(top.x1, clip.x1);
+        clip.y1 = std::min(top.y1, clip.y1);
+    }
+    return clip;
+}
+
+// ===================== ГЕОМЕТРИЧЕСКИЕ ПРИМИТИВЫ =====================
+
+template <typename Target>
+void Canvas<Target>::drawPixel(int16_t x, int16_t y, uint16_t color) {
+    CanvasClip clip = getClipRect();
+    if (x < clip.x0 || x >= clip.x1 || y < clip.y0 || y >= clip.y1) return;
+    target().writePixel(static_cast<uint16_t>(x), static_cast<uint16_t>(y), color);
+}
+
+template <typename Target>
+void Canvas<Target>::fillRect(int16_t x, int16_t y, uint16_t w, uint16_t h, uint16_t color) {
+    fillClipped(x, y, w, h, color);
+}
+
+template <typename Target>
+void Canvas<Target>::fillClipped(int32_t x, int32_t y, int32_t w, int32_t h, uint16_t color) {
+    CanvasClip clip = getClipRect();
+    int32_t x0 = std::max<int32_t>(x, clip.x0);
+    int32_t y0 = std::max<int32_t>(y, clip.y0);
+    int32_t x1 = std::min<int32_t>(x + w, clip.x1);
+    int32_t y1 = std::min<int32_t>(y + h, clip.y1);
+    if (x0 >= x1 || y0 >= y1) return;
+    target().writeFillRect(static_cast<uint16_t>(x0), static_cast<uint16_t>(y0),
+                           static_cast<uint16_t>(x1 - x0), static_cast<uint16_t>(y1 - y0), color);
+}
+
+template <typename Target>
+void Canvas<Target>::writeBlendPixel(uint16_t x, uint16_t y, uint16_t color, uint8_t alpha) {
+    if (alpha >= 128) {
+        target().writePixel(x, y, color);
+    }
+}
+
+template <typename Target>
+void Canvas<Target>::drawHLine(int16_t x, int16_t y, uint16_t w, uint16_t color) {
+    fillClipped(x, y, w, 1, color);
+}
+
+template <typename Target>
+void Canvas<Target>::drawVLine(int16_t x, int16_t y, uint16_t h, uint16_t color) {
+    fillClipped(x, y, 1, h, color);
+}
+
+template <typename Target>
+void Canvas<Target>::fillScreen(uint16_t color) {
+    fillClipped(0, 0, target().canvasWidth(), target().canvasHeight(), color);
+}
+
+template <typename Target>
+template <typename Plot>
+void Canvas<Target>::traceLine(int32_t x0, int32_t y0, int32_t x1, int32_t y1, Plot plot) {
+    int32_t dx = abs(x1 - x0);
+    int32_t dy = abs(y1 - y0);
+    int32_t sx = (x0 < x1) ? 1 : -1;
+    int32_t sy = (y0 < y1) ? 1 : -1;
+    int32_t err = dx - dy;
+
+    while (true) {
+        plot(x0, y0);
+
+        if (x0 == x1 && y0 == y1) break;
+
+        int32_t e2 = 2 * err;
+        if (e2 > -dy) {
+            err -= dy;
+            x0 += sx;
+        }
+        if (e2 < dx) {
+            err += dx;
+            y0 += sy;
+        }
+    }
+}
+
+template <typename Target>
+void Canvas<Target>::drawLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color) {
+    // Горизонтальные и вертикальные линии - одним отрезком
+    if (y0 == y1) {
+        fillClipped(std::min(x0, x1), y0, abs(x1 - x0) + 1, 1, color);
+        return;
+    }
+    if (x0 == x1) {
+        fillClipped(x0, std::min(y0, y1), 1, abs(y1 - y0) + 1, color);
+        return;
+    }
+
+    // Линия целиком вне области отбрасывается, целиком внутри - рисуется без проверок
+    CanvasClip clip = getClipRect();
+    if (std::max(x0, x1) < clip.x0 || std::min(x0, x1) >= clip.x1 ||
+        std::max(y0, y1) < clip.y0 || std::min(y0, y1) >= clip.y1) return;
+
+    if (std::min(x0, x1) >= clip.x0 && std::max(x0, x1) < clip.x1 &&
+        std::min(y0, y1) >= clip.y0 && std::max(y0, y1) < clip.y1) {
+        traceLine(x0, y0, x1, y1, [this, color](int32_t x, int32_t y) {
+            target().writePixel(static_cast<uint16_t>(x), static_cast<uint16_t>(y), color);
+        });
+    } else {
+        traceLine(x0, y0, x1, y1, [this, &clip, color](int32_t x, int32_t y) {
+            if (x >= clip.x0 && x < clip.x1 && y >= clip.y0 && y < clip.y1) {
+                target().writePixel(static_cast<uint16_t>(x), static_cast<uint16_t>(y), color);
+            }
+        });
+    }
+}
+
+template <typename Target>
+void Canvas<Target>::drawRect(int16_t x, int16_t y, uint16_t w, uint16_t h, uint16_t color) {
+    if (w == 0 || h == 0) return;
+
+    // Верхняя и нижняя горизонтальные линии
+    fillClipped(x, y, w, 1, color);
+    fillClipped(x, y + h - 1, w, 1, color);
+
+    // Левая и правая вертикальные линии без угловых пикселей
+    if (h > 2) {
+        fillClipped(x, y + 1, 1, h - 2, color);
+        fillClipped(x + w - 1, y + 1, 1, h - 2, color);
+    }
+}
+
+template <typename Target>
+template <typename Plot>
+void Canvas<Target>::traceCircle(int32_t r, Plot plot) {
+    int32_t x = r;
+    int32_t y = 0;
+    int32_t err = 0;
+
+    while (x >= y) {
+        plot(x, y);
+        plot(y, x);
+        plot(-y, x);
+        plot(-x, y);
+        plot(-x, -y);
+        plot(-y, -x);
+        plot(y, -x);
+        plot(x, -y);
+
+        if (err <= 0) {
+            y += 1;
+            err += 2*y + 1;
+        }
+
+        if (err > 0) {
+            x -= 1;
+            err -= 2*x + 1;
+        }
+    }
+}
+
+template <typename Target>
+void Canvas<Target>::drawCircle(int16_t x0, int16_t y0, uint16_t r, uint16_t color) {
+    // Окружность целиком вне области отбрасывается, целиком внутри - рисуется без проверок
+    CanvasClip clip = getClipRect();
+    if (x0 + r < clip.x0 || x0 - r >= clip.x1 || y0 + r < clip.y0 || y0 - r >= clip.y1) return;
+
+    if (x0 - r >= clip.x0 && x0 + r < clip.x1 && y0 - r >= clip.y0 && y0 + r < clip.y1) {
+        traceCircle(r, [this, x0, y0, color](int32_t dx, int32_t dy) {
+            target().writePixel(static_cast<uint16_t>(x0 + dx), static_cast<uint16_t>(y0 + dy), color);
+        });
+    } else {
+        traceCircle(r, [this, x0, y0, &clip, color](int32_t dx, int32_t dy) {
+            int32_t x = x0 + dx;
+            int32_t y = y0 + dy;
+            if (x >= clip.x0 && x < clip.x1 && y >= clip.y0 && y < clip.y1) {
+                target().writePixel(static_cast<uint16_t>(x), static_cast<uint16_t>(y), color);
+            }
+        });
+    }
+}
+
+template <typename Target>
+void Canvas<Target>::fillCircle(int16_t x0, int16_t y0, uint16_t r, uint16_t color) {
+    // Круг заливается горизонтальными отрезками: x*x + y*y <= r*r; строки вне области не считаются
+    CanvasClip clip = getClipRect();
+    uint32_t r2 = static_cast<uint32_t>(r) * r;
+    int32_t dy_min = std::max<int32_t>(clip.y0 - y0, -r);
+    int32_t dy_max = std::min<int32_t>(clip.y1 - 1 - y0, r);
+
+    for (int32_t dy = dy_min; dy <= dy_max; dy++) {
+        int32_t dx = static_cast<int32_t>(FixedMath_Sqrt(r2 - static_cast<uint32_t>(dy) * static_cast<uint32_t>(dy)));
+        fillClipped(x0 - dx, y0 + dy, 2 * dx + 1, 1, color);
+    }
+}
+
+template <typename Target>
+void Canvas<Target>::fillPolygon(const CanvasPoint* points, uint8_t count, uint16_t color, FillRule rule, uint8_t subpixel_bits) {
+    CanvasClip clip = getClipRect();
+    if (points == nullptr || count < 3 || count > CANVAS_MAX_POLYGON_POINTS || subpixel_bits > 8) return;
+
+    // Таблица ребер: горизонтальные ребра и ребра вне области отсечения по вертикали
+    // отбрасываются, ребра выше области сразу сдвигаются на ее первую строку
+    CanvasDetail::PolygonEdge edges[CANVAS_MAX_POLYGON_POINTS];
+    uint8_t edge_count = 0;
+    int32_t row_min = clip.y1;
+    int32_t row_max = clip.y0;
+
+    for (uint8_t i = 0; i < count; i++) {
+        const CanvasPoint& p0 = points[i];
+        const CanvasPoint& p1 = points[(i + 1 == count) ? 0 : i + 1];
+        if (p0.y == p1.y) continue;
+
+        int8_t winding = (p1.y > p0.y) ? 1 : -1;
+        const CanvasPoint& top = (winding > 0) ? p0 : p1;
+        const CanvasPoint& bottom = (winding > 0) ? p1 : p0;
+
+        int64_t x_top = static_cast<int64_t>(top.x) * (65536 >> subpixel_bits);
+        int64_t y_top = static_cast<int64_t>(top.y) * (65536 >> subpixel_bits);
+        int64_t x_bottom = static_cast<int64_t>(bottom.x) * (65536 >> subpixel_bits);
+        int64_t y_bottom = static_cast<int64_t>(bottom.y) * (65536 >> subpixel_bits);
+
+        // Строки, центры которых (row + 0.5) попадают в [y_top, y_bottom)
+        int32_t row_start = static_cast<int32_t>((y_top + 0x7FFF) >> 16);
+        int32_t row_end = static_cast<int32_t>((y_bottom + 0x7FFF) >> 16);
+        row_start = std::max<int32_t>(row_start, clip.y0);
+        row_end = std::min<int32_t>(row_end, clip.y1);
+        if (row_start >= row_end) continue;
+
+        // x = x_top + (center - y_top) * dx / dy с округлением вниз; дальше по строке - с остатком
+        CanvasDetail::PolygonEdge& edge = edges[edge_count++];
+        int64_t dx = x_bottom - x_top;
+        int64_t dy = y_bottom - y_top;
+        int64_t center = static_cast<int64_t>(row_start) * 65536 + 0x8000;
+        int64_t offset = (center - y_top) * dx;
+        int64_t step = dx * 65536;
+        int64_t offset_floor = offset / dy - ((offset % dy < 0) ? 1 : 0);
+        int64_t step_floor = step / dy - ((step % dy < 0) ? 1 : 0);
+        edge.x = static_cast<int32_t>(x_top + offset_floor);
+        edge.error = static_cast<int32_t>(offset - offset_floor * dy);
+        edge.dxdy = static_cast<int32_t>(step_floor);
+        edge.remainder = static_cast<int32_t>(step - step_floor * dy);
+        edge.dy = static_cast<int32_t>(dy);
+        edge.row_start = static_cast<int16_t>(row_start);
+        edge.row_end = static_cast<int16_t>(row_end);
+        edge.winding = winding;
+
+        row_min = std::min(row_min, row_start);
+        row_max = std::max(row_max, row_end);
+    }
+    if (edge_count < 2) return;
+
+    // Ребра по первой строке: новые активные ребра берутся с начала таблицы
+    std::sort(edges, edges + edge_count, [](const CanvasDetail::PolygonEdge& a, const CanvasDetail::PolygonEdge& b) {
+        return a.row_start < b.row_start;
+    });
+
+    CanvasDetail::PolygonEdge* active[CANVAS_MAX_POLYGON_POINTS];
+    uint8_t active_count = 0;
+    uint8_t next_edge = 0;
+
+    for (int32_t row = row_min; row < row_max; row++) {
+        // Удаление закончившихся и добавление начинающихся ребер
+        uint8_t kept = 0;
+        for (uint8_t i = 0; i < active_count; i++) {
+            if (active[i]->row_end > row) active[kept++] = active[i];
+        }
+        active_count = kept;
+        while (next_edge < edge_count && edges[next_edge].row_start == row) {
+            active[active_count++] = &edges[next_edge++];
+        }
+
+        // Сортировка вставками: порядок ребер от строки к строке почти не меняется
+        for (uint8_t i = 1; i < active_count; i++) {
+            CanvasDetail::PolygonEdge* edge = active[i];
+            uint8_t j = i;
+            while (j > 0 && active[j - 1]->x > edge->x) {
+                active[j] = active[j - 1];
+                j--;
+            }
+            active[j] = edge;
+        }
+
+        // Проход по пересечениям: отрезок между входом и выходом из многоугольника
+        int32_t winding = 0;
+        int32_t span_start = 0;
+        for (uint8_t i = 0; i < active_count; i++) {
+            bool was_inside = (rule == FillRule::EVEN_ODD) ? (winding & 1) : (winding != 0);
+            winding += active[i]->winding;
+            bool inside = (rule == FillRule::EVEN_ODD) ? (winding & 1) : (winding != 0);
+
+            // Пиксели, центры которых (x + 0.5) в [x_left, x_right)
+            int32_t x = (active[i]->x + 0x7FFF) >> 16;
+            if (!was_inside && inside) {
+                span_start = x;
+            } else if (was_inside && !inside) {
+                int32_t x0 = std::max<int32_t>(span_start, clip.x0);
+                int32_t x1 = std::min<int32_t>(x, clip.x1);
+                if (x0 < x1) {
+                    target().writeFillRect(static_cast<uint16_t>(x0), static_cast<uint16_t>(row), static_cast<uint16_t>(x1 - x0), 1, color);
+                }
+            }
+        }
+
+        for (uint8_t i = 0; i < active_count; i++) {
+            CanvasDetail::PolygonEdge* edge = active[i];
+            edge->x += edge->dxdy;
+            edge->error += edge->remainder;
+            if (edge->error >= edge->dy) {
+                edge->x++;
+                edge->error -= edge->dy;
+            }
+        }
+    }
+}
+
+template <typename Target>
+void Canvas<Target>::fillTriangle(int16_t x0, int16_t y0, int16_t x1, int16_t y1, int16_t x2, int16_t y2, uint16_t color) {
+    const CanvasPoint points[3] = {{x0, y0}, {x1, y1}, {x2, y2}};
+    fillPolygon(points, 3, color);
+}
+
+// ===================== ГРАДИЕНТЫ =====================
+
+template <typename Target>
+void Canvas<Target>::writeRows(const uint16_t* lines, uint16_t count, uint16_t rows, uint8_t period) {
+    for (uint16_t row = 0; row < rows; row++) {
+        target().writePush(lines + (row % period) * count, count);
+    }
+}
+
+template <typename Target>
+void Canvas<Target>::fillGradientH(int16_t x, int16_t y, uint16_t w, uint16_t h, uint16_t color0, uint16_t color1, bool dither) {
+    const GradientStop stops[2] = {{0, color0}, {255, color1}};
+    fillMultiGradientH(x, y, w, h, stops, 2, dither);
+}
+
+template <typename Target>
+void Canvas<Target>::fillGradientV(int16_t x, int16_t y, uint16_t w, uint16_t h, uint16_t color0, uint16_t color1, bool dither) {
+    const GradientStop stops[2] = {{0, color0}, {255, color1}};
+    fillMultiGradientV(x, y, w, h, stops, 2, dither);
+}
+
+template <typename Target>
+void Canvas<Target>::fillMultiGradientH(int16_t x, int16_t y, uint16_t w, uint16_t h, const GradientStop* stops, uint8_t count,
+                                   bool dither) {
+    CanvasDetail::BlitWindow win;
+    if (stops == nullptr || count == 0 || count > GRADIENT_MAX_STOPS || !blitWindow(x, y, w, h, BLIT_NONE, win)) return;
+
+    // Видимая часть делится на куски строчного буфера; со сглаживанием буфер вмещает
+    // четыре строки куска (строки матрицы), и строка окна row берет строку row % 4
+    uint16_t line[CANVAS_LINE_PIXELS];
+    uint16_t max_chunk = dither ? CANVAS_LINE_PIXELS / 4 : CANVAS_LINE_PIXELS;
+    uint8_t period = dither ? 4 : 1;
+
+    for (uint16_t done = 0; done < win.w; ) {
+        uint16_t chunk = std::min<uint16_t>(win.w - done, max_chunk);
+        int32_t chunk_x = win.x + done;
+        for (uint8_t phase = 0; phase < period; phase++) {
+            Gradient_Line(line + phase * chunk, chunk, stops, count, w, win.src_x + done,
+                          chunk_x, dither ? win.y + phase : -1);
+        }
+
+        target().writeBegin(static_cast<uint16_t>(chunk_x), win.y, chunk, win.h);
+        target().writeRows(line, chunk, win.h, period);
+        target().writeEnd();
+        done += chunk;
+    }
+}
+
+template <typename Target>
+void Canvas<Target>::fillMultiGradientV(int16_t x, int16_t y, uint16_t w, uint16_t h, const GradientStop* stops, uint8_t count,
+                                   bool dither) {
+    CanvasDetail::BlitWindow win;
+    if (stops == nullptr || count == 0 || count > GRADIENT_MAX_STOPS || !blitWindow(x, y, w, h, BLIT_NONE, win)) return;
+
+    GradientCursor cursor;
+    Gradient_Seek(cursor, stops, count, h, win.src_y);
+
+    if (!dither) {
+        // Один цвет на строку; подряд идущие строки одного цвета - одной заливкой
+        uint16_t run_start = 0;
+        uint16_t run_color = Gradient_Color(cursor, GRADIENT_ROUND_BIAS);
+        for (uint16_t row = 1; row <= win.h; row++) {
+            uint16_t color = 0;
+            if (row < win.h) {
+                Gradient_Next(cursor);
+                color = Gradient_Color(cursor, GRADIENT_ROUND_BIAS);
+                if (color == run_color) continue;
+            }
+            target().writeFillRect(win.x, static_cast<uint16_t>(win.y + run_start), win.w, row - run_start, run_color);
+            run_start = row;
+            run_color = color;
+        }
+        return;
+    }
+
+    // Со сглаживанием строка - четыре цвета с периодом 4 по x. Кусок строчного буфера
+    // (кратный 4) заполняется один раз и повторяется по ширине окна
+    uint16_t line[CANVAS_LINE_PIXELS];
+    uint16_t chunk = std::min<uint16_t>(win.w, CANVAS_LINE_PIXELS);
+
+    target().writeBegin(win.x, win.y, win.w, win.h);
+    for (uint16_t row = 0; row < win.h; row++) {
+        uint16_t colors[4];
+        for (uint8_t i = 0; i < 4; i++) {
+            colors[i] = Gradient_Color(cursor, Gradient_DitherBias(win.x + i, win.y + row));
+        }
+        for (uint16_t i = 0; i < chunk; i++) {
+            line[i] = colors[i & 3];
+        }
+        for (uint16_t done = 0; done < win.w; done += chunk) {
+            target().writeRows(line, std::min<uint16_t>(chunk, win.w - done), 1, 1);
+        }
+        Gradient_Next(cursor);
+    }
+    target().writeEnd();
+}
+
+// ===================== СКРУГЛЕННЫЕ ФИГУРЫ, ТОЛСТЫЕ ЛИНИИ, ДУГИ =====================
+
+template <typename Target>
+void Canvas<Target>::fillRoundRect(int16_t x, int16_t y, uint16_t w, uint16_t h, uint16_t r, uint16_t color) {
+    if (w == 0 || h == 0) return;
+    int32_t radius = std::min<int32_t>(r, std::min(w, h) / 2);
+
+    // Строки скруглений - по отрезку, прямая часть - одной заливкой
+    for (int32_t row = 0; row < radius; row++) {
+        int32_t inset = CanvasDetail::roundRectInset(h, radius, row);
+        fillClipped(x + inset, y + row, w - 2 * inset, 1, color);
+        fillClipped(x + inset, y + h - 1 - row, w - 2 * inset, 1, color);
+    }
+    fillClipped(x, y + radius, w, h - 2 * radius, color);
+}
+
+template <typename Target>
+void Canvas<Target>::drawRoundRect(int16_t x, int16_t y, uint16_t w, uint16_t h, uint16_t r, uint16_t color, uint8_t thickness) {
+    if (w == 0 || h == 0) return;
+    int32_t t = std::max<uint8_t>(thickness, 1);
+    if (2 * t >= w || 2 * t >= h) {
+        fillRoundRect(x, y, w, h, r, color);
+        return;
+    }
+
+    // Рамка = внешний скругленный прямоугольник минус внутренний (отступ t, радиус r - t)
+    int32_t radius = std::min<int32_t>(r, std::min(w, h) / 2);
+    int32_t inner_w = w - 2 * t;
+    int32_t inner_h = h - 2 * t;
+    int32_t inner_radius = std::min<int32_t>(std::max<int32_t>(radius - t, 0), std::min(inner_w, inner_h) / 2);
+
+    // Строки с прямыми боковыми сторонами: [band, h - band)
+    int32_t band = std::max(radius, t);
+    CanvasClip clip = getClipRect();
+    int32_t row_start = std::max<int32_t>(0, clip.y0 - y);
+    int32_t row_end = std::min<int32_t>(h, clip.y1 - y);
+
+    for (int32_t row = row_start; row < row_end; row++) {
+        if (row >= band && row < h - band) {
+            fillClipped(x, y + row, t, h - band - row, color);
+            fillClipped(x + w - t, y + row, t, h - band - row, color);
+            row = h - band - 1;
+            continue;
+        }
+
+        int32_t outer = CanvasDetail::roundRectInset(h, radius, row);
+        if (row < t || row >= h - t) {
+            fillClipped(x + outer, y + row, w - 2 * outer, 1, color);
+            continue;
+        }
+        int32_t inner = t + CanvasDetail::roundRectInset(inner_h, inner_radius, row - t);
+        fillClipped(x + outer, y + row, inner - outer, 1, color);
+        fillClipped(x + w - inner, y + row, inner - outer, 1, color);
+    }
+}
+
+template <typename Target>
+void Canvas<Target>::drawThickLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint8_t width, uint16_t color) {
+    if (width == 0) return;
+    int32_t dx = x1 - x0;
+    int32_t dy = y1 - y0;
+
+    // Прямоугольник из четырех полуплоскостей вокруг отрезка между центрами пикселей:
+    // s - расстояние поперек (Q14), t - вдоль; на каждой строке отрезок [lo, hi] находится сразу
+    constexpr int32_t ONE = FIXED_MATH_ONE;
+    uint32_t len16 = FixedMath_Length16(dx, dy);
+    int32_t ux = ONE;
+    int32_t uy = 0;
+    if (len16 != 0) {
+        ux = static_cast<int32_t>((static_cast<int64_t>(dx) * ONE * 16) / static_cast<int64_t>(len16));
+        uy = static_cast<int32_t>((static_cast<int64_t>(dy) * ONE * 16) / static_cast<int64_t>(len16));
+    }
+    int32_t half = width * (ONE / 2);
+    int32_t length = static_cast<int32_t>(len16) * (ONE / 16);
+    int32_t reach = width / 2 + 1;
+
+    CanvasClip clip = getClipRect();
+    int32_t y_start = std::max<int32_t>(std::min(y0, y1) - reach, clip.y0);
+    int32_t y_end = std::min<int32_t>(std::max(y0, y1) + reach, clip.y1 - 1);
+
+    for (int32_t y = y_start; y <= y_end; y++) {
+        int32_t ry = y - y0;
+        // -w/2 <= s < w/2, -1/2 <= t < length + 1/2
+        int32_t lo = clip.x0 - x0;
+        int32_t hi = clip.x1 - 1 - x0;
+        FixedMath_LimitRange(uy, half - ux * ry, 1, lo, hi);
+        FixedMath_LimitRange(-uy, half + ux * ry, 0, lo, hi);
+        FixedMath_LimitRange(ux, uy * ry + ONE / 2, 0, lo, hi);
+        FixedMath_LimitRange(-ux, length + ONE / 2 - uy * ry, 1, lo, hi);
+        if (lo <= hi) {
+            target().writeFillRect(static_cast<uint16_t>(x0 + lo), static_cast<uint16_t>(y),
+                                   static_cast<uint16_t>(hi - lo + 1), 1, color);
+        }
+    }
+}
+
+template <typename Target>
+void Canvas<Target>::fillArc(int16_t x0, int16_t y0, int16_t start_angle, int16_t end_angle,
+                             uint16_t inner_r, uint16_t outer_r, uint16_t color) {
+    if (outer_r < inner_r || outer_r > 0x7FFF) return;
+
+    int32_t sweep = (end_angle - start_angle) % 360;
+    if (sweep < 0) sweep += 360;
+    if (sweep == 0 && end_angle != start_angle) sweep = 360;
+    if (sweep == 0) return;
+
+    // Направления лучей в Q14 (0 - вверх, по часовой стрелке). Дуга до 180 градусов -
+    // пересечение двух полуплоскостей; больше - кольцо без сектора, дополняющего ее до круга
+    int32_t sx = FixedMath_Sin(start_angle);
+    int32_t sy = -FixedMath_Cos(start_angle);
+    int32_t ex = FixedMath_Sin(end_angle);
+    int32_t ey = -FixedMath_Cos(end_angle);
+    bool full = (sweep == 360);
+    bool wide = (sweep > 180);
+
+    int32_t outer2 = static_cast<int32_t>(outer_r) * outer_r;
+    int32_t inner2 = static_cast<int32_t>(inner_r) * inner_r;
+    CanvasClip clip = getClipRect();
+    int32_t y_start = std::max<int32_t>(y0 - outer_r, clip.y0);
+    int32_t y_end = std::min<int32_t>(y0 + outer_r, clip.y1 - 1);
+    int32_t x_min = clip.x0 - x0;
+    int32_t x_max = clip.x1 - 1 - x0;
+
+    for (int32_t y = y_start; y <= y_end; y++) {
+        int32_t dy = y - y0;
+        int32_t dy2 = dy * dy;
+
+        // Кольцо inner_r^2 <= dx^2 + dy^2 <= outer_r^2: один или два отрезка
+        int32_t xo = static_cast<int32_t>(FixedMath_Sqrt(static_cast<uint32_t>(outer2 - dy2)));
+        int32_t xi = static_cast<int32_t>(FixedMath_CeilSqrt(inner2 - dy2));
+        int32_t ring[2][2] = {{-xo, -xi}, {xi, xo}};
+        uint8_t ring_count = 2;
+        if (xi == 0) {
+            ring[0][1] = xo;
+            ring_count = 1;
+        }
+
+        // Сектор на строке - отрезок [a_lo, a_hi] (включенный или исключенный)
+        int32_t a_lo = x_min;
+        int32_t a_hi = x_max;
+        if (!full && !wide) {
+            FixedMath_LimitRange(-sy, sx * dy, 0, a_lo, a_hi);
+            FixedMath_LimitRange(ey, -ex * dy, 0, a_lo, a_hi);
+        } else if (wide) {
+            FixedMath_LimitRange(-ey, ex * dy, 1, a_lo, a_hi);
+            FixedMath_LimitRange(sy, -sx * dy, 1, a_lo, a_hi);
+        }
+
+        for (uint8_t i = 0; i < ring_count; i++) {
+            int32_t lo = std::max(ring[i][0], x_min);
+            int32_t hi = std::min(ring[i][1], x_max);
+            if (!full && !wide) {
+                lo = std::max(lo, a_lo);
+                hi = std::min(hi, a_hi);
+                fillClipped(x0 + lo, y, hi - lo + 1, 1, color);
+            } else if (full || a_lo > a_hi) {
+                fillClipped(x0 + lo, y, hi - lo + 1, 1, color);
+            } else {
+                fillClipped(x0 + lo, y, std::min(hi, a_lo - 1) - lo + 1, 1, color);
+                fillClipped(x0 + std::max(lo, a_hi + 1), y, hi - std::max(lo, a_hi + 1) + 1, 1, color);
+            }
+        }
+    }
+}
+
+// ===================== ВЫВОД ИЗОБРАЖЕНИЙ =====================
+
+template <typename Target>
+bool Canvas<Target>::blitWindow(int16_t x, int16_t y, uint16_t w, uint16_t h, uint8_t flags, CanvasDetail::BlitWindow& win) {
+    CanvasClip clip = getClipRect();
+    int32_t x0 = std::max<int32_t>(x, clip.x0);
+    int32_t y0 = std::max<int32_t>(y, clip.y0);
+    int32_t x1 = std::min<int32_t>(static_cast<int32_t>(x) + w, clip.x1);
+    int32_t y1 = std::min<int32_t>(static_cast<int32_t>(y) + h, clip.y1);
+    if (x0 >= x1 || y0 >= y1) return false;
+
+    win.x = static_cast<uint16_t>(x0);
+    win.y = static_cast<uint16_t>(y0);
+    win.w = static_cast<uint16_t>(x1 - x0);
+    win.h = static_cast<uint16_t>(y1 - y0);
+
+    // При отражении левый столбец окна берется с правого края источника
+    win.step_x = (flags & BLIT_FLIP_X) ? -1 : 1;
+    win.step_y = (flags & BLIT_FLIP_Y) ? -1 : 1;
+    win.src_x = (flags & BLIT_FLIP_X) ? (w - 1) - (x0 - x) : (x0 - x);
+    win.src_y = (flags & BLIT_FLIP_Y) ? (h - 1) - (y0 - y) : (y0 - y);
+    return true;
+}
+
+template <typename Target>
+void Canvas<Target>::pushSourceRow(const uint16_t* first, int8_t step, uint16_t count) {
+    if (step > 0) {
+        target().writePush(first, count);
+        return;
+    }
+
+    // Отраженная строка собирается в строчный буфер
+    uint16_t line[CANVAS_LINE_PIXELS];
+    while (count > 0) {
+        uint16_t chunk = std::min<uint16_t>(count, CANVAS_LINE_PIXELS);
+        for (uint16_t i = 0; i < chunk; i++) {
+            line[i] = *(first - i);
+        }
+        target().writePush(line, chunk);
+        first -= chunk;
+        count -= chunk;
+    }
+}
+
+template <typename Target>
+template <typename Opaque>
+void Canvas<Target>::blitRuns(const CanvasDetail::BlitWindow& win, const uint16_t* pixels, uint16_t stride, Opaque opaque) {
+    for (uint16_t row = 0; row < win.h; row++) {
+        int32_t sy = win.src_y + row * win.step_y;
+        const uint16_t* src = pixels + sy * stride;
+
+        uint16_t col = 0;
+        while (col < win.w) {
+            // Поиск отрезка непрозрачных пикселей
+            while (col < win.w && !opaque(win.src_x + col * win.step_x, sy, src[win.src_x + col * win.step_x])) col++;
+            uint16_t start = col;
+            while (col < win.w && opaque(win.src_x + col * win.step_x, sy, src[win.src_x + col * win.step_x])) col++;
+            if (col == start) continue;
+
+            target().writeBegin(win.x + start, win.y + row, col - start, 1);
+            pushSourceRow(src + win.src_x + start * win.step_x, win.step_x, col - start);
+            target().writeEnd();
+        }
+    }
+}
+
+template <typename Target>
+void Canvas<Target>::blit(int16_t x, int16_t y, uint16_t w, uint16_t h, const uint16_t* pixels, uint8_t flags, uint16_t stride) {
+    CanvasDetail::BlitWindow win;
+    if (pixels == nullptr || !blitWindow(x, y, w, h, flags, win)) return;
+    if (stride == 0) stride = w;
+
+    // Одно окно на все изображение, строки передаются целиком
+    target().writeBegin(win.x, win.y, win.w, win.h);
+    for (uint16_t row = 0; row < win.h; row++) {
+        const uint16_t* src = pixels + (win.src_y + row * win.step_y) * stride + win.src_x;
+        pushSourceRow(src, win.step_x, win.w);
+    }
+    target().writeEnd();
+}
+
+template <typename Target>
+void Canvas<Target>::blitKeyed(int16_t x, int16_t y, uint16_t w, uint16_t h, const uint16_t* pixels, uint16_t key,
+                               uint8_t flags, uint16_t stride) {
+    CanvasDetail::BlitWindow win;
+    if (pixels == nullptr || !blitWindow(x, y, w, h, flags, win)) return;
+    if (stride == 0) stride = w;
+
+    blitRuns(win, pixels, stride, [key](int32_t, int32_t, uint16_t color) { return color != key; });
+}
+
+template <typename Target>
+void Canvas<Target>::blitMasked(int16_t x, int16_t y, uint16_t w, uint16_t h, const uint16_t* pixels, const uint8_t* mask,
+                                uint8_t flags, uint16_t stride) {
+    CanvasDetail::BlitWindow win;
+    if (pixels == nullptr || mask == nullptr || !blitWindow(x, y, w, h, flags, win)) return;
+    if (stride == 0) stride = w;
+
+    uint16_t mask_stride = (w + 7) / 8;
+    blitRuns(win, pixels, stride, [mask, mask_stride](int32_t sx, int32_t sy, uint16_t) {
+        return (mask[sy * mask_stride + (sx >> 3)] & (0x80 >> (sx & 7))) != 0;
+    });
+}
+
+template <typename Target>
+void Canvas<Target>::blitIndexed(int16_t x, int16_t y, uint16_t w, uint16_t h, const uint8_t* indices, const uint16_t* palette,
+                                 int16_t transparent_index, uint8_t flags, uint16_t stride) {
+    CanvasDetail::BlitWindow win;
+    if (indices == nullptr || palette == nullptr || !blitWindow(x, y, w, h, flags, win)) return;
+    if (stride == 0) stride = w;
+
+    // Строка переводится в цвета через строчный буфер (уже в порядке вывода)
+    uint16_t line[CANVAS_LINE_PIXELS];
+    bool opaque_image = (transparent_index < 0 || transparent_index > 255);
+
+    if (opaque_image) {
+        target().writeBegin(win.x, win.y, win.w, win.h);
+    }
+    for (uint16_t row = 0; row < win.h; row++) {
+        const uint8_t* src = indices + (win.src_y + row * win.step_y) * stride;
+
+        for (uint16_t done = 0; done < win.w; ) {
+            uint16_t chunk = std::min<uint16_t>(win.w - done, CANVAS_LINE_PIXELS);
+            const uint8_t* first = src + win.src_x + done * win.step_x;
+            for (uint16_t i = 0; i < chunk; i++) {
+                line[i] = palette[*(first + i * win.step_x)];
+            }
+
+            if (opaque_image) {
+                target().writePush(line, chunk);
+            } else {
+                // Отрезки без прозрачного индекса
+                uint16_t col = 0;
+                while (col < chunk) {
+                    while (col < chunk && *(first + col * win.step_x) == transparent_index) col++;
+                    uint16_t start = col;
+                    while (col < chunk && *(first + col * win.step_x) != transparent_index) col++;
+                    if (col == start) continue;
+
+                    target().writeBegin(win.x + done + start, win.y + row, col - start, 1);
+                    target().writePush(line + start, col - start);
+                    target().writeEnd();
+                }
+            }
+            done += chunk;
+        }
+    }
+    if (opaque_image) {
+        target().writeEnd();
+    }
+}
+
+template <typename Target>
+void Canvas<Target>::blitScaled(int16_t x, int16_t y, uint16_t w, uint16_t h, const uint16_t* pixels, uint16_t src_w, uint16_t src_h,
+                                ScaleMode mode, uint16_t stride) {
+    CanvasDetail::BlitWindow win;
+    if (pixels == nullptr || src_w == 0 || src_h == 0 || !blitWindow(x, y, w, h, BLIT_NONE, win)) return;
+    if (stride == 0) stride = src_w;
+
+    using CanvasDetail::SCALE_HALF;
+    uint32_t step_x = (static_cast<uint32_t>(src_w) << 16) / w;
+    uint32_t step_y = (static_cast<uint32_t>(src_h) << 16) / h;
+    bool bilinear = (mode == ScaleMode::BILINEAR);
+
+    // Строка источника и вес нижней соседней строки для строки результата r
+    auto sample = [&](uint16_t r, int32_t& sy, uint8_t& weight) {
+        uint32_t pos_y = static_cast<uint32_t>(win.src_y + r) * step_y + step_y / 2;
+        if (!bilinear) {
+            sy = static_cast<int32_t>(pos_y >> 16);
+            weight = 0;
+            return;
+        }
+        uint32_t p = (pos_y > SCALE_HALF) ? pos_y - SCALE_HALF : 0;
+        sy = static_cast<int32_t>(p >> 16);
+        weight = (sy + 1 >= src_h) ? 0 : Blend565_Alpha5(static_cast<uint8_t>(p >> 8));
+    };
+
+    // Строчный буфер: кусок результата, для билинейного режима еще две масштабированные
+    // строки источника (кэш). Видимая часть делится по ширине на куски, каждый - своим окном
+    uint16_t line[CANVAS_LINE_PIXELS];
+    uint16_t max_chunk = bilinear ? CANVAS_LINE_PIXELS / 3 : CANVAS_LINE_PIXELS;
+
+    for (uint16_t done = 0; done < win.w; ) {
+        uint16_t chunk = std::min<uint16_t>(win.w - done, max_chunk);
+        uint32_t pos_x = static_cast<uint32_t>(win.src_x + done) * step_x + step_x / 2;
+
+        uint16_t* cache[2] = {line + chunk, line + 2 * chunk};
+        int32_t cached[2] = {-1, -1};
+
+        target().writeBegin(static_cast<uint16_t>(win.x + done), win.y, chunk, win.h);
+        for (uint16_t row = 0; row < win.h; ) {
+            int32_t sy;
+            uint8_t weight;
+            sample(row, sy, weight);
+            // Строки с тем же результатом (при увеличении) передаются одной группой
+            uint16_t rows = 1;
+            while (row + rows < win.h) {
+                int32_t next_sy;
+                uint8_t next_weight;
+                sample(row + rows, next_sy, next_weight);
+                if (next_sy != sy || next_weight != weight) break;
+                rows++;
+            }
+
+            if (!bilinear) {
+                CanvasDetail::scaleRow(line, pixels + sy * stride, src_w, pos_x, step_x, chunk, mode);
+            } else {
+                // Нужные строки ищутся в кэше (при движении вниз верхняя - бывшая нижняя)
+                int32_t need[2] = {sy, sy + 1};
+                uint8_t need_count = (weight == 0) ? 1 : 2;
+                if (cached[1] == sy) {
+                    std::swap(cache[0], cache[1]);
+                    std::swap(cached[0], cached[1]);
+                }
+                for (uint8_t k = 0; k < need_count; k++) {
+                    if (cached[k] == need[k]) continue;
+                    CanvasDetail::scaleRow(cache[k], pixels + need[k] * stride, src_w, pos_x, step_x, chunk, mode);
+                    cached[k] = need[k];
+                }
+
+                memcpy(line, cache[0], chunk * sizeof(uint16_t));
+                if (weight > 0) {
+                    // Blend565_Alpha5 обратим для кратных 8 значений: вес 0..32 -> 0..255
+                    Blend565_Span(line, cache[1], chunk, static_cast<uint8_t>(std::min(weight * 8, 255)));
+                }
+            }
+
+            target().writeRows(line, chunk, rows, 1);
+            row += rows;
+        }
+        target().writeEnd();
+        done += chunk;
+    }
+}
+
+template <typename Target>
+void Canvas<Target>::blitConverted(int16_t x, int16_t y, uint16_t w, uint16_t h, const uint8_t* pixels, PixelFormat format,
+                                   uint8_t flags, uint16_t stride) {
+    CanvasDetail::BlitWindow win;
+    if (pixels == nullptr || !blitWindow(x, y, w, h, BLIT_NONE, win)) return;
+    if (stride == 0) stride = w;
+
+    uint16_t line[CANVAS_LINE_PIXELS];
+    uint8_t bpp = Convert565_BytesPerPixel(format);
+    flags &= CONVERT565_DITHER;
+
+    // Одно окно на все изображение; строка уходит целью через writeRows (дисплей - без перестановки байтов)
+    target().writeBegin(win.x, win.y, win.w, win.h);
+    for (uint16_t row = 0; row < win.h; row++) {
+        const uint8_t* src = pixels + (static_cast<uint32_t>(win.src_y + row) * stride + win.src_x) * bpp;
+        for (uint16_t done = 0; done < win.w; ) {
+            uint16_t chunk = std::min<uint16_t>(win.w - done, CANVAS_LINE_PIXELS);
+            Convert565_Span(line, src + done * bpp, format, chunk, flags, win.x + done, win.y + row);
+            target().writeRows(line, chunk, 1, 1);
+            done += chunk;
+        }
+    }
+    target().writeEnd();
+}
+
+// ===================== ТЕКСТ 8x16 =====================
+
+template <typename Target>
+void Canvas<Target>::drawGlyph(int32_t x, int32_t y, const uint8_t* glyph, uint16_t color, uint8_t scale, uint16_t bg_color) {
+    // С фоном символ передается целиком одним окном
+    if (bg_color != 0x0000) {
+        drawGlyphRun(x, y, &glyph, 1, color, scale, bg_color);
+        return;
+    }
+
+    CanvasClip clip = getClipRect();
+    if (x >= clip.x1 || y >= clip.y1 || x + FONT8X16_WIDTH * scale <= clip.x0 ||
+        y + FONT8X16_HEIGHT * scale <= clip.y0) return;
+
+    // Прозрачный фон: непрерывные отрезки чернил в строке глифа
+    for (uint8_t row = 0; row < FONT8X16_HEIGHT; row++) {
+        uint8_t line = glyph[row];
+        uint8_t col = 0;
+
+        while (col < FONT8X16_WIDTH) {
+            if (!(line & (0x80 >> col))) {
+                col++;
+                continue;
+            }
+            uint8_t start = col;
+            while (col < FONT8X16_WIDTH && (line & (0x80 >> col))) {
+                col++;
+            }
+            fillClipped(x + start * scale, y + row * scale, (col - start) * scale, scale, color);
+        }
+    }
+}
+
+template <typename Target>
+void Canvas<Target>::drawGlyphRun(int32_t x, int32_t y, const uint8_t* const* glyphs, uint8_t count, uint16_t color, uint8_t scale, uint16_t bg_color) {
+    // Отрезок подряд идущих ячеек передается одним окном (только видимая часть):
+    // каждая строка пикселей собирается один раз и повторяется до scale раз
+    int32_t run_width = static_cast<int32_t>(count) * FONT8X16_WIDTH * scale;
+    CanvasClip clip = getClipRect();
+    int32_t x0 = std::max<int32_t>(x, clip.x0);
+    int32_t y0 = std::max<int32_t>(y, clip.y0);
+    int32_t x1 = std::min<int32_t>(x + run_width, clip.x1);
+    int32_t y1 = std::min<int32_t>(y + FONT8X16_HEIGHT * scale, clip.y1);
+    if (x0 >= x1 || y0 >= y1) return;
+
+    uint16_t line[CANVAS_LINE_PIXELS];
+    int32_t built_row = -1;
+
+    target().writeBegin(static_cast<uint16_t>(x0), static_cast<uint16_t>(y0),
+                        static_cast<uint16_t>(x1 - x0), static_cast<uint16_t>(y1 - y0));
+
+    for (int32_t py = y0; py < y1; py++) {
+        int32_t row = (py - y) / scale;
+        if (row != built_row) {
+            uint16_t* dst = line;
+            for (uint8_t i = 0; i < count; i++) {
+                uint8_t bits = glyphs[i][row];
+                for (uint8_t col = 0; col < FONT8X16_WIDTH; col++) {
+                    uint16_t pixel = (bits & (0x80 >> col)) ? color : bg_color;
+                    for (uint8_t sx = 0; sx < scale; sx++) {
+                        *dst++ = pixel;
+                    }
+                }
+            }
+            built_row = row;
+        }
+        target().writePush(line + (x0 - x), static_cast<uint32_t>(x1 - x0));
+    }
+
+    target().writeEnd();
+}
+
+template <typename Target>
+void Canvas<Target>::drawText(int16_t x, int16_t y, const char* utf8_str, uint16_t color, uint8_t scale, uint16_t bg_color) {
+    scale = CanvasDetail::clampScale(scale);
+    int32_t char_width = FONT8X16_WIDTH * scale;
+    CanvasClip clip = getClipRect();
+
+    if (utf8_str == nullptr || y >= clip.y1 || y + FONT8X16_HEIGHT * scale <= clip.y0) return;
+
+    // Строка декодируется пакетами до правого края области отсечения;
+    // пакеты левее области только декодируются
+    const uint8_t* glyphs[FONT8X16_GLYPH_BATCH];
+    int32_t batch = std::min<int32_t>(FONT8X16_GLYPH_BATCH, CANVAS_LINE_PIXELS / char_width);
+    int32_t cx = x;
+    const char* ptr = utf8_str;
+
+    while (*ptr && cx < clip.x1) {
+        int32_t cells = (clip.x1 - cx + char_width - 1) / char_width;
+        uint8_t count = Font8x16_GetGlyphs(&ptr, glyphs, static_cast<uint8_t>(std::min(cells, batch)));
+
+        if (cx + count * char_width > clip.x0) {
+            if (bg_color != 0x0000) {
+                drawGlyphRun(cx, y, glyphs, count, color, scale, bg_color);
+            } else {
+                for (uint8_t i = 0; i < count; i++) {
+                    drawGlyph(cx + i * char_width, y, glyphs[i], color, scale, bg_color);
+                }
+            }
+        }
+        cx += count * char_width;
+    }
+}
+
+template <typename Target>
+void Canvas<Target>::drawChar(int16_t x, int16_t y, char ch, uint16_t color, uint16_t bg_color) {
+    drawCharScaled(x, y, ch, color, 1, bg_color);
+}
+
+template <typename Target>
+void Canvas<Target>::drawString(int16_t x, int16_t y, const char* str, uint16_t color, uint16_t bg_color) {
+    drawText(x, y, str, color, 1, bg_color);
+}
+
+template <typename Target>
+void Canvas<Target>::drawStringUTF8(int16_t x, int16_t y, const char* utf8_str, uint16_t color, uint16_t bg_color) {
+    drawText(x, y, utf8_str, color, 1, bg_color);
+}
+
+template <typename Target>
+void Canvas<Target>::drawCharScaled(int16_t x, int16_t y, char ch, uint16_t color, uint8_t scale, uint16_t bg_color) {
+    scale = CanvasDetail::clampScale(scale);
+    drawGlyph(x, y, Font8x16_GetChar(static_cast<uint8_t>(ch)), color, scale, bg_color);
+}
+
+template <typename Target>
+void Canvas<Target>::drawStringScaled(int16_t x, int16_t y, const char* str, uint16_t color, uint8_t scale, uint16_t bg_color) {
+    drawText(x, y, str, color, scale, bg_color);
+}
+
+template <typename Target>
+void Canvas<Target>::drawStringUTF8Scaled(int16_t x, int16_t y, const char* utf8_str, uint16_t color, uint8_t scale, uint16_t bg_color) {
+    drawText(x, y, utf8_str, color, scale, bg_color);
+}
+
+template <typename Target>
+void Canvas<Target>::drawCharCell(int16_t x, int16_t y, uint32_t unicode_char, uint16_t color, uint8_t scale, uint16_t bg_color) {
+    drawTextCells(x, y, &unicode_char, 1, color, scale, bg_color);
+}
+
+template <typename Target>
+void Canvas<Target>::drawTextCells(int16_t x, int16_t y, const uint32_t* codepoints, uint8_t count, uint16_t color, uint8_t scale, uint16_t bg_color) {
+    if (codepoints == nullptr || count == 0) return;
+    scale = CanvasDetail::clampScale(scale);
+
+    int32_t cell_width = FONT8X16_WIDTH * scale;
+    CanvasClip clip = getClipRect();
+    if (y >= clip.y1 || y + FONT8X16_HEIGHT * scale <= clip.y0) return;
+
+    // Ячейки левее области отсечения пропускаются, правее - отбрасываются
+    int32_t cx = x;
+    if (cx < clip.x0) {
+        int32_t skip = (clip.x0 - cx) / cell_width;
+        if (skip >= count) return;
+        cx += skip * cell_width;
+        codepoints += skip;
+        count = static_cast<uint8_t>(count - skip);
+    }
+    int32_t visible = (clip.x1 - cx + cell_width - 1) / cell_width;
+    if (visible <= 0) return;
+    if (count > visible) count = static_cast<uint8_t>(visible);
+
+    // Ячейки передаются отрезками, помещающимися в строчный буфер
+    uint8_t batch = static_cast<uint8_t>(std::min<int32_t>(FONT8X16_GLYPH_BATCH, CANVAS_LINE_PIXELS / cell_width));
+    const uint8_t* glyphs[FONT8X16_GLYPH_BATCH];
+
+    while (count > 0) {
+        uint8_t n = std::min(count, batch);
+        for (uint8_t i = 0; i < n; i++) {
+            glyphs[i] = Font8x16_GetChar(codepoints[i]);
+        }
+        drawGlyphRun(cx, y, glyphs, n, color, scale, bg_color);
+
+        cx += n * cell_width;
+        codepoints += n;
+        count -= n;
+    }
+}
+
+// ===================== ПРОПОРЦИОНАЛЬНЫЙ ТЕКСТ =====================
+
+template <typename Target>
+void Canvas<Target>::drawStringProp(int16_t x, int16_t y, const char* utf8_str, const PropFont* font, uint16_t color, uint16_t bg_color) {
+    if (font == nullptr || utf8_str == nullptr || !PropFont_IsValidBpp(font->bpp)) return;
+    CanvasClip clip = getClipRect();
+    if (y >= clip.y1 || y + font->line_height <= clip.y0) return;
+
+    uint32_t codepoints[FONT8X16_GLYPH_BATCH];
+
+    // Фон заливается одним прямоугольником по ширине строки до края области отсечения
+    if (bg_color != 0x0000) {
+        int32_t text_width = 0;
+        const char* ptr = utf8_str;
+        while (*ptr && x + text_width < clip.x1) {
+            uint8_t count = UTF8_DecodeBatch(&ptr, codepoints, FONT8X16_GLYPH_BATCH);
+            for (uint8_t i = 0; i < count; i++) {
+                text_width += PropFont_GetGlyph(font, codepoints[i])->advance;
+            }
+        }
+        fillClipped(x, y, text_width, font->line_height, bg_color);
+    }
+
+    // Таблица уровней покрытия для непрозрачного фона: для 1 бита на пиксель это просто {фон, цвет}.
+    // С прозрачным фоном промежуточные уровни смешиваются с тем, что уже нарисовано
+    const uint16_t* ramp = (bg_color != 0x0000) ? ColorRamp_Get(color, bg_color, font->bpp) : nullptr;
+    uint8_t max_level = static_cast<uint8_t>((1 << font->bpp) - 1);
+    uint16_t line[CANVAS_LINE_PIXELS];
+    int32_t current_x = x;
+    const char* ptr = utf8_str;
+
+    while (*ptr && current_x < clip.x1) {
+        uint8_t count = UTF8_DecodeBatch(&ptr, codepoints, FONT8X16_GLYPH_BATCH);
+
+        for (uint8_t i = 0; i < count; i++) {
+            const PropGlyph* glyph = PropFont_GetGlyph(font, codepoints[i]);
+
+            // Обходим только видимую часть ink box глифа, пустые строки не обрабатываются
+            int32_t ink_x = current_x + glyph->x_offset;
+            int32_t ink_y = y + glyph->y_offset;
+            int32_t col_start = std::max<int32_t>(0, clip.x0 - ink_x);
+            int32_t col_end = std::min<int32_t>(glyph->width, clip.x1 - ink_x);
+            int32_t row_start = std::max<int32_t>(0, clip.y0 - ink_y);
+            int32_t row_end = std::min<int32_t>(glyph->height, clip.y1 - ink_y);
+            current_x += glyph->advance;
+            if (col_start >= col_end || row_start >= row_end) continue;
+
+            uint8_t row_bytes = PropFont_RowBytes(font, glyph);
+            const uint8_t* bitmap = PropFont_GetBitmap(font, glyph) + row_start * row_bytes;
+
+            if (bg_color != 0x0000) {
+                // Фон уже залит: одно окно на видимую часть ink box
+                target().writeBegin(static_cast<uint16_t>(ink_x + col_start), static_cast<uint16_t>(ink_y + row_start),
+                                    static_cast<uint16_t>(col_end - col_start), static_cast<uint16_t>(row_end - row_start));
+                for (int32_t row = row_start; row < row_end; row++) {
+                    for (int32_t col = col_start; col < col_end; col++) {
+                        line[col - col_start] = ramp[PropFont_GetLevel(bitmap, static_cast<uint8_t>(col), font->bpp)];
+                    }
+                    target().writePush(line, static_cast<uint32_t>(col_end - col_start));
+                    bitmap += row_bytes;
+                }
+                target().writeEnd();
+            } else {
+                // Прозрачный фон: отрезки полного покрытия заливаются цветом,
+                // края глифа (частичное покрытие) смешиваются с пикселями под ними
+                for (int32_t row = row_start; row < row_end; row++) {
+                    int32_t col = col_start;
+                    while (col < col_end) {
+                        uint8_t level = PropFont_GetLevel(bitmap, static_cast<uint8_t>(col), font->bpp);
+                        if (level == 0) {
+                            col++;
+                            continue;
+                        }
+                        if (level < max_level) {
+                            target().writeBlendPixel(static_cast<uint16_t>(ink_x + col), static_cast<uint16_t>(ink_y + row), color,
+                                                     static_cast<uint8_t>(level * 255 / max_level));
+                            col++;
+                            continue;
+                        }
+
+                        int32_t run_start = col;
+                        while (col < col_end && PropFont_GetLevel(bitmap, static_cast<uint8_t>(col), font->bpp) == max_level) {
+                            col++;
+                        }
+                        target().writeFillRect(static_cast<uint16_t>(ink_x + run_start), static_cast<uint16_t>(ink_y + row),
+                                               static_cast<uint16_t>(col - run_start), 1, color);
+                    }
+                    bitmap += row_bytes;
+                }
+            }
+        }
+    }
+}
+
+// ===================== ВЫВОД ЧИСЕЛ =====================
+
+template <typename Target>
+void Canvas<Target>::drawNumberCells(int16_t x, int16_t y, const char* chars, uint8_t count, uint16_t color, uint8_t scale, uint16_t bg_color) {
+    // Символы сразу переводятся в ячейки шрифта, без printf и без разбора UTF-8
+    uint32_t codepoints[NUMBER_FORMAT_MAX_CHARS];
+    for (uint8_t i = 0; i < count; i++) {
+        codepoints[i] = static_cast<uint8_t>(chars[i]);
+    }
+    drawTextCells(x, y, codepoints, count, color, scale, bg_color);
+}
+
+template <typename Target>
+void Canvas<Target>::drawInt(int16_t x, int16_t y, int32_t value, uint16_t color, uint16_t bg_color,
+                             uint8_t width, NumberAlign align, uint8_t scale) {
+    char chars[NUMBER_FORMAT_MAX_CHARS];
+    uint8_t count = NumberFormat_Int(chars, value, width, align);
+    drawNumberCells(x, y, chars, count, color, scale, bg_color);
+}
+
+template <typename Target>
+void Canvas<Target>::drawFixed(int16_t x, int16_t y, int32_t value, uint8_t decimals, uint16_t color, uint16_t bg_color,
+                               uint8_t width, NumberAlign align, uint8_t scale) {
+    char chars[NUMBER_FORMAT_MAX_CHARS];
+    uint8_t count = NumberFormat_Fixed(chars, value, decimals, width, align);
+    drawNumberCells(x, y, chars, count, color, scale, bg_color);
+}
+
+template <typename Target>
+void Canvas<Target>::drawFloat(int16_t x, int16_t y, float value, uint8_t decimals, uint16_t color, uint16_t bg_color,
+                               uint8_t width, NumberAlign align, uint8_t scale) {
+    char chars[NUMBER_FORMAT_MAX_CHARS];
+    uint8_t count = NumberFormat_Float(chars, value, decimals, width, align);
+    drawNumberCells(x, y, chars, count, color, scale, bg_color);
+}
+
+#endif
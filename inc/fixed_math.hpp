@@ -0,0 +1,50 @@
+#ifndef FIXED_MATH_HPP
+#define FIXED_MATH_HPP
+
+#include <algorithm>
+#include <cstdint>
+
+// Целочисленная математика для примитивов рисования (без плавающей точки во внутренних циклах)
+
+// Единица в формате Q14 (результат FixedMath_Sin / FixedMath_Cos)
+constexpr int32_t FIXED_MATH_ONE = 16384;
+
+// Целая часть квадратного корня
+uint32_t FixedMath_Sqrt(uint32_t value);
+
+// Квадратный корень с округлением вверх (0 для value <= 0)
+inline uint32_t FixedMath_CeilSqrt(int32_t value) {
+    if (value <= 0) return 0;
+    uint32_t root = FixedMath_Sqrt(static_cast<uint32_t>(value));
+    return (root * root < static_cast<uint32_t>(value)) ? root + 1 : root;
+}
+
+// Синус и косинус угла в градусах (любого знака) в формате Q14, по таблице на четверть периода
+int32_t FixedMath_Sin(int32_t degrees);
+int32_t FixedMath_Cos(int32_t degrees);
+
+// Длина вектора в 1/16 пикселя
+uint32_t FixedMath_Length16(int32_t dx, int32_t dy);
+
+// Деление с округлением вниз и вверх для любых знаков
+inline int32_t FixedMath_FloorDiv(int32_t a, int32_t b) {
+    int32_t q = a / b;
+    return (q * b != a && ((a < 0) != (b < 0))) ? q - 1 : q;
+}
+
+inline int32_t FixedMath_CeilDiv(int32_t a, int32_t b) {
+    return -FixedMath_FloorDiv(-a, b);
+}
+
+// Сужение [lo, hi] до x, где a * x + b >= threshold: часть строки внутри полуплоскости
+inline void FixedMath_LimitRange(int32_t a, int32_t b, int32_t threshold, int32_t& lo, int32_t& hi) {
+    if (a > 0) {
+        lo = std::max(lo, FixedMath_CeilDiv(threshold - b, a));
+    } else if (a < 0) {
+        hi = std::min(hi, FixedMath_FloorDiv(b - threshold, -a));
+    } else if (b < threshold) {
+        hi = lo - 1;
+    }
+}
+
+#endif
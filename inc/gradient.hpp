@@ -0,0 +1,65 @@
+#ifndef GRADIENT_HPP
+#define GRADIENT_HPP
+
+#include <cstdint>
+
+// Градиенты RGB565: каналы интерполируются с 16 дробными битами и квантуются
+// округлением или упорядоченным сглаживанием (матрица 4x4) между соседними уровнями
+
+// Максимальное количество опорных точек многоцветного градиента
+constexpr uint8_t GRADIENT_MAX_STOPS = 8;
+
+// Опорная точка градиента. Позиции не убывают: 0 - первый пиксель, 255 - последний
+struct GradientStop {
+    uint8_t position;
+    uint16_t color;
+};
+
+// Позиция на градиенте длиной length пикселей. Внутри отрезка между опорными точками
+// каналы меняются на постоянное приращение, деление - только при переходе на новый отрезок
+struct GradientCursor {
+    const GradientStop* stops;
+    uint8_t stop_count;
+    int32_t scale;          // length - 1 (не меньше 1)
+    int32_t position;
+    int32_t next_seek;      // Первая позиция следующего отрезка
+    int32_t value[3];       // R (0..31), G (0..63), B (0..31) с 16 дробными битами
+    int32_t step[3];
+};
+
+// Порог квантования без сглаживания (1/2 уровня - округление)
+constexpr int32_t GRADIENT_ROUND_BIAS = 0x8000;
+
+// Порог сглаживания для пикселя (x, y) в 1/65536 уровня
+int32_t Gradient_DitherBias(int32_t x, int32_t y);
+
+// Установка курсора на позицию (0..length-1; за пределами - цвет крайней точки)
+void Gradient_Seek(GradientCursor& cursor, const GradientStop* stops, uint8_t stop_count,
+                   int32_t length, int32_t position);
+
+// Переход на следующую позицию
+inline void Gradient_Next(GradientCursor& cursor) {
+    cursor.position++;
+    if (cursor.position >= cursor.next_seek) {
+        Gradient_Seek(cursor, cursor.stops, cursor.stop_count, cursor.scale + 1, cursor.position);
+        return;
+    }
+    cursor.value[0] += cursor.step[0];
+    cursor.value[1] += cursor.step[1];
+    cursor.value[2] += cursor.step[2];
+}
+
+// Цвет в текущей позиции с порогом bias (см. Gradient_DitherBias)
+inline uint16_t Gradient_Color(const GradientCursor& cursor, int32_t bias) {
+    uint32_t r = static_cast<uint32_t>(cursor.value[0] + bias) >> 16;
+    uint32_t g = static_cast<uint32_t>(cursor.value[1] + bias) >> 16;
+    uint32_t b = static_cast<uint32_t>(cursor.value[2] + bias) >> 16;
+    return static_cast<uint16_t>((r << 11) | (g << 5) | b);
+}
+
+// Строка цветов для позиций first..first+count-1 (горизонтальный градиент).
+// dither_y < 0 - без сглаживания; иначе пороги строки dither_y и столбцов dither_x, dither_x + 1, ...
+void Gradient_Line(uint16_t* out, uint16_t count, const GradientStop* stops, uint8_t stop_count,
+                   int32_t length, int32_t first, int32_t dither_x, int32_t dither_y);
+
+#endif
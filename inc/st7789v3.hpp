@@ -3,10 +3,19 @@
 
 #include "stm32f4xx_hal.h"
 #include "st7789v3_config.hpp"
+#include "canvas.hpp"
 #include <cstdint>
 
+// Передавать повторяющиеся строки заливок (градиенты) в прямом режиме через DMA.
+// Требует, чтобы HAL_SPI_TxCpltCallback вызывал ST7789V3_OnDMAComplete
+#ifndef ST7789V3_FILL_DMA
+#define ST7789V3_FILL_DMA 0
+#endif
+
 // Предварительное объявление класса Framebuffer
 class Framebuffer;
+class TiledFramebuffer;
+struct PropFont;
 
 // Размеры дисплея
 constexpr uint16_t ST7789_WIDTH = 240;
@@ -33,11 +42,29 @@ namespace ST7789_Commands {
     constexpr uint8_t CASET   = 0x2A;
     constexpr uint8_t RASET   = 0x2B;
     constexpr uint8_t RAMWR   = 0x2C;
+    constexpr uint8_t RAMWRC  = 0x3C;  // Продолжение записи с текущего адреса
     constexpr uint8_t DISPON  = 0x29;
     constexpr uint8_t INVOFF  = 0x20;  // Отключить инверсию цветов
     constexpr uint8_t INVON   = 0x21;  // Включить инверсию цветов
 }
 
+// Прямоугольная область экрана
+struct ST7789_Rect {
+    uint16_t x;
+    uint16_t y;
+    uint16_t w;
+    uint16_t h;
+};
+
+// Максимальное количество регионов в одном вызове flushRegions (лишние объединяются)
+constexpr uint8_t ST7789_MAX_FLUSH_REGIONS = 16;
+
+// Порядок байтов пикселей, передаваемых в pushPixels
+enum class ST7789_PixelOrder : uint8_t {
+    NATIVE,     // uint16_t в порядке процессора
+    SWAPPED     // Байты уже переставлены (старший первым в памяти)
+};
+
 // Структура конфигурации GPIO
 struct ST7789_GPIO {
     GPIO_TypeDef* port;
@@ -46,8 +73,11 @@ struct ST7789_GPIO {
     ST7789_GPIO(GPIO_TypeDef* p, uint16_t pin_num) : port(p), pin(pin_num) {}
 };
 
-// Класс дисплея ST7789V3
-class ST7789V3 {
+// Класс дисплея ST7789V3. Все примитивы рисования наследуются от Canvas:
+// при подключенном буфере кадра они рисуют в него, иначе - напрямую в дисплей
+class ST7789V3 : public Canvas<ST7789V3> {
+    friend class Canvas<ST7789V3>;
+    
 private:
     SPI_HandleTypeDef* hspi_;
     ST7789_GPIO cs_pin_;
@@ -55,11 +85,55 @@ private:
     ST7789_GPIO rst_pin_;
     Framebuffer* framebuffer_;  // Указатель на буфер кадра
     
+    // Хэши строк буфера кадра с предыдущей передачи (flushFramebufferChanged)
+    uint32_t* row_hashes_;
+    uint8_t hash_segments_;
+    bool row_hashes_valid_;
+    
+    // Текущая DMA передача кадра (оставшиеся пиксели)
+    const uint16_t* dma_pixels_;
+    uint32_t dma_remaining_;
+    bool dma_last_chunk_;       // Последняя часть окна: после нее CS поднимается
+    
+    // Потоковая запись (beginWrite/pushPixels/endWrite)
+    uint32_t stream_remaining_; // Пикселей до конца окна; 0 - продолжать нечего
+    uint16_t stream_x_;         // Окно потоковой записи (фаза сглаживания при преобразовании)
+    uint16_t stream_y_;
+    uint16_t stream_w_;
+    uint16_t stream_h_;
+    bool stream_open_;          // Окно открыто (CS = 0)
+    
     void writeCommand(uint8_t cmd);
     void writeData8(uint8_t data);
     void writeData16(uint16_t data);
     void setWindow(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1);
     
+    // Прямая запись в дисплей, минуя подключенный буфер кадра
+    void panelFillRect(uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint16_t color);
+    void panelWritePixels(uint16_t x, uint16_t y, uint16_t w, uint16_t h, const uint16_t* pixels, uint16_t stride);
+    
+    // DMA передача кадра в 16-битном режиме SPI частями до DMA_MAX_TRANSFER слов
+    void setSPIDataSize16(bool enable);
+    void startDMATransfer(const uint16_t* pixels, uint32_t count);
+    void beginDMAWindow();
+    void sendDMAChunk(const uint16_t* pixels, uint32_t count, bool last);
+    void continueDMATransfer();
+    void finishDMATransfer();
+    
+    // Преобразование очередного куска потоковой записи (до конца строки окна) в line
+    uint16_t convertStreamChunk(uint16_t* line, const uint8_t* pixels, uint32_t count, PixelFormat format, uint8_t flags);
+    
+    // Методы цели холста (координаты уже отсечены)
+    uint16_t canvasWidth() const { return ST7789_WIDTH; }
+    uint16_t canvasHeight() const { return ST7789_HEIGHT; }
+    void writePixel(uint16_t x, uint16_t y, uint16_t color);
+    void writeFillRect(uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint16_t color);
+    void writeBegin(uint16_t x, uint16_t y, uint16_t w, uint16_t h);
+    void writePush(const uint16_t* pixels, uint32_t count);
+    void writeRows(const uint16_t* lines, uint16_t count, uint16_t rows, uint8_t period);
+    void writeBlendPixel(uint16_t x, uint16_t y, uint16_t color, uint8_t alpha);
+    void writeEnd();
+    
 public:
     // Конструктор
     ST7789V3(SPI_HandleTypeDef* spi_handle,
@@ -74,38 +148,73 @@ public:
     void invertOn();                        // Включить инверсию
     void invertOff();                       // Отключить инверсию
     
-    // Функции рисования
-    void fillScreen(uint16_t color);
-    void drawPixel(uint16_t x, uint16_t y, uint16_t color);
-    void drawLine(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, uint16_t color);
-    void drawRect(uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint16_t color);
-    void fillRect(uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint16_t color);
-    void drawCircle(uint16_t x0, uint16_t y0, uint16_t r, uint16_t color);
-    void fillCircle(uint16_t x0, uint16_t y0, uint16_t r, uint16_t color);
-      // Функции текста
-    void drawChar(uint16_t x, uint16_t y, char ch, uint16_t color, uint16_t bg_color = ST7789_Colors::BLACK);
-    void drawString(uint16_t x, uint16_t y, const char* str, uint16_t color, uint16_t bg_color = ST7789_Colors::BLACK);
-    void drawStringUTF8(uint16_t x, uint16_t y, const char* utf8_str, uint16_t color, uint16_t bg_color = ST7789_Colors::BLACK);
-    
-    // Функции масштабированного текста
-    void drawCharScaled(uint16_t x, uint16_t y, char ch, uint16_t color, uint8_t scale, uint16_t bg_color = ST7789_Colors::BLACK);
-    void drawStringScaled(uint16_t x, uint16_t y, const char* str, uint16_t color, uint8_t scale, uint16_t bg_color = ST7789_Colors::BLACK);
-    void drawStringUTF8Scaled(uint16_t x, uint16_t y, const char* utf8_str, uint16_t color, uint8_t scale, uint16_t bg_color = ST7789_Colors::BLACK);      // Функции работы с буфером кадра
+    // Непрозрачная отрисовка подряд идущих ячеек 8x16 (с масштабом) по кодам Unicode.
+    // С буфером кадра ячейки рисуются в буфер и сразу передаются через flushFramebufferRegion,
+    // без буфера - одним окном на отрезок
+    void drawTextCells(int16_t x, int16_t y, const uint32_t* codepoints, uint8_t count, uint16_t color, uint8_t scale, uint16_t bg_color);
+    
+    // Функции работы с буфером кадра
     bool setFramebuffer(Framebuffer* fb);   // Установить буфер кадра
     void clearFramebuffer();                // Очистить буфер кадра
     Framebuffer* getFramebuffer() const;    // Получить указатель на буфер кадра
     void flushFramebuffer();                // Передать буфер кадра на дисплей
-    void flushFramebufferDMA();             // Передать буфер кадра на дисплей через DMA
+    void flushFramebufferDMA();             // Передать буфер кадра на дисплей через DMA (без копирования)
     void flushFramebufferRegion(uint16_t x, uint16_t y, uint16_t w, uint16_t h); // Передать регион буфера
     bool isFramebufferEnabled() const;      // Проверить, включен ли буфер кадра
     
+    // Пакетная передача нескольких регионов буфера через DMA. Регионы упорядочиваются
+    // так, чтобы сократить команды окна, строки собираются в два буфера по очереди
+    // (регион во всю ширину - одной передачей без копирования). Функция возвращается,
+    // не дожидаясь окончания последней передачи
+    void flushRegions(const ST7789_Rect* rects, uint8_t count);
+    void flushTiledFramebuffer(const TiledFramebuffer& tiles); // Передать плиточный буфер
+    
+    // Передача только изменившихся строк. Для каждой строки (или ее части при segments > 1)
+    // хранится хэш с предыдущей передачи; подряд идущие измененные строки передаются
+    // одним окном. Массив hashes - ST7789_HEIGHT * segments элементов, ширина экрана
+    // должна делиться на segments. Первая передача после установки - полная
+    bool setRowHashBuffer(uint32_t* hashes, uint8_t segments = 1);
+    void invalidateRowHashes() { row_hashes_valid_ = false; }
+    void flushFramebufferChanged();
+    
     // Функции для работы со статическим буфером
     void flushStaticBuffer(uint16_t* buffer, uint16_t width, uint16_t height);
     void flushStaticBufferDMA(uint16_t* buffer, uint16_t width, uint16_t height);
     
+    // Потоковая запись в дисплей (минуя буфер кадра). beginWrite открывает окно,
+    // pushPixels передает очередные пиксели без копирования: NATIVE - в 16-битном
+    // режиме SPI, SWAPPED - в 8-битном. pushPixelsDMA возвращается сразу после запуска
+    // передачи; буфер нельзя менять до следующего push*/endWrite (удобно чередовать два буфера).
+    // Пиксели сверх размера окна отбрасываются. Между beginWrite и endWrite нельзя
+    // рисовать на дисплей другими функциями
+    bool beginWrite(uint16_t x, uint16_t y, uint16_t w, uint16_t h);
+    void pushPixels(const uint16_t* pixels, uint32_t count, ST7789_PixelOrder order = ST7789_PixelOrder::NATIVE);
+    void pushPixelsDMA(const uint16_t* pixels, uint32_t count, ST7789_PixelOrder order = ST7789_PixelOrder::NATIVE);
+    // Пиксели другого формата (кадры камеры): преобразуются в RGB565 кусками строчного буфера
+    // (Convert565_Span; flags - CONVERT565_DITHER, узор привязан к координатам экрана).
+    // DMA вариант преобразует следующий кусок, пока передается предыдущий, и возвращается
+    // после окончания передачи (буфер pixels после возврата свободен)
+    void pushPixels(const uint8_t* pixels, uint32_t count, PixelFormat format, uint8_t flags = CONVERT565_NONE);
+    void pushPixelsDMA(const uint8_t* pixels, uint32_t count, PixelFormat format, uint8_t flags = CONVERT565_NONE);
+    void endWrite();
+    // Возобновление окна после endWrite командой RAMWRC (без повторной установки окна),
+    // например после обмена с другим устройством на той же шине SPI. Возвращает false,
+    // если окно уже заполнено или с тех пор на дисплей рисовали
+    bool continueWrite();
+    uint32_t getWriteRemaining() const { return stream_remaining_; }
+    
+    // Продолжение DMA передачи после завершения части (см. ST7789V3_OnDMAComplete)
+    void onDMATransferComplete();
+    SPI_HandleTypeDef* getSPIHandle() const { return hspi_; }
+    
     // Utility функции
     static uint16_t rgb565(uint8_t r, uint8_t g, uint8_t b);
     void setRotation(uint8_t rotation);
 };
 
+// Обработчик завершения DMA. Вызывается из HAL_SPI_TxCpltCallback пользователя:
+// запускает следующую часть кадра, а после последней поднимает CS,
+// возвращает 8-битный режим SPI и выставляет dma_transfer_complete
+void ST7789V3_OnDMAComplete(SPI_HandleTypeDef* hspi);
+
 #endif
\ No newline at end of file
@@ -8,6 +8,8 @@ namespace ST7789_Config {
     constexpr uint32_t SPI_TIMEOUT = 5000;  // Увеличен таймаут для передачи фреймбуфера
     constexpr uint32_t RESET_DELAY = 100;
     constexpr uint32_t INIT_DELAY = 120;
+    constexpr uint16_t DMA_MAX_TRANSFER = 0xFFFF;  // Максимум элементов за один вызов HAL_SPI_Transmit_DMA
+    constexpr uint16_t FLUSH_GATHER_PIXELS = 1024; // Размер каждого из двух буферов сбора строк flushRegions
 }
 
 // Настройки шрифта
@@ -0,0 +1,9 @@
+#include "canvas_impl.hpp"
+#include "st7789v3.hpp"
+#include "../framebuffer/framebuffer.hpp"
+#include "../framebuffer/tiled_framebuffer.hpp"
+
+// Инстанцирование холста для целей библиотеки
+template class Canvas<ST7789V3>;
+template class Canvas<Framebuffer>;
+template class Canvas<TiledFramebuffer>;
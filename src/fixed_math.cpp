@@ -0,0 +1,60 @@
+#include "fixed_math.hpp"
+
+namespace {
+
+// sin(0..90 градусов) * 16384
+const int16_t SIN_TABLE[91] = {
+    0, 286, 572, 857, 1143, 1428, 1713, 1997, 2280, 2563,
+    2845, 3126, 3406, 3686, 3964, 4240, 4516, 4790, 5063, 5334,
+    5604, 5872, 6138, 6402, 6664, 6924, 7182, 7438, 7692, 7943,
+    8192, 8438, 8682, 8923, 9162, 9397, 9630, 9860, 10087, 10311,
+    10531, 10749, 10963, 11174, 11381, 11585, 11786, 11982, 12176, 12365,
+    12551, 12733, 12911, 13085, 13255, 13421, 13583, 13741, 13894, 14044,
+    14189, 14330, 14466, 14598, 14726, 14849, 14968, 15082, 15191, 15296,
+    15396, 15491, 15582, 15668, 15749, 15826, 15897, 15964, 16026, 16083,
+    16135, 16182, 16225, 16262, 16294, 16322, 16344, 16362, 16374, 16382,
+    16384
+};
+
+} // namespace
+
+uint32_t FixedMath_Sqrt(uint32_t value) {
+    // Побитовое вычисление: только сдвиги и сложения
+    uint32_t result = 0;
+    uint32_t bit = 1u << 30;
+    while (bit > value) {
+        bit >>= 2;
+    }
+    while (bit != 0) {
+        if (value >= result + bit) {
+            value -= result + bit;
+            result = (result >> 1) + bit;
+        } else {
+            result >>= 1;
+        }
+        bit >>= 2;
+    }
+    return result;
+}
+
+int32_t FixedMath_Sin(int32_t degrees) {
+    degrees %= 360;
+    if (degrees < 0) degrees += 360;
+
+    if (degrees <= 90) return SIN_TABLE[degrees];
+    if (degrees <= 180) return SIN_TABLE[180 - degrees];
+    if (degrees <= 270) return -SIN_TABLE[degrees - 180];
+    return -SIN_TABLE[360 - degrees];
+}
+
+int32_t FixedMath_Cos(int32_t degrees) {
+    return FixedMath_Sin(degrees + 90);
+}
+
+uint32_t FixedMath_Length16(int32_t dx, int32_t dy) {
+    uint64_t len2 = static_cast<uint64_t>(static_cast<int64_t>(dx) * dx + static_cast<int64_t>(dy) * dy);
+    if (len2 < (1u << 24)) {
+        return FixedMath_Sqrt(static_cast<uint32_t>(len2 << 8));
+    }
+    return FixedMath_Sqrt(static_cast<uint32_t>(len2 >> 8)) << 8;
+}
@@ -0,0 +1,92 @@
+#include "gradient.hpp"
+#include <algorithm>
+
+namespace {
+
+// Матрица упорядоченного сглаживания (Байер 4x4)
+const uint8_t BAYER4[4][4] = {
+    { 0,  8,  2, 10},
+    {12,  4, 14,  6},
+    { 3, 11,  1,  9},
+    {15,  7, 13,  5}
+};
+
+inline int32_t channel(uint16_t color, uint8_t index) {
+    switch (index) {
+        case 0:  return (color >> 11) & 0x1F;
+        case 1:  return (color >> 5) & 0x3F;
+        default: return color & 0x1F;
+    }
+}
+
+} // namespace
+
+int32_t Gradient_DitherBias(int32_t x, int32_t y) {
+    // Порог (2 * b + 1) / 32 уровня: среднее по матрице - ровно 1/2
+    return (2 * BAYER4[y & 3][x & 3] + 1) << 11;
+}
+
+void Gradient_Seek(GradientCursor& cursor, const GradientStop* stops, uint8_t stop_count,
+                   int32_t length, int32_t position) {
+    cursor.stops = stops;
+    cursor.stop_count = stop_count;
+    cursor.scale = std::max<int32_t>(length - 1, 1);
+    cursor.position = position;
+
+    // Позиция в шкале опорных точек: position * 255 / scale.
+    // Отрезок k: stops[k] <= позиция < stops[k + 1]
+    int32_t t = position * 255;
+    uint8_t k = 0;
+    while (k + 1 < stop_count && static_cast<int32_t>(stops[k + 1].position) * cursor.scale <= t) {
+        k++;
+    }
+
+    const GradientStop& from = stops[k];
+    bool before = (t < static_cast<int32_t>(from.position) * cursor.scale);
+    if (before || k + 1 == stop_count) {
+        // До первой и после последней точки - постоянный цвет
+        for (uint8_t c = 0; c < 3; c++) {
+            cursor.value[c] = channel(from.color, c) << 16;
+            cursor.step[c] = 0;
+        }
+        cursor.next_seek = before ? (from.position * cursor.scale + 254) / 255 : INT32_MAX;
+        return;
+    }
+
+    // Значение в начале и приращение на пиксель; деление 64-битное только здесь
+    const GradientStop& to = stops[k + 1];
+    int64_t span = static_cast<int64_t>(to.position - from.position) * cursor.scale;
+    int64_t offset = t - static_cast<int64_t>(from.position) * cursor.scale;
+    for (uint8_t c = 0; c < 3; c++) {
+        int64_t delta = static_cast<int64_t>(channel(to.color, c) - channel(from.color, c)) * 65536;
+        cursor.value[c] = (channel(from.color, c) << 16) + static_cast<int32_t>(delta * offset / span);
+        cursor.step[c] = static_cast<int32_t>(delta * 255 / span);
+    }
+    cursor.next_seek = (to.position * cursor.scale + 254) / 255;
+}
+
+void Gradient_Line(uint16_t* out, uint16_t count, const GradientStop* stops, uint8_t stop_count,
+                   int32_t length, int32_t first, int32_t dither_x, int32_t dither_y) {
+    if (count == 0 || stops == nullptr || stop_count == 0) return;
+
+    GradientCursor cursor;
+    Gradient_Seek(cursor, stops, stop_count, length, first);
+
+    if (dither_y < 0) {
+        for (uint16_t i = 0; i < count; i++) {
+            out[i] = Gradient_Color(cursor, GRADIENT_ROUND_BIAS);
+            Gradient_Next(cursor);
+        }
+        return;
+    }
+
+    // Пороги строки матрицы повторяются с периодом 4
+    int32_t bias[4];
+    for (uint8_t i = 0; i < 4; i++) {
+        bias[i] = Gradient_DitherBias(dither_x + i, dither_y);
+    }
+    for (uint16_t i = 0; i < count; i++) {
+        out[i] = Gradient_Color(cursor, bias[i & 3]);
+        Gradient_Next(cursor);
+    }
+}
@@ -1,8 +1,11 @@
 #include "st7789v3.hpp"
 #include "font8x16.hpp"
 #include "../framebuffer/framebuffer.hpp"
+#include "../framebuffer/tiled_framebuffer.hpp"
+#include "../framebuffer/row_hash.hpp"
 #include "main.h"
 #include <algorithm>
+#include <cstring>
 #include <cmath>
 
 // Внешняя переменная для отслеживания состояния DMA
@@ -12,7 +15,10 @@ ST7789V3::ST7789V3(SPI_HandleTypeDef* spi_handle,
                    const ST7789_GPIO& cs,
                    const ST7789_GPIO& dc,
                    const ST7789_GPIO& rst)
-    : hspi_(spi_handle), cs_pin_(cs), dc_pin_(dc), rst_pin_(rst), framebuffer_(nullptr) {
+    : hspi_(spi_handle), cs_pin_(cs), dc_pin_(dc), rst_pin_(rst), framebuffer_(nullptr),
+      row_hashes_(nullptr), hash_segments_(1), row_hashes_valid_(false),
+      dma_pixels_(nullptr), dma_remaining_(0), dma_last_chunk_(true),
+      stream_remaining_(0), stream_x_(0), stream_y_(0), stream_w_(0), stream_h_(0), stream_open_(false) {
 }
 
 void ST7789V3::init() {
@@ -50,6 +56,11 @@ void ST7789V3::reset() {
 }
 
 void ST7789V3::writeCommand(uint8_t cmd) {
+    // Команда не должна прервать передачу кадра через DMA
+    if (!dma_transfer_complete) {
+        waitForDMAComplete();
+    }
+    
     HAL_GPIO_WritePin(dc_pin_.port, dc_pin_.pin, GPIO_PIN_RESET); // DC = 0 для команды
     HAL_GPIO_WritePin(cs_pin_.port, cs_pin_.pin, GPIO_PIN_RESET); // CS = 0
     HAL_SPI_Transmit(hspi_, &cmd, 1, ST7789_Config::SPI_TIMEOUT);
@@ -85,110 +96,111 @@ void ST7789V3::setWindow(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1) {
     
     // Начало записи в память
     writeCommand(ST7789_Commands::RAMWR);
+    
+    // Новое окно: продолжать прерванную потоковую запись уже нельзя
+    stream_remaining_ = 0;
 }
 
-void ST7789V3::fillScreen(uint16_t color) {
-    fillRect(0, 0, ST7789_WIDTH, ST7789_HEIGHT, color);
-}
+// ===================== ЦЕЛЬ ХОЛСТА =====================
 
-void ST7789V3::fillRect(uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint16_t color) {
-    if (x + w > ST7789_WIDTH || y + h > ST7789_HEIGHT) return;
-    
-    setWindow(x, y, x + w - 1, y + h - 1);
-    
-    uint32_t pixel_count = static_cast<uint32_t>(w) * h;
-    uint8_t color_buffer[2] = {static_cast<uint8_t>((color >> 8) & 0xFF), 
-                               static_cast<uint8_t>(color & 0xFF)};
-    
-    HAL_GPIO_WritePin(dc_pin_.port, dc_pin_.pin, GPIO_PIN_SET);   // DC = 1
-    HAL_GPIO_WritePin(cs_pin_.port, cs_pin_.pin, GPIO_PIN_RESET); // CS = 0
+void ST7789V3::writePixel(uint16_t x, uint16_t y, uint16_t color) {
+    if (isFramebufferEnabled()) {
+        framebuffer_->writePixel(x, y, color);
+        return;
+    }
     
-    for (uint32_t i = 0; i < pixel_count; i++) {
-        HAL_SPI_Transmit(hspi_, color_buffer, 2, ST7789_Config::SPI_TIMEOUT);
+    setWindow(x, y, x, y);
+    writeData16(color);
+}
+
+void ST7789V3::writeFillRect(uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint16_t color) {
+    if (isFramebufferEnabled()) {
+        framebuffer_->writeFillRect(x, y, w, h, color);
+        return;
     }
     
-    HAL_GPIO_WritePin(cs_pin_.port, cs_pin_.pin, GPIO_PIN_SET);   // CS = 1
+    panelFillRect(x, y, w, h, color);
 }
 
-void ST7789V3::drawPixel(uint16_t x, uint16_t y, uint16_t color) {
-    if (x >= ST7789_WIDTH || y >= ST7789_HEIGHT) return;
+void ST7789V3::writeBegin(uint16_t x, uint16_t y, uint16_t w, uint16_t h) {
+    if (isFramebufferEnabled()) {
+        framebuffer_->writeBegin(x, y, w, h);
+        return;
+    }
     
-    setWindow(x, y, x, y);
-    writeData16(color);
+    setWindow(x, y, x + w - 1, y + h - 1);
+    
+    HAL_GPIO_WritePin(dc_pin_.port, dc_pin_.pin, GPIO_PIN_SET);   // DC = 1
+    HAL_GPIO_WritePin(cs_pin_.port, cs_pin_.pin, GPIO_PIN_RESET); // CS = 0
 }
 
-void ST7789V3::drawLine(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, uint16_t color) {
-    int16_t dx = abs(static_cast<int16_t>(x1) - static_cast<int16_t>(x0));
-    int16_t dy = abs(static_cast<int16_t>(y1) - static_cast<int16_t>(y0));
-    int16_t sx = (x0 < x1) ? 1 : -1;
-    int16_t sy = (y0 < y1) ? 1 : -1;
-    int16_t err = dx - dy;
+void ST7789V3::writePush(const uint16_t* pixels, uint32_t count) {
+    if (isFramebufferEnabled()) {
+        framebuffer_->writePush(pixels, count);
+        return;
+    }
     
-    while (true) {
-        drawPixel(x0, y0, color);
-        
-        if (x0 == x1 && y0 == y1) break;
-        
-        int16_t e2 = 2 * err;
-        if (e2 > -dy) {
-            err -= dy;
-            x0 += sx;
-        }
-        if (e2 < dx) {
-            err += dx;
-            y0 += sy;
+    // Пиксели передаются старшим байтом вперед, кусками строчного буфера
+    uint8_t byte_buffer[CANVAS_LINE_PIXELS * 2];
+    while (count > 0) {
+        uint32_t current_chunk = std::min<uint32_t>(count, CANVAS_LINE_PIXELS);
+        for (uint32_t i = 0; i < current_chunk; i++) {
+            byte_buffer[i * 2] = (pixels[i] >> 8) & 0xFF;
+            byte_buffer[i * 2 + 1] = pixels[i] & 0xFF;
         }
+        HAL_SPI_Transmit(hspi_, byte_buffer, current_chunk * 2, ST7789_Config::SPI_TIMEOUT);
+        pixels += current_chunk;
+        count -= current_chunk;
     }
 }
 
-void ST7789V3::drawChar(uint16_t x, uint16_t y, char ch, uint16_t color, uint16_t bg_color) {
-    if (x + ST7789_Font::CHAR_WIDTH > ST7789_WIDTH || 
-        y + ST7789_Font::CHAR_HEIGHT > ST7789_HEIGHT) return;
-    
-    const uint8_t* font_data = Font8x16_GetChar(static_cast<uint8_t>(ch));
-    
-    for (uint8_t row = 0; row < ST7789_Font::CHAR_HEIGHT; row++) {
-        uint8_t line = font_data[row];
-        for (uint8_t col = 0; col < ST7789_Font::CHAR_WIDTH; col++) {
-            if (line & (0x80 >> col)) {
-                drawPixel(x + col, y + row, color);
-            } else if (bg_color != ST7789_Colors::BLACK) {
-                drawPixel(x + col, y + row, bg_color);
-            }
+void ST7789V3::writeRows(const uint16_t* lines, uint16_t count, uint16_t rows, uint8_t period) {
+    if (isFramebufferEnabled()) {
+        for (uint16_t row = 0; row < rows; row++) {
+            framebuffer_->writePush(lines + (row % period) * count, count);
         }
+        return;
     }
+    
+    // Строки уходят прямо из буфера в 16-битном режиме SPI, без перестановки байтов.
+    // Строки периода лежат в буфере подряд, поэтому одна передача отправляет до period
+    // строк. С ST7789V3_FILL_DMA передачи идут через DMA из того же буфера (окно остается
+    // открытым, следующая запускается по окончании предыдущей - ожидание опросом флага)
+    setSPIDataSize16(true);
+    for (uint16_t row = 0; row < rows; row += period) {
+        uint32_t pixels = static_cast<uint32_t>(std::min<uint16_t>(period, rows - row)) * count;
+#if ST7789V3_FILL_DMA
+        waitForDMAChunk();
+        sendDMAChunk(lines, pixels, false);
+#else
+        HAL_SPI_Transmit(hspi_, reinterpret_cast<uint8_t*>(const_cast<uint16_t*>(lines)), static_cast<uint16_t>(pixels),
+                         ST7789_Config::SPI_TIMEOUT);
+#endif
+    }
+#if ST7789V3_FILL_DMA
+    waitForDMAChunk();
+#endif
+    setSPIDataSize16(false);
 }
 
-void ST7789V3::drawString(uint16_t x, uint16_t y, const char* str, uint16_t color, uint16_t bg_color) {
-    uint16_t current_x = x;
-    const char* ptr = str;
+void ST7789V3::writeBlendPixel(uint16_t x, uint16_t y, uint16_t color, uint8_t alpha) {
+    if (isFramebufferEnabled()) {
+        framebuffer_->writeBlendPixel(x, y, color, alpha);
+        return;
+    }
     
-    while (*ptr) {
-        if (current_x + ST7789_Font::CHAR_WIDTH > ST7789_WIDTH) break;
-        
-        uint8_t bytes_consumed;
-        const uint8_t* font_data = Font8x16_GetCharUTF8(ptr, &bytes_consumed);
-        
-        // Рисуем символ
-        for (uint8_t row = 0; row < ST7789_Font::CHAR_HEIGHT; row++) {
-            uint8_t line = font_data[row];
-            for (uint8_t col = 0; col < ST7789_Font::CHAR_WIDTH; col++) {
-                if (line & (0x80 >> col)) {
-                    drawPixel(current_x + col, y + row, color);
-                } else if (bg_color != ST7789_Colors::BLACK) {
-                    drawPixel(current_x + col, y + row, bg_color);
-                }
-            }
-        }
-        
-        current_x += ST7789_Font::CHAR_WIDTH;
-        ptr += bytes_consumed;
+    // Пиксели дисплея не читаются: частичное покрытие рисуется по порогу
+    if (alpha >= 128) {
+        writePixel(x, y, color);
     }
 }
 
-// Дополнительная функция для рисования строк с кириллицей
-void ST7789V3::drawStringUTF8(uint16_t x, uint16_t y, const char* utf8_str, uint16_t color, uint16_t bg_color) {
-    drawString(x, y, utf8_str, color, bg_color);
+void ST7789V3::writeEnd() {
+    if (isFramebufferEnabled()) {
+        return;
+    }
+    
+    HAL_GPIO_WritePin(cs_pin_.port, cs_pin_.pin, GPIO_PIN_SET);   // CS = 1
 }
 
 uint16_t ST7789V3::rgb565(uint8_t r, uint8_t g, uint8_t b) {
@@ -313,124 +325,34 @@ void ST7789V3::flushFramebufferRegion(uint16_t x, uint16_t y, uint16_t w, uint16
         return; // Выход за границы экрана
     }
     
-    // Устанавливаем окно для региона
-    setWindow(x, y, x + w - 1, y + h - 1);
-    
-    // Начинаем запись в память дисплея
-    writeCommand(ST7789_Commands::RAMWR);
-    
-    HAL_GPIO_WritePin(dc_pin_.port, dc_pin_.pin, GPIO_PIN_SET); // DC = 1 для данных
-    HAL_GPIO_WritePin(cs_pin_.port, cs_pin_.pin, GPIO_PIN_RESET); // CS = 0
-    
-    // Передаем данные построчно из буфера
+    // Строки региона передаются прямо из буфера в 16-битном режиме SPI
+    // (регион во всю ширину экрана - одной непрерывной передачей)
     const uint16_t* buffer = framebuffer_->getBuffer();
-    for (uint16_t row = 0; row < h; row++) {
-        // Вычисляем позицию начала строки в буфере
-        uint32_t buffer_offset = (y + row) * ST7789_WIDTH + x;
-        
-        // Передаем строку
-        HAL_SPI_Transmit(hspi_, (uint8_t*)(buffer + buffer_offset), w * 2, ST7789_Config::SPI_TIMEOUT);
-    }
-    
-    HAL_GPIO_WritePin(cs_pin_.port, cs_pin_.pin, GPIO_PIN_SET); // CS = 1
+    panelWritePixels(x, y, w, h, buffer + static_cast<uint32_t>(y) * ST7789_WIDTH + x, ST7789_WIDTH);
 }
 
 bool ST7789V3::isFramebufferEnabled() const {
     return (framebuffer_ != nullptr && framebuffer_->isAllocated());
 }
 
-// Методы масштабированного текста
-void ST7789V3::drawCharScaled(uint16_t x, uint16_t y, char ch, uint16_t color, uint8_t scale, uint16_t bg_color) {
-    // Если буфер кадра доступен, используем его для лучшей производительности
-    if (framebuffer_ != nullptr && framebuffer_->isAllocated()) {
-        framebuffer_->drawCharScaled(x, y, ch, color, scale, bg_color);
-        return;
-    }
-    
-    // Fallback на прямое рисование
-    if (scale == 0) scale = 1; // Минимальный масштаб 1
-    if (scale > 8) scale = 8;  // Максимальный масштаб 8
-    
-    uint16_t char_width = ST7789_Font::CHAR_WIDTH * scale;
-    uint16_t char_height = ST7789_Font::CHAR_HEIGHT * scale;
-    
-    if (x + char_width > ST7789_WIDTH || y + char_height > ST7789_HEIGHT) return;
-    
-    const uint8_t* font_data = Font8x16_GetChar(static_cast<uint8_t>(ch));
-    
-    for (uint8_t row = 0; row < ST7789_Font::CHAR_HEIGHT; row++) {
-        uint8_t line = font_data[row];
-        for (uint8_t col = 0; col < ST7789_Font::CHAR_WIDTH; col++) {
-            uint16_t pixel_color = (line & (0x80 >> col)) ? color : bg_color;
-            
-            // Рисуем увеличенный пиксель только если нужно
-            if (pixel_color != ST7789_Colors::BLACK || bg_color != ST7789_Colors::BLACK) {
-                for (uint8_t sy = 0; sy < scale; sy++) {
-                    for (uint8_t sx = 0; sx < scale; sx++) {
-                        drawPixel(x + col * scale + sx, y + row * scale + sy, pixel_color);
-                    }
-                }
-            }
-        }
-    }
-}
-
-void ST7789V3::drawStringScaled(uint16_t x, uint16_t y, const char* str, uint16_t color, uint8_t scale, uint16_t bg_color) {
-    // Если буфер кадра доступен, используем его для лучшей производительности
-    if (framebuffer_ != nullptr && framebuffer_->isAllocated()) {
-        framebuffer_->drawStringScaled(x, y, str, color, scale, bg_color);
-        return;
-    }
+void ST7789V3::drawTextCells(int16_t x, int16_t y, const uint32_t* codepoints, uint8_t count, uint16_t color, uint8_t scale, uint16_t bg_color) {
+    Canvas<ST7789V3>::drawTextCells(x, y, codepoints, count, color, scale, bg_color);
     
-    // Fallback на прямое рисование
+    // В прямом режиме ячейки уже на экране; буфер кадра передается только по измененному отрезку
+    if (!isFramebufferEnabled() || codepoints == nullptr || count == 0) return;
     if (scale == 0) scale = 1;
     if (scale > 8) scale = 8;
     
-    uint16_t current_x = x;
-    uint16_t char_width = ST7789_Font::CHAR_WIDTH * scale;
-    
-    const char* ptr = str;
-    
-    while (*ptr) {
-        if (current_x + char_width > ST7789_WIDTH) break;
-        
-        uint8_t bytes_consumed;
-        const uint8_t* font_data = Font8x16_GetCharUTF8(ptr, &bytes_consumed);
-        
-        // Рисуем увеличенный символ
-        for (uint8_t row = 0; row < ST7789_Font::CHAR_HEIGHT; row++) {
-            uint8_t line = font_data[row];
-            for (uint8_t col = 0; col < ST7789_Font::CHAR_WIDTH; col++) {
-                uint16_t pixel_color = (line & (0x80 >> col)) ? color : bg_color;
-                
-                if (pixel_color != ST7789_Colors::BLACK || bg_color != ST7789_Colors::BLACK) {
-                    for (uint8_t sy = 0; sy < scale; sy++) {
-                        for (uint8_t sx = 0; sx < scale; sx++) {
-                            uint16_t px = current_x + col * scale + sx;
-                            uint16_t py = y + row * scale + sy;
-                            if (px < ST7789_WIDTH && py < ST7789_HEIGHT) {
-                                drawPixel(px, py, pixel_color);
-                            }
-                        }
-                    }
-                }
-            }
-        }
-        
-        current_x += char_width;
-        ptr += bytes_consumed;
-    }
-}
-
-void ST7789V3::drawStringUTF8Scaled(uint16_t x, uint16_t y, const char* utf8_str, uint16_t color, uint8_t scale, uint16_t bg_color) {
-    // Если буфер кадра доступен, используем его
-    if (framebuffer_ != nullptr && framebuffer_->isAllocated()) {
-        framebuffer_->drawStringUTF8Scaled(x, y, utf8_str, color, scale, bg_color);
-        return;
-    }
+    // Передается только видимая в области отсечения часть ячеек
+    CanvasClip clip = getClipRect();
+    int32_t x0 = std::max<int32_t>(x, clip.x0);
+    int32_t y0 = std::max<int32_t>(y, clip.y0);
+    int32_t x1 = std::min<int32_t>(x + static_cast<int32_t>(FONT8X16_WIDTH) * scale * count, clip.x1);
+    int32_t y1 = std::min<int32_t>(y + static_cast<int32_t>(FONT8X16_HEIGHT) * scale, clip.y1);
+    if (x0 >= x1 || y0 >= y1) return;
     
-    // Fallback на drawStringScaled
-    drawStringScaled(x, y, utf8_str, color, scale, bg_color);
+    flushFramebufferRegion(static_cast<uint16_t>(x0), static_cast<uint16_t>(y0),
+                           static_cast<uint16_t>(x1 - x0), static_cast<uint16_t>(y1 - y0));
 }
 
 // DMA версия flushFramebuffer
@@ -439,6 +361,12 @@ void ST7789V3::flushFramebufferDMA() {
         return; // Буфер не установлен или не инициализирован
     }
     
+    // Буфер в памяти, недоступной DMA (CCM, DTCM), передается обычным способом
+    if (!framebuffer_->isDMACapable()) {
+        flushFramebuffer();
+        return;
+    }
+    
     // Получаем указатель на буфер
     const uint16_t* buffer = framebuffer_->getBuffer();
     uint16_t width = framebuffer_->getWidth();
@@ -490,55 +418,548 @@ void ST7789V3::flushStaticBuffer(uint16_t* buffer, uint16_t width, uint16_t heig
     HAL_GPIO_WritePin(cs_pin_.port, cs_pin_.pin, GPIO_PIN_SET); // CS = 1
 }
 
-// Передача статического буфера на дисплей через DMA
+// Передача статического буфера на дисплей через DMA.
+// Пиксели передаются прямо из буфера без копирования: SPI переключается в 16-битный
+// режим (старший байт уходит первым), кадр отправляется частями до 65535 слов
 void ST7789V3::flushStaticBufferDMA(uint16_t* buffer, uint16_t width, uint16_t height) {
     if (buffer == nullptr) {
         return;
     }
     
     // Ждем завершения предыдущей DMA передачи
-    while (!dma_transfer_complete) {
-        HAL_Delay(1);
-    }
+    waitForDMAComplete();
     
-    // Устанавливаем окно на весь экран
+    // Устанавливаем окно (setWindow также начинает запись в память дисплея)
     setWindow(0, 0, width - 1, height - 1);
     
-    // Начинаем запись в память дисплея
-    writeCommand(ST7789_Commands::RAMWR);
+    startDMATransfer(buffer, static_cast<uint32_t>(width) * height);
+}
+
+// ===================== ПРЯМАЯ ЗАПИСЬ В ДИСПЛЕЙ =====================
+
+void ST7789V3::panelFillRect(uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint16_t color) {
+    // Буфер байтов заполняется цветом один раз и передается кусками
+    uint32_t pixel_count = static_cast<uint32_t>(w) * h;
+    uint32_t chunk = std::min<uint32_t>(pixel_count, CANVAS_LINE_PIXELS);
+    uint8_t color_buffer[CANVAS_LINE_PIXELS * 2];
+    for (uint32_t i = 0; i < chunk; i++) {
+        color_buffer[i * 2] = (color >> 8) & 0xFF;
+        color_buffer[i * 2 + 1] = color & 0xFF;
+    }
     
-    // Подготавливаем буфер для DMA передачи
-    // Нужно конвертировать из 16-битных данных в 8-битные с правильным порядком байтов
-    uint32_t total_pixels = static_cast<uint32_t>(width) * height;
-    static uint8_t* byte_buffer = nullptr;
+    setWindow(x, y, x + w - 1, y + h - 1);
     
-    // Выделяем буфер только один раз
-    if (byte_buffer == nullptr) {
-        byte_buffer = new uint8_t[total_pixels * 2];
+    HAL_GPIO_WritePin(dc_pin_.port, dc_pin_.pin, GPIO_PIN_SET);   // DC = 1
+    HAL_GPIO_WritePin(cs_pin_.port, cs_pin_.pin, GPIO_PIN_RESET); // CS = 0
+    
+    while (pixel_count > 0) {
+        uint32_t current_chunk = std::min(chunk, pixel_count);
+        HAL_SPI_Transmit(hspi_, color_buffer, current_chunk * 2, ST7789_Config::SPI_TIMEOUT);
+        pixel_count -= current_chunk;
     }
     
-    // Конвертируем данные
-    for (uint32_t i = 0; i < total_pixels; i++) {
-        uint16_t pixel = buffer[i];
-        byte_buffer[i * 2] = (pixel >> 8) & 0xFF;     // Старший байт
-        byte_buffer[i * 2 + 1] = pixel & 0xFF;        // Младший байт
+    HAL_GPIO_WritePin(cs_pin_.port, cs_pin_.pin, GPIO_PIN_SET);   // CS = 1
+}
+
+void ST7789V3::panelWritePixels(uint16_t x, uint16_t y, uint16_t w, uint16_t h, const uint16_t* pixels, uint16_t stride) {
+    setWindow(x, y, x + w - 1, y + h - 1);
+    
+    HAL_GPIO_WritePin(dc_pin_.port, dc_pin_.pin, GPIO_PIN_SET);   // DC = 1
+    HAL_GPIO_WritePin(cs_pin_.port, cs_pin_.pin, GPIO_PIN_RESET); // CS = 0
+    
+    // В 16-битном режиме SPI пиксели уходят прямо из памяти, старшим байтом вперед
+    setSPIDataSize16(true);
+    if (stride == w) {
+        uint32_t remaining = static_cast<uint32_t>(w) * h;
+        while (remaining > 0) {
+            uint16_t chunk = static_cast<uint16_t>(std::min<uint32_t>(remaining, ST7789_Config::DMA_MAX_TRANSFER));
+            HAL_SPI_Transmit(hspi_, reinterpret_cast<uint8_t*>(const_cast<uint16_t*>(pixels)), chunk, ST7789_Config::SPI_TIMEOUT);
+            pixels += chunk;
+            remaining -= chunk;
+        }
+    } else {
+        for (uint16_t row = 0; row < h; row++) {
+            HAL_SPI_Transmit(hspi_, reinterpret_cast<uint8_t*>(const_cast<uint16_t*>(pixels)), w, ST7789_Config::SPI_TIMEOUT);
+            pixels += stride;
+        }
     }
+    setSPIDataSize16(false);
     
-    // Устанавливаем пины для передачи данных
-    HAL_GPIO_WritePin(dc_pin_.port, dc_pin_.pin, GPIO_PIN_SET); // DC = 1 для данных
+    HAL_GPIO_WritePin(cs_pin_.port, cs_pin_.pin, GPIO_PIN_SET);   // CS = 1
+}
+
+// Передача плиточного буфера: подряд идущие однородные плитки одного цвета
+// в строке плиток заливаются одним окном, плитки из пула передаются без копирования
+void ST7789V3::flushTiledFramebuffer(const TiledFramebuffer& tiles) {
+    if (!tiles.isValid()) return;
+    
+    uint16_t width = std::min<uint16_t>(tiles.getWidth(), ST7789_WIDTH);
+    uint16_t height = std::min<uint16_t>(tiles.getHeight(), ST7789_HEIGHT);
+    uint8_t size = tiles.getTileSize();
+    
+    for (uint16_t row = 0; row < tiles.getRows(); row++) {
+        uint16_t tile_y = row * size;
+        if (tile_y >= height) break;
+        uint16_t th = std::min<uint16_t>(size, height - tile_y);
+        
+        uint16_t column = 0;
+        while (column < tiles.getColumns()) {
+            uint16_t tile_x = column * size;
+            if (tile_x >= width) break;
+            
+            if (tiles.isTileSolid(column, row)) {
+                uint16_t color = tiles.getTileColor(column, row);
+                uint16_t end = column + 1;
+                while (end < tiles.getColumns() && tiles.isTileSolid(end, row) && tiles.getTileColor(end, row) == color) {
+                    end++;
+                }
+                uint16_t run_end = std::min<uint16_t>(end * size, width);
+                panelFillRect(tile_x, tile_y, run_end - tile_x, th, color);
+                column = end;
+            } else {
+                uint16_t tw = std::min<uint16_t>(size, width - tile_x);
+                panelWritePixels(tile_x, tile_y, tw, th, tiles.getTilePixels(column, row), size);
+                column++;
+            }
+        }
+    }
+}
+
+// ===================== ПАКЕТНАЯ ПЕРЕДАЧА РЕГИОНОВ =====================
+
+// Буферы сбора строк для DMA: один заполняется, пока другой передается
+static uint16_t gather_buffers[2][ST7789_Config::FLUSH_GATHER_PIXELS];
+
+// Порядок передачи: регионы с одинаковыми колонками подряд (CASET не повторяется), затем по y
+static bool regionBefore(const ST7789_Rect& a, const ST7789_Rect& b) {
+    if (a.x != b.x) return a.x < b.x;
+    if (a.w != b.w) return a.w < b.w;
+    return a.y < b.y;
+}
+
+static uint8_t prepareRegions(const ST7789_Rect* rects, uint8_t count, ST7789_Rect* out) {
+    uint8_t n = 0;
+    
+    for (uint8_t i = 0; i < count; i++) {
+        ST7789_Rect r = rects[i];
+        if (r.x >= ST7789_WIDTH || r.y >= ST7789_HEIGHT || r.w == 0 || r.h == 0) continue;
+        if (r.w > ST7789_WIDTH - r.x) r.w = ST7789_WIDTH - r.x;
+        if (r.h > ST7789_HEIGHT - r.y) r.h = ST7789_HEIGHT - r.y;
+        
+        // Лишние регионы объединяются с последним в охватывающий прямоугольник
+        if (n == ST7789_MAX_FLUSH_REGIONS) {
+            ST7789_Rect& last = out[n - 1];
+            uint16_t x1 = std::max<uint16_t>(last.x + last.w, r.x + r.w);
+            uint16_t y1 = std::max<uint16_t>(last.y + last.h, r.y + r.h);
+            last.x = std::min(last.x, r.x);
+            last.y = std::min(last.y, r.y);
+            last.w = x1 - last.x;
+            last.h = y1 - last.y;
+            continue;
+        }
+        out[n++] = r;
+    }
+    
+    // Сортировка вставками (регионов немного)
+    for (uint8_t i = 1; i < n; i++) {
+        ST7789_Rect r = out[i];
+        uint8_t j = i;
+        while (j > 0 && regionBefore(r, out[j - 1])) {
+            out[j] = out[j - 1];
+            j--;
+        }
+        out[j] = r;
+    }
+    
+    // Регионы с теми же колонками, которые касаются или перекрываются по вертикали, - одно окно
+    uint8_t merged = 0;
+    for (uint8_t i = 0; i < n; i++) {
+        if (merged > 0) {
+            ST7789_Rect& prev = out[merged - 1];
+            if (prev.x == out[i].x && prev.w == out[i].w && out[i].y <= prev.y + prev.h) {
+                prev.h = std::max<uint16_t>(prev.y + prev.h, out[i].y + out[i].h) - prev.y;
+                continue;
+            }
+        }
+        out[merged++] = out[i];
+    }
+    return merged;
+}
+
+void ST7789V3::flushRegions(const ST7789_Rect* rects, uint8_t count) {
+    if (!isFramebufferEnabled() || rects == nullptr || count == 0) {
+        return;
+    }
+    
+    ST7789_Rect regions[ST7789_MAX_FLUSH_REGIONS];
+    uint8_t n = prepareRegions(rects, count, regions);
+    const uint16_t* buffer = framebuffer_->getBuffer();
+    
+    // Буфер в памяти без доступа DMA передается обычным способом
+    if (!framebuffer_->isDMACapable()) {
+        for (uint8_t i = 0; i < n; i++) {
+            const ST7789_Rect& r = regions[i];
+            panelWritePixels(r.x, r.y, r.w, r.h, buffer + static_cast<uint32_t>(r.y) * ST7789_WIDTH + r.x, ST7789_WIDTH);
+        }
+        return;
+    }
+    
+    uint16_t column_start = 0xFFFF, column_end = 0xFFFF;
+    
+    for (uint8_t i = 0; i < n; i++) {
+        const ST7789_Rect& r = regions[i];
+        const uint16_t* src = buffer + static_cast<uint32_t>(r.y) * ST7789_WIDTH + r.x;
+        
+        // Команды ждут окончания предыдущей передачи (часть сбора - коротким опросом);
+        // CASET - только при смене колонок
+        waitForDMAChunk();
+        if (r.x != column_start || r.x + r.w - 1 != column_end) {
+            column_start = r.x;
+            column_end = r.x + r.w - 1;
+            writeCommand(ST7789_Commands::CASET);
+            writeData16(column_start);
+            writeData16(column_end);
+        }
+        writeCommand(ST7789_Commands::RASET);
+        writeData16(r.y);
+        writeData16(r.y + r.h - 1);
+        writeCommand(ST7789_Commands::RAMWR);
+        
+        // Новое окно: продолжать прерванную потоковую запись уже нельзя
+        stream_remaining_ = 0;
+        
+        beginDMAWindow();
+        
+        // Регион во всю ширину непрерывен в памяти - одна передача без копирования
+        if (r.w == ST7789_WIDTH) {
+            sendDMAChunk(src, static_cast<uint32_t>(r.w) * r.h, true);
+            continue;
+        }
+        
+        // Иначе строки собираются в буферы по очереди: сбор следующей части
+        // идет параллельно с передачей предыдущей
+        uint16_t rows_per_chunk = std::max<uint16_t>(1, ST7789_Config::FLUSH_GATHER_PIXELS / r.w);
+        uint8_t current = 0;
+        
+        for (uint16_t row = 0; row < r.h; row += rows_per_chunk) {
+            uint16_t rows = std::min<uint16_t>(rows_per_chunk, r.h - row);
+            uint16_t* dst = gather_buffers[current];
+            for (uint16_t k = 0; k < rows; k++) {
+                memcpy(dst + k * r.w, src + static_cast<uint32_t>(row + k) * ST7789_WIDTH, r.w * sizeof(uint16_t));
+            }
+            
+            // Предыдущая часть (из другого буфера) должна завершиться
+            waitForDMAChunk();
+            sendDMAChunk(dst, static_cast<uint32_t>(rows) * r.w, row + rows >= r.h);
+            current ^= 1;
+        }
+    }
+    
+    // Последняя передача завершается в фоне (ST7789V3_OnDMAComplete)
+}
+
+// ===================== ПЕРЕДАЧА ИЗМЕНИВШИХСЯ СТРОК =====================
+
+bool ST7789V3::setRowHashBuffer(uint32_t* hashes, uint8_t segments) {
+    if (hashes != nullptr && (segments == 0 || ST7789_WIDTH % segments != 0)) {
+        return false;
+    }
+    
+    row_hashes_ = hashes;
+    hash_segments_ = (hashes != nullptr) ? segments : 1;
+    row_hashes_valid_ = false;
+    return true;
+}
+
+void ST7789V3::flushFramebufferChanged() {
+    if (!isFramebufferEnabled()) {
+        return; // Буфер не установлен или не инициализирован
+    }
+    if (row_hashes_ == nullptr) {
+        flushFramebuffer();
+        return;
+    }
+    
+    const uint16_t* buffer = framebuffer_->getBuffer();
+    uint16_t segment_width = ST7789_WIDTH / hash_segments_;
+    
+    for (uint8_t segment = 0; segment < hash_segments_; segment++) {
+        uint16_t x = segment * segment_width;
+        const uint16_t* column = buffer + x;
+        int32_t run_start = -1;
+        
+        for (uint16_t y = 0; y <= ST7789_HEIGHT; y++) {
+            bool changed = false;
+            if (y < ST7789_HEIGHT) {
+                uint32_t hash = RowHash_Compute(column + static_cast<uint32_t>(y) * ST7789_WIDTH, segment_width);
+                uint32_t& stored = row_hashes_[static_cast<uint32_t>(y) * hash_segments_ + segment];
+                changed = !row_hashes_valid_ || hash != stored;
+                stored = hash;
+            }
+            
+            // Подряд идущие измененные строки - одно окно
+            if (changed && run_start < 0) {
+                run_start = y;
+            } else if (!changed && run_start >= 0) {
+                panelWritePixels(x, run_start, segment_width, y - run_start,
+                                 column + static_cast<uint32_t>(run_start) * ST7789_WIDTH, ST7789_WIDTH);
+                run_start = -1;
+            }
+        }
+    }
+    
+    row_hashes_valid_ = true;
+}
+
+// ===================== ПОТОКОВАЯ ЗАПИСЬ =====================
+
+bool ST7789V3::beginWrite(uint16_t x, uint16_t y, uint16_t w, uint16_t h) {
+    endWrite();
+    
+    if (x >= ST7789_WIDTH || y >= ST7789_HEIGHT || w == 0 || h == 0) {
+        return false;
+    }
+    if (w > ST7789_WIDTH - x) w = ST7789_WIDTH - x;
+    if (h > ST7789_HEIGHT - y) h = ST7789_HEIGHT - y;
+    
+    setWindow(x, y, x + w - 1, y + h - 1);
+    stream_remaining_ = static_cast<uint32_t>(w) * h;
+    stream_x_ = x;
+    stream_y_ = y;
+    stream_w_ = w;
+    stream_h_ = h;
+    
+    HAL_GPIO_WritePin(dc_pin_.port, dc_pin_.pin, GPIO_PIN_SET);   // DC = 1
     HAL_GPIO_WritePin(cs_pin_.port, cs_pin_.pin, GPIO_PIN_RESET); // CS = 0
+    stream_open_ = true;
+    return true;
+}
+
+void ST7789V3::pushPixels(const uint16_t* pixels, uint32_t count, ST7789_PixelOrder order) {
+    if (!stream_open_ || pixels == nullptr) {
+        return;
+    }
+    count = std::min(count, stream_remaining_);
+    stream_remaining_ -= count;
+    
+    // Предыдущая DMA часть еще может передаваться
+    waitForDMAChunk();
+    
+    if (order == ST7789_PixelOrder::NATIVE) {
+        // 16-битный режим: слово уходит старшим байтом вперед
+        setSPIDataSize16(true);
+        while (count > 0) {
+            uint16_t chunk = static_cast<uint16_t>(std::min<uint32_t>(count, ST7789_Config::DMA_MAX_TRANSFER));
+            HAL_SPI_Transmit(hspi_, reinterpret_cast<uint8_t*>(const_cast<uint16_t*>(pixels)), chunk, ST7789_Config::SPI_TIMEOUT);
+            pixels += chunk;
+            count -= chunk;
+        }
+    } else {
+        // Байты уже в порядке дисплея: 8-битный режим, размер в байтах
+        setSPIDataSize16(false);
+        const uint8_t* bytes = reinterpret_cast<const uint8_t*>(pixels);
+        while (count > 0) {
+            uint16_t chunk = static_cast<uint16_t>(std::min<uint32_t>(count, ST7789_Config::DMA_MAX_TRANSFER / 2));
+            HAL_SPI_Transmit(hspi_, const_cast<uint8_t*>(bytes), chunk * 2, ST7789_Config::SPI_TIMEOUT);
+            bytes += chunk * 2;
+            count -= chunk;
+        }
+    }
+}
+
+void ST7789V3::pushPixelsDMA(const uint16_t* pixels, uint32_t count, ST7789_PixelOrder order) {
+    // DMA движок передает слова в 16-битном режиме; переставленные байты - обычным способом
+    if (order != ST7789_PixelOrder::NATIVE) {
+        pushPixels(pixels, count, order);
+        return;
+    }
+    if (!stream_open_ || pixels == nullptr) {
+        return;
+    }
+    count = std::min(count, stream_remaining_);
+    if (count == 0) {
+        return;
+    }
+    stream_remaining_ -= count;
+    
+    // Части потока короткие (обычно строка): ожидание опросом, без HAL_Delay
+    waitForDMAChunk();
+    setSPIDataSize16(true);
+    // Окно остается открытым после передачи (CS поднимает endWrite)
+    sendDMAChunk(pixels, count, false);
+}
+
+uint16_t ST7789V3::convertStreamChunk(uint16_t* line, const uint8_t* pixels, uint32_t count, PixelFormat format, uint8_t flags) {
+    // Кусок не переходит на следующую строку окна: фаза сглаживания считается от ее начала
+    uint32_t position = static_cast<uint32_t>(stream_w_) * stream_h_ - stream_remaining_;
+    uint16_t col = static_cast<uint16_t>(position % stream_w_);
+    uint16_t row = static_cast<uint16_t>(position / stream_w_);
+    uint16_t chunk = static_cast<uint16_t>(std::min<uint32_t>(std::min<uint32_t>(count, CANVAS_LINE_PIXELS), stream_w_ - col));
+    
+    Convert565_Span(line, pixels, format, chunk, flags & CONVERT565_DITHER, stream_x_ + col, stream_y_ + row);
+    stream_remaining_ -= chunk;
+    return chunk;
+}
+
+void ST7789V3::pushPixels(const uint8_t* pixels, uint32_t count, PixelFormat format, uint8_t flags) {
+    if (!stream_open_ || pixels == nullptr) {
+        return;
+    }
+    count = std::min(count, stream_remaining_);
+    
+    waitForDMAChunk();
+    setSPIDataSize16(true);
+    uint16_t line[CANVAS_LINE_PIXELS];
+    uint8_t bpp = Convert565_BytesPerPixel(format);
+    while (count > 0) {
+        uint16_t chunk = convertStreamChunk(line, pixels, count, format, flags);
+        HAL_SPI_Transmit(hspi_, reinterpret_cast<uint8_t*>(line), chunk, ST7789_Config::SPI_TIMEOUT);
+        pixels += chunk * bpp;
+        count -= chunk;
+    }
+}
+
+void ST7789V3::pushPixelsDMA(const uint8_t* pixels, uint32_t count, PixelFormat format, uint8_t flags) {
+    if (!stream_open_ || pixels == nullptr) {
+        return;
+    }
+    count = std::min(count, stream_remaining_);
+    
+    // Два строчных буфера по очереди: пока DMA передает один, в другой преобразуется следующий кусок.
+    // Кусок передается доли миллисекунды, поэтому смена буфера ждет опросом флага
+    uint16_t lines[2][CANVAS_LINE_PIXELS];
+    uint8_t current = 0;
+    uint8_t bpp = Convert565_BytesPerPixel(format);
+    waitForDMAChunk();
+    setSPIDataSize16(true);
+    while (count > 0) {
+        uint16_t chunk = convertStreamChunk(lines[current], pixels, count, format, flags);
+        waitForDMAChunk();
+        sendDMAChunk(lines[current], chunk, false);
+        current ^= 1;
+        pixels += chunk * bpp;
+        count -= chunk;
+    }
+    // Буферы на стеке: возврат только после окончания передачи
+    waitForDMAChunk();
+}
+
+void ST7789V3::endWrite() {
+    if (!stream_open_) {
+        return;
+    }
+    
+    waitForDMAChunk();
+    setSPIDataSize16(false);
+    HAL_GPIO_WritePin(cs_pin_.port, cs_pin_.pin, GPIO_PIN_SET);   // CS = 1
+    stream_open_ = false;
+}
+
+bool ST7789V3::continueWrite() {
+    if (stream_open_) {
+        return true;
+    }
+    if (stream_remaining_ == 0) {
+        return false;
+    }
+    
+    // Дисплей продолжает запись с адреса, на котором остановился
+    writeCommand(ST7789_Commands::RAMWRC);
     
-    // Устанавливаем флаг занятости DMA
+    HAL_GPIO_WritePin(dc_pin_.port, dc_pin_.pin, GPIO_PIN_SET);   // DC = 1
+    HAL_GPIO_WritePin(cs_pin_.port, cs_pin_.pin, GPIO_PIN_RESET); // CS = 0
+    stream_open_ = true;
+    return true;
+}
+
+// ===================== DMA ДВИЖОК =====================
+
+// Дисплей, чья DMA передача сейчас выполняется (одна передача на все экземпляры)
+static ST7789V3* active_dma_display = nullptr;
+
+void ST7789V3::setSPIDataSize16(bool enable) {
+    if ((hspi_->Init.DataSize == SPI_DATASIZE_16BIT) == enable) {
+        return;
+    }
+    
+    // Размер кадра SPI (бит DFF) можно менять только при выключенном SPI
+    __HAL_SPI_DISABLE(hspi_);
+    if (enable) {
+        hspi_->Instance->CR1 |= SPI_CR1_DFF;
+        hspi_->Init.DataSize = SPI_DATASIZE_16BIT;
+    } else {
+        hspi_->Instance->CR1 &= ~SPI_CR1_DFF;
+        hspi_->Init.DataSize = SPI_DATASIZE_8BIT;
+    }
+    __HAL_SPI_ENABLE(hspi_);
+}
+
+void ST7789V3::startDMATransfer(const uint16_t* pixels, uint32_t count) {
+    beginDMAWindow();
+    sendDMAChunk(pixels, count, true);
+}
+
+void ST7789V3::beginDMAWindow() {
+    HAL_GPIO_WritePin(dc_pin_.port, dc_pin_.pin, GPIO_PIN_SET);   // DC = 1 для данных
+    HAL_GPIO_WritePin(cs_pin_.port, cs_pin_.pin, GPIO_PIN_RESET); // CS = 0
+    
+    setSPIDataSize16(true);
+}
+
+void ST7789V3::sendDMAChunk(const uint16_t* pixels, uint32_t count, bool last) {
+    dma_pixels_ = pixels;
+    dma_remaining_ = count;
+    dma_last_chunk_ = last;
+    active_dma_display = this;
     dma_transfer_complete = false;
     
-    // Запускаем DMA передачу
-    HAL_StatusTypeDef result = HAL_SPI_Transmit_DMA(hspi_, byte_buffer, total_pixels * 2);
+    continueDMATransfer();
+}
+
+void ST7789V3::continueDMATransfer() {
+    // Указатель сдвигается до запуска: прерывание завершения может прийти сразу
+    uint16_t chunk = static_cast<uint16_t>(std::min<uint32_t>(dma_remaining_, ST7789_Config::DMA_MAX_TRANSFER));
+    const uint16_t* pixels = dma_pixels_;
+    dma_pixels_ += chunk;
+    dma_remaining_ -= chunk;
     
+    // В 16-битном режиме HAL считает размер в словах
+    HAL_StatusTypeDef result = HAL_SPI_Transmit_DMA(hspi_, reinterpret_cast<uint8_t*>(const_cast<uint16_t*>(pixels)), chunk);
     if (result != HAL_OK) {
-        // Если DMA не удалось запустить, сбрасываем флаг и завершаем CS
-        dma_transfer_complete = true;
-        HAL_GPIO_WritePin(cs_pin_.port, cs_pin_.pin, GPIO_PIN_SET); // CS = 1
+        // Если DMA не удалось запустить, завершаем передачу и закрываем окно
+        dma_remaining_ = 0;
+        dma_last_chunk_ = true;
+        finishDMATransfer();
     }
+}
+
+void ST7789V3::finishDMATransfer() {
+    active_dma_display = nullptr;
     
-    // Примечание: CS будет поднят в callback функции после завершения DMA
-}
\ No newline at end of file
+    // После промежуточной части окно остается открытым (CS = 0, 16-битный режим)
+    if (dma_last_chunk_) {
+        HAL_GPIO_WritePin(cs_pin_.port, cs_pin_.pin, GPIO_PIN_SET);   // CS = 1
+        setSPIDataSize16(false);
+    }
+    
+    dma_transfer_complete = true;
+}
+
+void ST7789V3::onDMATransferComplete() {
+    // Следующая часть кадра или завершение передачи
+    if (dma_remaining_ > 0) {
+        continueDMATransfer();
+        return;
+    }
+    finishDMATransfer();
+}
+
+void ST7789V3_OnDMAComplete(SPI_HandleTypeDef* hspi) {
+    if (active_dma_display != nullptr && active_dma_display->getSPIHandle() == hspi) {
+        active_dma_display->onDMATransferComplete();
+        return;
+    }
+    
+    // Передача запущена не библиотекой
+    dma_transfer_complete = true;
+}
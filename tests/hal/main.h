@@ -0,0 +1,9 @@
+#ifndef MAIN_H
+#define MAIN_H
+
+// Заглушка main.h проекта CubeMX: дескриптор SPI дисплея
+#include "stm32f4xx_hal.h"
+
+extern SPI_HandleTypeDef hspi1;
+
+#endif
@@ -0,0 +1,57 @@
+#ifndef STM32F4XX_HAL_H
+#define STM32F4XX_HAL_H
+
+// Заглушка STM32 HAL для тестов на хосте: только то, что использует библиотека.
+// Передачи SPI принимает эмулятор панели (test_panel.cpp)
+
+#include <cstdint>
+
+typedef struct {
+    volatile uint32_t CR1;
+} SPI_TypeDef;
+
+typedef struct {
+    uint32_t DataSize;
+} SPI_InitTypeDef;
+
+typedef struct {
+    SPI_TypeDef* Instance;
+    SPI_InitTypeDef Init;
+} SPI_HandleTypeDef;
+
+typedef struct {
+    uint32_t ODR;
+} GPIO_TypeDef;
+
+typedef enum {
+    GPIO_PIN_RESET = 0,
+    GPIO_PIN_SET
+} GPIO_PinState;
+
+typedef enum {
+    HAL_OK = 0,
+    HAL_ERROR,
+    HAL_BUSY,
+    HAL_TIMEOUT
+} HAL_StatusTypeDef;
+
+#define GPIO_PIN_2          0x0004u
+#define GPIO_PIN_3          0x0008u
+#define GPIO_PIN_4          0x0010u
+
+#define SPI_DATASIZE_8BIT   0x0000u
+#define SPI_DATASIZE_16BIT  0x0800u
+#define SPI_CR1_DFF         0x0800u
+#define SPI_CR1_SPE         0x0040u
+
+#define __HAL_SPI_ENABLE(h)  ((h)->Instance->CR1 |= SPI_CR1_SPE)
+#define __HAL_SPI_DISABLE(h) ((h)->Instance->CR1 &= ~SPI_CR1_SPE)
+
+extern GPIO_TypeDef* const GPIOA;
+
+void HAL_GPIO_WritePin(GPIO_TypeDef* port, uint16_t pin, GPIO_PinState state);
+HAL_StatusTypeDef HAL_SPI_Transmit(SPI_HandleTypeDef* hspi, uint8_t* data, uint16_t size, uint32_t timeout);
+HAL_StatusTypeDef HAL_SPI_Transmit_DMA(SPI_HandleTypeDef* hspi, uint8_t* data, uint16_t size);
+void HAL_Delay(uint32_t delay);
+
+#endif
@@ -0,0 +1,136 @@
+#include "blend565.hpp"
+#include "test_common.hpp"
+
+// Эталон: каждый канал отдельно, b + floor((f - b) * a / 32), a = Blend565_Alpha5(alpha)
+static int refChannel(int f, int b, int a) {
+    int d = (f - b) * a;
+    return b + (d >= 0 ? d / 32 : -((-d + 31) / 32));
+}
+
+static uint16_t refPixel(uint16_t fg, uint16_t bg, uint8_t alpha) {
+    int a = (alpha + 4) >> 3;
+    int r = refChannel(fg >> 11, bg >> 11, a);
+    int g = refChannel((fg >> 5) & 0x3F, (bg >> 5) & 0x3F, a);
+    int b = refChannel(fg & 0x1F, bg & 0x1F, a);
+    return static_cast<uint16_t>((r << 11) | (g << 5) | b);
+}
+
+static uint8_t randomAlpha() {
+    // Крайние значения чаще: на них переполняются упакованные пары
+    static const uint8_t edges[] = {0, 1, 3, 4, 127, 128, 251, 252, 254, 255};
+    uint32_t r = Test_Random();
+    return (r & 3) == 0 ? edges[(r >> 2) % sizeof(edges)] : static_cast<uint8_t>(r >> 8);
+}
+
+static uint16_t randomColor() {
+    // Черный и белый чаще: наибольшая разность каналов
+    uint32_t r = Test_Random();
+    switch (r & 7) {
+        case 0: return 0x0000;
+        case 1: return 0xFFFF;
+        default: return static_cast<uint16_t>(r >> 8);
+    }
+}
+
+static void testPixel() {
+    for (uint32_t i = 0; i < 200000; i++) {
+        uint16_t fg = randomColor();
+        uint16_t bg = randomColor();
+        uint8_t alpha = randomAlpha();
+        uint16_t got = Blend565_Pixel(fg, bg, alpha);
+        uint16_t expected = refPixel(fg, bg, alpha);
+        TEST_CHECK(got == expected, "fg=%04x bg=%04x a=%u got %04x expected %04x",
+                   fg, bg, alpha, got, expected);
+    }
+}
+
+// Отрезки всех длин до нескольких векторов со всеми смещениями: проверяются пары,
+// хвосты и то, что за границы отрезка ничего не пишется
+constexpr uint32_t MAX_COUNT = 70;
+constexpr uint32_t GUARD = 4;
+
+static void testSpans() {
+    uint16_t src[MAX_COUNT + 2 * GUARD];
+    uint16_t dst[MAX_COUNT + 2 * GUARD];
+    uint16_t expected[MAX_COUNT + 2 * GUARD];
+
+    for (uint32_t count = 0; count <= MAX_COUNT; count++) {
+        for (uint32_t offset = 0; offset < GUARD; offset++) {
+            for (uint32_t pass = 0; pass < 8; pass++) {
+                uint8_t alpha = randomAlpha();
+                uint16_t color = randomColor();
+                for (uint32_t i = 0; i < MAX_COUNT + 2 * GUARD; i++) {
+                    src[i] = randomColor();
+                    dst[i] = expected[i] = randomColor();
+                }
+
+                if (pass & 1) {
+                    Blend565_SpanColor(dst + offset, color, count, alpha);
+                    for (uint32_t i = 0; i < count; i++) {
+                        expected[offset + i] = refPixel(color, expected[offset + i], alpha);
+                    }
+                } else {
+                    Blend565_Span(dst + offset, src + offset, count, alpha);
+                    for (uint32_t i = 0; i < count; i++) {
+                        expected[offset + i] = refPixel(src[offset + i], expected[offset + i], alpha);
+                    }
+                }
+
+                for (uint32_t i = 0; i < MAX_COUNT + 2 * GUARD; i++) {
+                    TEST_CHECK(dst[i] == expected[i], "%s count=%u offset=%u a=%u [%u]: got %04x expected %04x",
+                               (pass & 1) ? "SpanColor" : "Span", count, offset, alpha, i, dst[i], expected[i]);
+                }
+            }
+        }
+    }
+}
+
+static void testMask() {
+    uint16_t src[MAX_COUNT];
+    uint16_t dst[MAX_COUNT];
+    uint16_t expected[MAX_COUNT];
+    uint8_t mask[MAX_COUNT + 1];
+
+    for (uint32_t count = 0; count <= MAX_COUNT - 2; count++) {
+        for (uint32_t pass = 0; pass < 8; pass++) {
+            AlphaFormat format = (pass & 1) ? AlphaFormat::A4 : AlphaFormat::A8;
+            bool use_src = (pass & 2) != 0;
+            uint16_t mask_x = static_cast<uint16_t>(Test_Random() % 3);
+            uint8_t alpha = (pass & 4) ? 255 : randomAlpha();
+            uint16_t color = randomColor();
+            for (uint32_t i = 0; i < sizeof(mask); i++) {
+                // Нули и полная непрозрачность маски - отдельные ветви ядра
+                uint32_t r = Test_Random();
+                mask[i] = (r & 3) == 0 ? 0x00 : (r & 3) == 1 ? 0xFF : static_cast<uint8_t>(r >> 8);
+            }
+            for (uint32_t i = 0; i < MAX_COUNT; i++) {
+                src[i] = randomColor();
+                dst[i] = expected[i] = randomColor();
+            }
+
+            Blend565_SpanMask(dst, use_src ? src : nullptr, color, mask, format, mask_x, count, alpha);
+            for (uint32_t i = 0; i < count; i++) {
+                uint32_t mx = mask_x + i;
+                uint8_t m = (format == AlphaFormat::A8)
+                    ? mask[mx]
+                    : static_cast<uint8_t>(((mx & 1) ? (mask[mx / 2] & 0x0F) : (mask[mx / 2] >> 4)) * 17);
+                if (m == 0) continue;
+                uint8_t a = static_cast<uint8_t>((m * alpha + 255) / 256);
+                uint16_t fg = use_src ? src[i] : color;
+                expected[i] = (a == 255) ? fg : refPixel(fg, expected[i], a);
+            }
+
+            for (uint32_t i = 0; i < MAX_COUNT; i++) {
+                TEST_CHECK(dst[i] == expected[i], "SpanMask %s count=%u mask_x=%u a=%u [%u]: got %04x expected %04x",
+                           format == AlphaFormat::A4 ? "A4" : "A8", count, mask_x, alpha, i, dst[i], expected[i]);
+            }
+        }
+    }
+}
+
+int main() {
+    testPixel();
+    testSpans();
+    testMask();
+    return Test_Result("test_blend565");
+}
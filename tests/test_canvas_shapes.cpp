@@ -0,0 +1,500 @@
+#include "st7789v3.hpp"
+#include "framebuffer.hpp"
+#include "font_prop8x16.hpp"
+#include "test_common.hpp"
+#include "test_panel.hpp"
+#include <algorithm>
+#include <cmath>
+
+// Фигуры рисуются на обеих целях холста: на дисплее без буфера кадра (эмулятор панели)
+// и в Framebuffer. Обе цели должны совпасть с эталоном по центрам пикселей, а на панели
+// каждый пиксель должен быть записан не больше одного раза
+
+constexpr uint16_t WIDTH = ST7789_WIDTH;
+constexpr uint16_t HEIGHT = ST7789_HEIGHT;
+constexpr uint16_t INK = 0xFFFF;
+
+// Центр пикселя дальше погрешности Q14 от границы фигуры - иначе пиксель не проверяется
+constexpr double EDGE_TOLERANCE = 0.05;
+
+enum class Sample : uint8_t {
+    OUT,
+    IN,
+    EDGE    // Центр на границе в пределах погрешности
+};
+
+static uint16_t fb_memory[WIDTH * HEIGHT];
+
+// Эталон без отсечения: холст с полями, фигура рисуется со сдвигом на поля
+constexpr int16_t REF_MARGIN_X = 120;
+constexpr int16_t REF_MARGIN_Y = 120;
+constexpr uint16_t REF_WIDTH = WIDTH + 2 * REF_MARGIN_X;
+constexpr uint16_t REF_HEIGHT = HEIGHT + 2 * REF_MARGIN_Y;
+static uint16_t ref_memory[REF_WIDTH * REF_HEIGHT];
+
+static Framebuffer& testFramebuffer() {
+    static Framebuffer framebuffer(fb_memory, WIDTH, HEIGHT);
+    return framebuffer;
+}
+
+static Framebuffer& referenceFramebuffer() {
+    static Framebuffer framebuffer(ref_memory, REF_WIDTH, REF_HEIGHT);
+    return framebuffer;
+}
+
+static void clearTargets() {
+    TestPanel_Reset(0x0000);
+    testFramebuffer().clear(0x0000);
+}
+
+// Одинаковое содержимое целей и (если single_write) не более одной записи на пиксель панели
+static void checkTargetsAgree(const char* name, bool single_write = true) {
+    TEST_CHECK(TestPanel_GetOverruns() == 0, "%s: %u pixels past the window", name, TestPanel_GetOverruns());
+    for (uint16_t y = 0; y < HEIGHT; y++) {
+        for (uint16_t x = 0; x < WIDTH; x++) {
+            uint16_t expected = fb_memory[y * WIDTH + x];
+            TEST_CHECK(TestPanel_GetPixel(x, y) == expected, "%s: display (%u, %u) = %04X, framebuffer %04X",
+                       name, x, y, TestPanel_GetPixel(x, y), expected);
+            TEST_CHECK(!single_write || TestPanel_GetWrites(x, y) <= 1, "%s: (%u, %u) written %u times",
+                       name, x, y, TestPanel_GetWrites(x, y));
+        }
+    }
+}
+
+// Фигура цветом INK на обеих целях против эталона reference(x, y)
+template <typename Draw, typename Reference>
+static void checkShape(const char* name, Draw draw, Reference reference) {
+    clearTargets();
+    draw(TestPanel_Display());
+    draw(testFramebuffer());
+    checkTargetsAgree(name);
+
+    for (uint16_t y = 0; y < HEIGHT; y++) {
+        for (uint16_t x = 0; x < WIDTH; x++) {
+            Sample sample = reference(x, y);
+            if (sample == Sample::EDGE) continue;
+            uint16_t expected = (sample == Sample::IN) ? INK : 0x0000;
+            TEST_CHECK(fb_memory[y * WIDTH + x] == expected, "%s: (%u, %u) = %04X, expected %04X",
+                       name, x, y, fb_memory[y * WIDTH + x], expected);
+        }
+    }
+}
+
+static Sample sampleIf(bool inside) {
+    return inside ? Sample::IN : Sample::OUT;
+}
+
+// ===================== СКРУГЛЕННЫЕ ПРЯМОУГОЛЬНИКИ =====================
+
+// Радиус ограничен половиной меньшей стороны; угол - круг радиуса r с центром
+// в крайнем пикселе прямой части (dx^2 + dy^2 <= r^2, как у fillCircle)
+static bool insideRoundRect(int x, int y, int rx, int ry, int w, int h, int r) {
+    if (x < rx || y < ry || x >= rx + w || y >= ry + h) return false;
+    r = std::min(r, std::min(w, h) / 2);
+    // При стороне 2r центры скруглений сходятся: половина ближе к краю берет свой центр
+    int cx = (x < rx + r) ? rx + r : (x > rx + w - 1 - r) ? rx + w - 1 - r : x;
+    int cy = (y < ry + r) ? ry + r : (y > ry + h - 1 - r) ? ry + h - 1 - r : y;
+    return (x - cx) * (x - cx) + (y - cy) * (y - cy) <= r * r;
+}
+
+static void testRoundRects() {
+    struct Case {
+        int16_t x, y;
+        uint16_t w, h, r;
+    };
+    static const Case cases[] = {
+        {10, 10, 100, 60, 12},
+        {-20, -10, 80, 50, 30},     // За левым и верхним краем
+        {200, 290, 100, 100, 20},   // За правым и нижним краем
+        {50, 50, 7, 40, 100},       // Радиус больше половины ширины
+        {5, 5, 1, 1, 3},
+        {30, 40, 60, 60, 0},
+        {100, 100, 41, 41, 20},     // Круг
+    };
+
+    for (const Case& c : cases) {
+        checkShape("fillRoundRect",
+                   [&](auto& canvas) { canvas.fillRoundRect(c.x, c.y, c.w, c.h, c.r, INK); },
+                   [&](int x, int y) { return sampleIf(insideRoundRect(x, y, c.x, c.y, c.w, c.h, c.r)); });
+
+        // Контур толщиной t - разность внешнего и внутреннего скругленных прямоугольников
+        for (uint8_t t : {1, 3}) {
+            if (2 * t >= c.w || 2 * t >= c.h) continue;
+            int r = std::min<int>(c.r, std::min(c.w, c.h) / 2);
+            int inner_w = c.w - 2 * t;
+            int inner_h = c.h - 2 * t;
+            int inner_r = std::max(r - t, 0);
+            checkShape("drawRoundRect",
+                       [&](auto& canvas) { canvas.drawRoundRect(c.x, c.y, c.w, c.h, c.r, INK, t); },
+                       [&](int x, int y) {
+                           return sampleIf(insideRoundRect(x, y, c.x, c.y, c.w, c.h, c.r) &&
+                                           !insideRoundRect(x, y, c.x + t, c.y + t, inner_w, inner_h, inner_r));
+                       });
+        }
+    }
+}
+
+// ===================== ТОЛСТЫЕ ЛИНИИ =====================
+
+// Прямоугольник вокруг отрезка между центрами концов: -w/2 <= s < w/2 поперек,
+// -1/2 <= t < length + 1/2 вдоль
+static void testThickLines() {
+    struct Case {
+        int16_t x0, y0, x1, y1;
+        uint8_t width;
+    };
+    static const Case cases[] = {
+        {10, 10, 200, 300, 5},
+        {-20, 50, 260, 70, 3},      // Концы за краями холста
+        {120, 10, 120, 300, 4},     // Вертикальная
+        {30, 200, 210, 200, 7},     // Горизонтальная
+        {50, 50, 50, 50, 4},        // Точка - квадрат
+        {5, 300, 230, 5, 2},
+        {0, 0, 239, 319, 1},
+        {100, 150, 140, 110, 9},    // 45 градусов
+    };
+
+    for (const Case& c : cases) {
+        double dx = c.x1 - c.x0;
+        double dy = c.y1 - c.y0;
+        double length = std::hypot(dx, dy);
+        double ux = (length > 0) ? dx / length : 1.0;
+        double uy = (length > 0) ? dy / length : 0.0;
+        double half = c.width / 2.0;
+
+        checkShape("drawThickLine",
+                   [&](auto& canvas) { canvas.drawThickLine(c.x0, c.y0, c.x1, c.y1, c.width, INK); },
+                   [&](int x, int y) {
+                       double rx = x - c.x0;
+                       double ry = y - c.y0;
+                       double s = ux * ry - uy * rx;
+                       double t = ux * rx + uy * ry;
+                       double margin = std::min({s + half, half - s, t + 0.5, length + 0.5 - t});
+                       if (std::fabs(margin) < EDGE_TOLERANCE) return Sample::EDGE;
+                       return sampleIf(margin > 0);
+                   });
+    }
+}
+
+// ===================== ДУГИ =====================
+
+// Кольцо inner^2 <= dx^2 + dy^2 <= outer^2 (точно), сектор от start до end по часовой
+// стрелке от направления вверх; пиксели у лучей сектора не проверяются
+static void testArcs() {
+    struct Case {
+        int16_t start, end;
+        uint16_t inner, outer;
+    };
+    static const Case cases[] = {
+        {0, 90, 40, 60},
+        {45, 300, 0, 70},           // Больше 180 градусов
+        {-30, 30, 20, 100},         // Через 0
+        {270, 90, 10, 50},
+        {0, 360, 30, 40},           // Полное кольцо
+        {10, 10, 5, 50},            // Пустой сектор
+        {100, 200, 0, 30},
+        {180, 0, 15, 25},           // Ровно 180 градусов
+        {0, 135, 50, 50},           // Кольцо толщиной в пиксель
+    };
+    constexpr int16_t CX = 120;
+    constexpr int16_t CY = 160;
+    const double degree = std::acos(-1.0) / 180.0;
+
+    for (const Case& c : cases) {
+        int sweep = ((c.end - c.start) % 360 + 360) % 360;
+        if (sweep == 0 && c.end != c.start) sweep = 360;
+
+        checkShape("fillArc",
+                   [&](auto& canvas) { canvas.fillArc(CX, CY, c.start, c.end, c.inner, c.outer, INK); },
+                   [&](int x, int y) {
+                       int dx = x - CX;
+                       int dy = y - CY;
+                       int d2 = dx * dx + dy * dy;
+                       if (sweep == 0 || d2 < c.inner * c.inner || d2 > c.outer * c.outer) return Sample::OUT;
+                       if (sweep == 360) return Sample::IN;
+                       if (d2 == 0) return Sample::EDGE;
+
+                       // Расстояние до лучей сектора
+                       double radius = std::sqrt(static_cast<double>(d2));
+                       double angle = std::atan2(dx, -dy) / degree;
+                       for (int16_t ray : {c.start, c.end}) {
+                           double diff = std::remainder(angle - ray, 360.0) * degree;
+                           if (std::cos(diff) > 0 && std::fabs(radius * std::sin(diff)) < EDGE_TOLERANCE) {
+                               return Sample::EDGE;
+                           }
+                       }
+                       double relative = std::fmod(angle - c.start + 720.0, 360.0);
+                       return sampleIf(relative <= sweep);
+                   });
+    }
+}
+
+// ===================== МНОГОУГОЛЬНИКИ =====================
+
+// Эталон: луч вправо из центра пикселя, ребра полуоткрыты сверху ([y_top, y_bottom)),
+// пересечение левее центра или на нем считается
+static Sample samplePolygon(const CanvasPoint* points, uint8_t count, FillRule rule, uint8_t subpixel_bits,
+                            int x, int y) {
+    double scale = 1.0 / (1 << subpixel_bits);
+    double px = x + 0.5;
+    double py = y + 0.5;
+    int winding = 0;
+    int crossings = 0;
+    for (uint8_t i = 0; i < count; i++) {
+        const CanvasPoint& a = points[i];
+        const CanvasPoint& b = points[(i + 1) % count];
+        if (a.y == b.y) continue;
+        bool down = b.y > a.y;
+        const CanvasPoint& top = down ? a : b;
+        const CanvasPoint& bottom = down ? b : a;
+        double y_top = top.y * scale;
+        double y_bottom = bottom.y * scale;
+        if (py < y_top || py >= y_bottom) continue;
+
+        double cross_x = top.x * scale + (py - y_top) * (bottom.x - top.x) * scale / (y_bottom - y_top);
+        if (std::fabs(cross_x - px) < 1e-9) return Sample::EDGE;
+        if (cross_x < px) {
+            winding += down ? 1 : -1;
+            crossings++;
+        }
+    }
+    return sampleIf(rule == FillRule::EVEN_ODD ? (crossings & 1) != 0 : winding != 0);
+}
+
+static void testPolygons() {
+    // Пентаграмма: центр - внутри по NON_ZERO (обход дважды) и снаружи по EVEN_ODD
+    const double pi = std::acos(-1.0);
+    CanvasPoint star[5];
+    for (uint8_t i = 0; i < 5; i++) {
+        double angle = i * 4 * pi / 5;
+        star[i] = {static_cast<int16_t>(std::lround(120 + 100 * std::sin(angle))),
+                   static_cast<int16_t>(std::lround(160 - 100 * std::cos(angle)))};
+    }
+    for (FillRule rule : {FillRule::EVEN_ODD, FillRule::NON_ZERO}) {
+        checkShape("fillPolygon star",
+                   [&](auto& canvas) { canvas.fillPolygon(star, 5, INK, rule); },
+                   [&](int x, int y) { return samplePolygon(star, 5, rule, 0, x, y); });
+        uint16_t center = fb_memory[160 * WIDTH + 120];
+        TEST_CHECK(center == (rule == FillRule::NON_ZERO ? INK : 0x0000), "star center %04X, rule %d",
+                   center, static_cast<int>(rule));
+    }
+
+    // Прямоугольник с вершинами в углах пикселей - ровно w x h пикселей
+    const CanvasPoint rect[4] = {{10, 20}, {50, 20}, {50, 60}, {10, 60}};
+    checkShape("fillPolygon rect",
+               [&](auto& canvas) { canvas.fillPolygon(rect, 4, INK); },
+               [&](int x, int y) { return sampleIf(x >= 10 && x < 50 && y >= 20 && y < 60); });
+
+    checkShape("fillTriangle",
+               [&](auto& canvas) { canvas.fillTriangle(-20, 5, 200, 100, 30, 330, INK); },
+               [&](int x, int y) {
+                   const CanvasPoint triangle[3] = {{-20, 5}, {200, 100}, {30, 330}};
+                   return samplePolygon(triangle, 3, FillRule::NON_ZERO, 0, x, y);
+               });
+
+    // Случайные самопересекающиеся многоугольники за краями холста, в том числе с долями пикселя
+    for (uint16_t test = 0; test < 120; test++) {
+        uint8_t subpixel_bits = (test % 3 == 0) ? 4 : 0;
+        uint8_t count = static_cast<uint8_t>(3 + Test_Random() % 10);
+        FillRule rule = (test & 1) ? FillRule::EVEN_ODD : FillRule::NON_ZERO;
+        CanvasPoint points[CANVAS_MAX_POLYGON_POINTS];
+        for (uint8_t i = 0; i < count; i++) {
+            int x = static_cast<int>(Test_Random() % 400) - 80;
+            int y = static_cast<int>(Test_Random() % 480) - 80;
+            int fraction = subpixel_bits ? static_cast<int>(Test_Random() % 16) : 0;
+            points[i] = {static_cast<int16_t>(x * (1 << subpixel_bits) + fraction),
+                         static_cast<int16_t>(y * (1 << subpixel_bits) + fraction)};
+        }
+        checkShape(rule == FillRule::EVEN_ODD ? "fillPolygon even-odd" : "fillPolygon non-zero",
+                   [&](auto& canvas) { canvas.fillPolygon(points, count, INK, rule, subpixel_bits); },
+                   [&](int x, int y) { return samplePolygon(points, count, rule, subpixel_bits, x, y); });
+    }
+}
+
+// ===================== ОБЛАСТЬ ОТСЕЧЕНИЯ =====================
+
+static uint16_t test_image[64 * 48];
+
+static void fillTestImage() {
+    for (uint16_t y = 0; y < 48; y++) {
+        for (uint16_t x = 0; x < 64; x++) {
+            uint16_t noise = static_cast<uint16_t>(Test_Random() & 0x0821);
+            test_image[y * 64 + x] = static_cast<uint16_t>(((x >> 1) << 11) | (y << 5) | ((x + y) & 0x1F)) ^ noise;
+        }
+    }
+}
+
+// Примитив k со сдвигом (dx, dy); ни один не рисует черным, чтобы фон отличался
+template <typename Canvas>
+static void drawPrimitive(Canvas& canvas, uint8_t k, int16_t dx, int16_t dy) {
+    static const CanvasPoint polygon[5] = {{-30, 60}, {90, -40}, {60, 140}, {200, 20}, {-10, 10}};
+    CanvasPoint moved[5];
+    switch (k) {
+        case 0: canvas.fillRect(-5 + dx, -5 + dy, 60, 50, 0x001F); break;
+        case 1: canvas.drawLine(-50 + dx, -20 + dy, 300 + dx, 400 + dy, 0x07E0); break;
+        case 2: canvas.fillCircle(230 + dx, 310 + dy, 40, 0xF800); break;
+        case 3: canvas.drawCircle(-10 + dx, 50 + dy, 30, 0xFFFF); break;
+        case 4: canvas.fillTriangle(-40 + dx, 10 + dy, 100 + dx, -50 + dy, 60 + dx, 120 + dy, 0xABCD); break;
+        case 5:
+            for (uint8_t i = 0; i < 5; i++) moved[i] = {static_cast<int16_t>(polygon[i].x + dx), static_cast<int16_t>(polygon[i].y + dy)};
+            canvas.fillPolygon(moved, 5, 0x7BEF, FillRule::EVEN_ODD);
+            break;
+        case 6: canvas.fillRoundRect(-20 + dx, 280 + dy, 120, 80, 20, 0x5555); break;
+        case 7: canvas.drawRoundRect(20 + dx, 30 + dy, 150, 200, 25, 0x3F3F, 4); break;
+        case 8: canvas.drawThickLine(-20 + dx, 200 + dy, 260 + dx, 180 + dy, 5, 0x7777); break;
+        case 9: canvas.fillArc(60 + dx, 120 + dy, 300, 200, 20, 90, 0x3333); break;
+        case 10: canvas.drawStringScaled(-13 + dx, 100 + dy, "Clip stack", 0xFFFF, 2, 0x0010); break;
+        case 11: canvas.drawStringProp(-7 + dx, 150 + dy, "Proportional text", &FontProp8x16, 0xFFE0, 0x2104); break;
+        case 12: canvas.blit(-15 + dx, 60 + dy, 64, 48, test_image, BLIT_FLIP_X); break;
+        case 13: canvas.blitScaled(-40 + dx, 170 + dy, 150, 90, test_image, 64, 48, ScaleMode::BILINEAR); break;
+    }
+}
+
+constexpr uint8_t PRIMITIVE_COUNT = 14;
+// drawStringProp() с фоном сначала заливает строку, затем пишет ink box глифов поверх
+constexpr uint8_t PRIMITIVE_PROP_TEXT = 11;
+
+static void testClipStack() {
+    ST7789V3& display = TestPanel_Display();
+    Framebuffer& framebuffer = testFramebuffer();
+
+    // Вложенные области пересекаются; при переполнении стека push возвращает false
+    TEST_CHECK(framebuffer.pushClipRect(30, 40, 100, 150), "first push failed");
+    TEST_CHECK(framebuffer.pushClipRect(-50, 100, 120, 300), "nested push failed");
+    CanvasClip clip = framebuffer.getClipRect();
+    TEST_CHECK(clip.x0 == 30 && clip.y0 == 100 && clip.x1 == 70 && clip.y1 == 190,
+               "nested clip (%d, %d)-(%d, %d)", clip.x0, clip.y0, clip.x1, clip.y1);
+    framebuffer.popClipRect();
+    clip = framebuffer.getClipRect();
+    TEST_CHECK(clip.x0 == 30 && clip.y0 == 40 && clip.x1 == 130 && clip.y1 == 190,
+               "clip after pop (%d, %d)-(%d, %d)", clip.x0, clip.y0, clip.x1, clip.y1);
+    framebuffer.popClipRect();
+    clip = framebuffer.getClipRect();
+    TEST_CHECK(clip.x0 == 0 && clip.y0 == 0 && clip.x1 == WIDTH && clip.y1 == HEIGHT,
+               "clip after last pop (%d, %d)-(%d, %d)", clip.x0, clip.y0, clip.x1, clip.y1);
+    for (uint8_t i = 0; i < CANVAS_CLIP_DEPTH; i++) {
+        TEST_CHECK(framebuffer.pushClipRect(i, i, WIDTH, HEIGHT), "push %u failed", i);
+    }
+    TEST_CHECK(!framebuffer.pushClipRect(0, 0, 10, 10), "push past CANVAS_CLIP_DEPTH succeeded");
+    TEST_CHECK(framebuffer.getClipDepth() == CANVAS_CLIP_DEPTH, "depth %u", framebuffer.getClipDepth());
+    framebuffer.resetClip();
+
+    // Внутри области - то же, что без отсечения (эталон с полями), снаружи ничего не пишется
+    struct Rect {
+        int16_t x, y;
+        uint16_t w, h;
+    };
+    static const Rect inner_clips[] = {
+        {-50, -50, 100, 100},
+        {30, 40, 100, 150},
+        {200, 280, 100, 100},
+        {10, 10, 0, 5},             // Пустая область
+    };
+    Framebuffer& reference = referenceFramebuffer();
+    for (const Rect& inner : inner_clips) {
+        for (uint8_t k = 0; k < PRIMITIVE_COUNT; k++) {
+            reference.clear(0x0000);
+            drawPrimitive(reference, k, REF_MARGIN_X, REF_MARGIN_Y);
+
+            clearTargets();
+            display.pushClipRect(5, 7, 220, 300);
+            framebuffer.pushClipRect(5, 7, 220, 300);
+            display.pushClipRect(inner.x, inner.y, inner.w, inner.h);
+            framebuffer.pushClipRect(inner.x, inner.y, inner.w, inner.h);
+            CanvasClip area = framebuffer.getClipRect();
+            drawPrimitive(display, k, 0, 0);
+            drawPrimitive(framebuffer, k, 0, 0);
+            display.resetClip();
+            framebuffer.resetClip();
+            checkTargetsAgree("clip stack", k != PRIMITIVE_PROP_TEXT);
+
+            for (int16_t y = 0; y < HEIGHT; y++) {
+                for (int16_t x = 0; x < WIDTH; x++) {
+                    bool inside = x >= area.x0 && x < area.x1 && y >= area.y0 && y < area.y1;
+                    uint16_t expected = inside ? ref_memory[(y + REF_MARGIN_Y) * REF_WIDTH + x + REF_MARGIN_X] : 0x0000;
+                    TEST_CHECK(fb_memory[y * WIDTH + x] == expected, "clip (%d, %d, %u, %u), primitive %u: (%d, %d) = %04X, expected %04X",
+                               inner.x, inner.y, inner.w, inner.h, k, x, y, fb_memory[y * WIDTH + x], expected);
+                    if (!inside) {
+                        TEST_CHECK(TestPanel_GetWrites(static_cast<uint16_t>(x), static_cast<uint16_t>(y)) == 0,
+                                   "clip (%d, %d, %u, %u), primitive %u: display wrote (%d, %d) outside the clip",
+                                   inner.x, inner.y, inner.w, inner.h, k, x, y);
+                    }
+                }
+            }
+        }
+    }
+}
+
+// ===================== МАСШТАБИРОВАНИЕ =====================
+
+static void testBlitScaled() {
+    ST7789V3& display = TestPanel_Display();
+    Framebuffer& framebuffer = testFramebuffer();
+
+    // Масштаб 1:1 в обоих режимах - копия источника
+    for (ScaleMode mode : {ScaleMode::NEAREST, ScaleMode::BILINEAR}) {
+        clearTargets();
+        display.blitScaled(10, 20, 64, 48, test_image, 64, 48, mode);
+        framebuffer.blitScaled(10, 20, 64, 48, test_image, 64, 48, mode);
+        checkTargetsAgree("blitScaled 1:1");
+        for (uint16_t y = 0; y < 48; y++) {
+            for (uint16_t x = 0; x < 64; x++) {
+                TEST_CHECK(fb_memory[(y + 20) * WIDTH + x + 10] == test_image[y * 64 + x],
+                           "blitScaled 1:1 mode %d: (%u, %u) = %04X, source %04X", static_cast<int>(mode),
+                           x, y, fb_memory[(y + 20) * WIDTH + x + 10], test_image[y * 64 + x]);
+            }
+        }
+    }
+
+    // Отсечение не сдвигает выборку: видимая часть совпадает с изображением без отсечения
+    struct Case {
+        int16_t x, y;
+        uint16_t w, h, src_w, src_h;
+    };
+    static const Case cases[] = {
+        {-50, -30, 400, 300, 64, 48},   // Увеличение за всеми краями
+        {5, 5, 37, 29, 64, 48},         // Уменьшение
+        {100, 200, 300, 300, 7, 5},     // Сильное увеличение
+        {0, 0, 1, 1, 64, 48},
+        {3, 3, 200, 2, 64, 48},
+        {-100, 150, 180, 60, 64, 48},
+    };
+    Framebuffer& reference = referenceFramebuffer();
+    for (ScaleMode mode : {ScaleMode::NEAREST, ScaleMode::BILINEAR}) {
+        for (const Case& c : cases) {
+            reference.clear(0x0000);
+            reference.blitScaled(c.x + REF_MARGIN_X, c.y + REF_MARGIN_Y, c.w, c.h, test_image, c.src_w, c.src_h, mode, 64);
+
+            clearTargets();
+            display.pushClipRect(2, 3, 230, 310);
+            framebuffer.pushClipRect(2, 3, 230, 310);
+            display.blitScaled(c.x, c.y, c.w, c.h, test_image, c.src_w, c.src_h, mode, 64);
+            framebuffer.blitScaled(c.x, c.y, c.w, c.h, test_image, c.src_w, c.src_h, mode, 64);
+            display.popClipRect();
+            framebuffer.popClipRect();
+            checkTargetsAgree("blitScaled clipped");
+
+            for (int16_t y = 0; y < HEIGHT; y++) {
+                for (int16_t x = 0; x < WIDTH; x++) {
+                    bool inside = x >= 2 && x < 232 && y >= 3 && y < 313;
+                    uint16_t expected = inside ? ref_memory[(y + REF_MARGIN_Y) * REF_WIDTH + x + REF_MARGIN_X] : 0x0000;
+                    TEST_CHECK(fb_memory[y * WIDTH + x] == expected,
+                               "blitScaled (%d, %d, %u, %u) from %ux%u, mode %d: (%d, %d) = %04X, expected %04X",
+                               c.x, c.y, c.w, c.h, c.src_w, c.src_h, static_cast<int>(mode), x, y,
+                               fb_memory[y * WIDTH + x], expected);
+                }
+            }
+        }
+    }
+}
+
+int main() {
+    fillTestImage();
+    testRoundRects();
+    testThickLines();
+    testArcs();
+    testPolygons();
+    testClipStack();
+    testBlitScaled();
+    return Test_Result("test_canvas_shapes");
+}
@@ -0,0 +1,46 @@
+#ifndef TEST_COMMON_HPP
+#define TEST_COMMON_HPP
+
+#include <cstdint>
+#include <cstdio>
+
+// Код возврата ctest для пропущенного теста (SKIP_RETURN_CODE)
+constexpr int TEST_SKIPPED = 77;
+
+// Количество проваленных проверок; выводятся только первые, чтобы не засорять журнал
+inline int& Test_Failures() {
+    static int failures = 0;
+    return failures;
+}
+
+#define TEST_CHECK(cond, ...)                                               \
+    do {                                                                    \
+        if (!(cond)) {                                                      \
+            if (Test_Failures()++ < 20) {                                   \
+                std::printf("%s:%d: %s: ", __FILE__, __LINE__, #cond);      \
+                std::printf(__VA_ARGS__);                                   \
+                std::printf("\n");                                          \
+            }                                                               \
+        }                                                                   \
+    } while (0)
+
+// Итог теста для main()
+inline int Test_Result(const char* name) {
+    if (Test_Failures() != 0) {
+        std::printf("%s: %d failures\n", name, Test_Failures());
+        return 1;
+    }
+    std::printf("%s: OK\n", name);
+    return 0;
+}
+
+// Детерминированный генератор (xorshift32): одинаковые данные на всех платформах
+inline uint32_t Test_Random() {
+    static uint32_t state = 0x12345678u;
+    state ^= state << 13;
+    state ^= state >> 17;
+    state ^= state << 5;
+    return state;
+}
+
+#endif
@@ -0,0 +1,138 @@
+#include "convert565.hpp"
+#include "test_common.hpp"
+#include <algorithm>
+#include <vector>
+
+static const int BAYER4[4][4] = {
+    { 0,  8,  2, 10},
+    {12,  4, 14,  6},
+    { 3, 11,  1,  9},
+    {15,  7, 13,  5}
+};
+
+// Эталон: порог (2b + 1) / 32 младшего отбрасываемого уровня добавляется с насыщением
+static uint16_t refPixel(int r, int g, int b, int x, int y, bool dither) {
+    if (dither) {
+        int v = 2 * BAYER4[y & 3][x & 3] + 1;
+        r = std::min(255, r + v / 4);
+        g = std::min(255, g + v / 8);
+        b = std::min(255, b + v / 4);
+    }
+    return static_cast<uint16_t>(((r >> 3) << 11) | ((g >> 2) << 5) | (b >> 3));
+}
+
+static uint16_t refConvert(const uint8_t* p, PixelFormat format, int x, int y, uint8_t flags) {
+    int r, g, b;
+    switch (format) {
+        case PixelFormat::RGB888:
+            r = p[0]; g = p[1]; b = p[2];
+            break;
+        case PixelFormat::BGR888:
+            b = p[0]; g = p[1]; r = p[2];
+            break;
+        case PixelFormat::ARGB8888: {
+            uint32_t word = p[0] | (p[1] << 8) | (p[2] << 16) | (static_cast<uint32_t>(p[3]) << 24);
+            r = (word >> 16) & 0xFF; g = (word >> 8) & 0xFF; b = word & 0xFF;
+            break;
+        }
+        default:
+            r = g = b = p[0];
+            break;
+    }
+    uint16_t color = refPixel(r, g, b, x, y, (flags & CONVERT565_DITHER) != 0);
+    return (flags & CONVERT565_SWAP) ? static_cast<uint16_t>((color >> 8) | (color << 8)) : color;
+}
+
+static uint8_t randomComponent() {
+    // Значения у 255 чаще: на них насыщается сложение с порогом
+    uint32_t r = Test_Random();
+    switch (r & 7) {
+        case 0: return static_cast<uint8_t>(250 + (r >> 8) % 6);
+        case 1: return 0;
+        default: return static_cast<uint8_t>(r >> 8);
+    }
+}
+
+static const char* formatName(PixelFormat format) {
+    switch (format) {
+        case PixelFormat::RGB888:   return "RGB888";
+        case PixelFormat::BGR888:   return "BGR888";
+        case PixelFormat::ARGB8888: return "ARGB8888";
+        default:                    return "GRAY8";
+    }
+}
+
+// Все длины до нескольких векторов AVX2 (хвосты и защита от чтения за концом источника),
+// нечетные смещения источника и приемника, разные фазы матрицы по x и y
+constexpr uint32_t MAX_COUNT = 100;
+constexpr uint32_t GUARD = 3;
+
+static void testSpans() {
+    const PixelFormat formats[] = {PixelFormat::RGB888, PixelFormat::BGR888, PixelFormat::ARGB8888, PixelFormat::GRAY8};
+
+    for (PixelFormat format : formats) {
+        uint32_t bpp = Convert565_BytesPerPixel(format);
+        for (uint8_t flags = 0; flags < 4; flags++) {
+            for (uint32_t count = 0; count <= MAX_COUNT; count++) {
+                uint32_t src_offset = Test_Random() % 4;
+                uint32_t dst_offset = Test_Random() % GUARD;
+                uint16_t x = static_cast<uint16_t>(Test_Random() % 320);
+                uint16_t y = static_cast<uint16_t>(Test_Random() % 320);
+
+                // Источник заканчивается ровно на последнем пикселе: чтение за концом
+                // видно в сборке с -fsanitize=address
+                std::vector<uint8_t> src(src_offset + count * bpp);
+                for (uint8_t& c : src) c = randomComponent();
+                const uint8_t* pixels = src.data() + src_offset;
+
+                std::vector<uint16_t> dst(count + 2 * GUARD, 0xA5A5);
+                Convert565_Span(dst.data() + dst_offset, pixels, format, count, flags, x, y);
+
+                for (uint32_t i = 0; i < dst.size(); i++) {
+                    bool inside = (i >= dst_offset && i < dst_offset + count);
+                    uint32_t k = i - dst_offset;
+                    uint16_t expected = inside
+                        ? refConvert(pixels + k * bpp, format, x + k, y, flags)
+                        : static_cast<uint16_t>(0xA5A5);
+                    TEST_CHECK(dst[i] == expected, "%s flags=%u count=%u x=%u y=%u [%d]: got %04x expected %04x",
+                               formatName(format), flags, count, x, y, static_cast<int>(k), dst[i], expected);
+                }
+            }
+        }
+    }
+}
+
+static void testPhase() {
+    // Соседние отрезки одной строки дают тот же узор, что и строка целиком
+    const uint32_t count = 97;
+    std::vector<uint8_t> src(count * 3);
+    for (uint8_t& c : src) c = randomComponent();
+
+    for (uint16_t y = 0; y < 4; y++) {
+        std::vector<uint16_t> whole(count);
+        std::vector<uint16_t> parts(count);
+        Convert565_Span(whole.data(), src.data(), PixelFormat::RGB888, count, CONVERT565_DITHER, 5, y);
+        for (uint32_t start = 0; start < count;) {
+            uint32_t n = std::min<uint32_t>(1 + Test_Random() % 40, count - start);
+            Convert565_Span(parts.data() + start, src.data() + start * 3, PixelFormat::RGB888, n,
+                            CONVERT565_DITHER, static_cast<uint16_t>(5 + start), y);
+            start += n;
+        }
+        TEST_CHECK(whole == parts, "y=%u: split span differs", y);
+    }
+}
+
+int main() {
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+    // Варианты с -mssse3 / -mavx2 пропускаются на процессорах без этих инструкций
+#if defined(__AVX2__)
+    if (!__builtin_cpu_supports("avx2")) return TEST_SKIPPED;
+#elif defined(__SSSE3__)
+    if (!__builtin_cpu_supports("ssse3")) return TEST_SKIPPED;
+#endif
+#endif
+
+    testSpans();
+    testPhase();
+    return Test_Result("test_convert565");
+}
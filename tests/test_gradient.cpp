@@ -0,0 +1,125 @@
+#include "gradient.hpp"
+#include "test_common.hpp"
+#include <cmath>
+#include <vector>
+
+static const int BAYER4[4][4] = {
+    { 0,  8,  2, 10},
+    {12,  4, 14,  6},
+    { 3, 11,  1,  9},
+    {15,  7, 13,  5}
+};
+
+static double channel(uint16_t color, int index) {
+    switch (index) {
+        case 0:  return (color >> 11) & 0x1F;
+        case 1:  return (color >> 5) & 0x3F;
+        default: return color & 0x1F;
+    }
+}
+
+// Эталонное значение канала в позиции i градиента длиной length (в уровнях канала)
+static double refValue(const GradientStop* stops, int count, int length, int i, int c) {
+    double t = (length > 1) ? i * 255.0 / (length - 1) : 0.0;
+    int k = 0;
+    while (k + 1 < count && stops[k + 1].position <= t) k++;
+    if (t < stops[0].position || k + 1 == count) {
+        return channel(stops[k].color, c);
+    }
+    double f = (t - stops[k].position) / (stops[k + 1].position - stops[k].position);
+    return channel(stops[k].color, c) + (channel(stops[k + 1].color, c) - channel(stops[k].color, c)) * f;
+}
+
+// Сравнение с эталоном. Приращение на пиксель отбрасывает меньше 1/65536 уровня, поэтому
+// уровень может сдвинуться, только если точное значение ближе к порогу, чем накопленная ошибка
+static void checkLine(const uint16_t* line, const GradientStop* stops, int count, int length,
+                      int first, int n, int dither_x, int dither_y) {
+    for (int i = 0; i < n; i++) {
+        double bias = (dither_y < 0) ? 0.5 : (2 * BAYER4[dither_y & 3][(dither_x + i) & 3] + 1) / 32.0;
+        for (int c = 0; c < 3; c++) {
+            double v = refValue(stops, count, length, first + i, c) + bias;
+            double got = channel(line[i], c);
+            bool exact = (got == std::floor(v));
+            double drift = (first + i + 2) / 65536.0;
+            bool near_threshold = std::fabs(v - std::round(v)) < drift && std::fabs(got - std::floor(v)) <= 1;
+            TEST_CHECK(exact || near_threshold, "length=%d pos=%d ch=%d dither=(%d,%d): got %g expected %g",
+                       length, first + i, c, dither_x + i, dither_y, got, std::floor(v));
+        }
+    }
+}
+
+static void testDitherBias() {
+    // Пороги - (2b + 1) / 32 уровня, в среднем по матрице ровно 1/2; фаза по модулю 4,
+    // включая отрицательные координаты
+    int64_t sum = 0;
+    for (int y = 0; y < 4; y++) {
+        for (int x = 0; x < 4; x++) {
+            int32_t bias = Gradient_DitherBias(x, y);
+            TEST_CHECK(bias == (2 * BAYER4[y][x] + 1) * 2048, "bias(%d,%d)=%d", x, y, bias);
+            TEST_CHECK(Gradient_DitherBias(x + 8, y - 4) == bias, "phase (%d,%d)", x, y);
+            TEST_CHECK(Gradient_DitherBias(x - 4, y + 12) == bias, "negative phase (%d,%d)", x, y);
+            sum += bias;
+        }
+    }
+    TEST_CHECK(sum == 16 * GRADIENT_ROUND_BIAS, "mean bias %lld", static_cast<long long>(sum));
+}
+
+static void testLines() {
+    const GradientStop two[] = {{0, 0x0000}, {255, 0xFFFF}};
+    const GradientStop reverse[] = {{0, 0xFFFF}, {255, 0x0000}};
+    // Совпадающие позиции (резкий переход), точки не на краях
+    const GradientStop multi[] = {{0, 0xF800}, {80, 0x07E0}, {80, 0x001F}, {255, 0xFFE0}};
+    const GradientStop inner[] = {{40, 0x1234}, {200, 0xFEDC}};
+    const GradientStop single[] = {{128, 0x5AA5}};
+
+    struct Case {
+        const GradientStop* stops;
+        uint8_t count;
+    };
+    const Case cases[] = {{two, 2}, {reverse, 2}, {multi, 4}, {inner, 2}, {single, 1}};
+    const int lengths[] = {1, 2, 3, 17, 64, 240, 320, 1000};
+
+    std::vector<uint16_t> line(1000);
+    for (const Case& gc : cases) {
+        for (int length : lengths) {
+            for (int dither_y = -1; dither_y < 4; dither_y++) {
+                int dither_x = static_cast<int>(Test_Random() % 7) - 3;
+                Gradient_Line(line.data(), static_cast<uint16_t>(length), gc.stops, gc.count,
+                              length, 0, dither_x, dither_y);
+                checkLine(line.data(), gc.stops, gc.count, length, 0, length, dither_x, dither_y);
+            }
+        }
+    }
+}
+
+static void testFirst() {
+    // Строка с произвольной позиции (отсеченный градиент) совпадает с куском полной строки
+    const GradientStop multi[] = {{0, 0xF800}, {80, 0x07E0}, {80, 0x001F}, {255, 0xFFE0}};
+    const int length = 300;
+    std::vector<uint16_t> full(length);
+    std::vector<uint16_t> part(length);
+
+    for (int dither_y = -1; dither_y < 4; dither_y++) {
+        Gradient_Line(full.data(), length, multi, 4, length, 0, 5, dither_y);
+        for (int first = 0; first < length; first += 13) {
+            uint16_t count = static_cast<uint16_t>(length - first);
+            Gradient_Line(part.data(), count, multi, 4, length, first, 5 + first, dither_y);
+            for (int i = 0; i < count; i++) {
+                TEST_CHECK(part[i] == full[first + i], "first=%d dither_y=%d [%d]: %04x vs %04x",
+                           first, dither_y, i, part[i], full[first + i]);
+            }
+        }
+    }
+
+    // Крайние пиксели - ровно цвета крайних точек
+    const GradientStop two[] = {{0, 0x1234}, {255, 0xFEDC}};
+    Gradient_Line(full.data(), length, two, 2, length, 0, 0, -1);
+    TEST_CHECK(full[0] == 0x1234 && full[length - 1] == 0xFEDC, "ends %04x %04x", full[0], full[length - 1]);
+}
+
+int main() {
+    testDitherBias();
+    testLines();
+    testFirst();
+    return Test_Result("test_gradient");
+}
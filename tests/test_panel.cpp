@@ -0,0 +1,146 @@
+#include "test_panel.hpp"
+#include "main.h"
+#include <algorithm>
+
+static GPIO_TypeDef gpioa = {0};
+GPIO_TypeDef* const GPIOA = &gpioa;
+
+static SPI_TypeDef spi1_regs = {0};
+SPI_HandleTypeDef hspi1 = {&spi1_regs, {SPI_DATASIZE_8BIT}};
+
+namespace {
+
+enum : uint8_t {
+    CMD_CASET = 0x2A,
+    CMD_RASET = 0x2B,
+    CMD_RAMWR = 0x2C,
+    CMD_RAMWRC = 0x3C
+};
+
+uint16_t memory[ST7789_WIDTH * ST7789_HEIGHT];
+uint8_t writes[ST7789_WIDTH * ST7789_HEIGHT];
+uint32_t overruns = 0;
+
+bool data_mode = false;     // DC = 1
+uint8_t command = 0;
+uint8_t args[4];
+uint8_t arg_count = 0;
+uint16_t col_start = 0, col_end = 0, row_start = 0, row_end = 0;
+uint16_t col = 0, row = 0;
+int16_t high_byte = -1;     // Старший байт пикселя, ожидающий младшего
+
+void writePixel(uint16_t color) {
+    if (row > row_end) {
+        overruns++;
+        return;
+    }
+    if (col < ST7789_WIDTH && row < ST7789_HEIGHT) {
+        uint32_t index = static_cast<uint32_t>(row) * ST7789_WIDTH + col;
+        memory[index] = color;
+        if (writes[index] < 255) writes[index]++;
+    }
+    if (++col > col_end) {
+        col = col_start;
+        row++;
+    }
+}
+
+void receiveCommand(uint8_t cmd) {
+    command = cmd;
+    arg_count = 0;
+    high_byte = -1;
+    if (cmd == CMD_RAMWR) {
+        col = col_start;
+        row = row_start;
+    }
+}
+
+void receiveData(uint8_t byte) {
+    if (command == CMD_CASET || command == CMD_RASET) {
+        if (arg_count < 4) args[arg_count++] = byte;
+        if (arg_count == 4) {
+            uint16_t start = static_cast<uint16_t>((args[0] << 8) | args[1]);
+            uint16_t end = static_cast<uint16_t>((args[2] << 8) | args[3]);
+            if (command == CMD_CASET) {
+                col_start = start;
+                col_end = end;
+            } else {
+                row_start = start;
+                row_end = end;
+            }
+        }
+    } else if (command == CMD_RAMWR || command == CMD_RAMWRC) {
+        if (high_byte < 0) {
+            high_byte = byte;
+        } else {
+            writePixel(static_cast<uint16_t>((high_byte << 8) | byte));
+            high_byte = -1;
+        }
+    }
+}
+
+}
+
+ST7789V3& TestPanel_Display() {
+    static ST7789V3 display(&ST7789_SPI_HANDLE,
+                            ST7789_GPIO(ST7789_CS_PORT, ST7789_CS_PIN),
+                            ST7789_GPIO(ST7789_DC_PORT, ST7789_DC_PIN),
+                            ST7789_GPIO(ST7789_RST_PORT, ST7789_RST_PIN));
+    return display;
+}
+
+void TestPanel_Reset(uint16_t color) {
+    std::fill_n(memory, ST7789_WIDTH * ST7789_HEIGHT, color);
+    std::fill_n(writes, ST7789_WIDTH * ST7789_HEIGHT, 0);
+    overruns = 0;
+}
+
+uint16_t TestPanel_GetPixel(uint16_t x, uint16_t y) {
+    return memory[static_cast<uint32_t>(y) * ST7789_WIDTH + x];
+}
+
+uint8_t TestPanel_GetWrites(uint16_t x, uint16_t y) {
+    return writes[static_cast<uint32_t>(y) * ST7789_WIDTH + x];
+}
+
+uint32_t TestPanel_GetOverruns() {
+    return overruns;
+}
+
+// ===================== ЗАГЛУШКА HAL =====================
+
+void HAL_GPIO_WritePin(GPIO_TypeDef* port, uint16_t pin, GPIO_PinState state) {
+    if (port == ST7789_DC_PORT && pin == ST7789_DC_PIN) {
+        data_mode = (state == GPIO_PIN_SET);
+    }
+}
+
+HAL_StatusTypeDef HAL_SPI_Transmit(SPI_HandleTypeDef* hspi, uint8_t* data, uint16_t size, uint32_t) {
+    // В 16-битном режиме size - количество слов, каждое уходит старшим байтом вперед
+    bool words = (hspi->Init.DataSize == SPI_DATASIZE_16BIT);
+    for (uint16_t i = 0; i < size; i++) {
+        if (words) {
+            uint16_t word = reinterpret_cast<const uint16_t*>(data)[i];
+            if (data_mode) {
+                receiveData(static_cast<uint8_t>(word >> 8));
+                receiveData(static_cast<uint8_t>(word & 0xFF));
+            } else {
+                receiveCommand(static_cast<uint8_t>(word & 0xFF));
+            }
+        } else if (data_mode) {
+            receiveData(data[i]);
+        } else {
+            receiveCommand(data[i]);
+        }
+    }
+    return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_SPI_Transmit_DMA(SPI_HandleTypeDef* hspi, uint8_t* data, uint16_t size) {
+    HAL_SPI_Transmit(hspi, data, size, 0);
+    ST7789V3_OnDMAComplete(hspi);
+    return HAL_OK;
+}
+
+void HAL_Delay(uint32_t) {
+}
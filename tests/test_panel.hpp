@@ -0,0 +1,23 @@
+#ifndef TEST_PANEL_HPP
+#define TEST_PANEL_HPP
+
+#include <cstdint>
+#include "st7789v3.hpp"
+
+// Эмулятор панели ST7789V3 поверх заглушки HAL: команды CASET/RASET/RAMWR/RAMWRC
+// и данные пикселей в 8- и 16-битном режиме SPI. Передача DMA завершается сразу,
+// обработчик ST7789V3_OnDMAComplete вызывается из HAL_SPI_Transmit_DMA
+
+// Дисплей, подключенный к эмулятору (пины из st7789v3_config.hpp)
+ST7789V3& TestPanel_Display();
+
+// Заливка памяти панели цветом и сброс счетчиков
+void TestPanel_Reset(uint16_t color = 0x0000);
+
+uint16_t TestPanel_GetPixel(uint16_t x, uint16_t y);
+// Сколько раз пиксель записан после TestPanel_Reset (насыщение на 255)
+uint8_t TestPanel_GetWrites(uint16_t x, uint16_t y);
+// Пиксели, переданные после конца окна (ошибка размера передачи)
+uint32_t TestPanel_GetOverruns();
+
+#endif
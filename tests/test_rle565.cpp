@@ -0,0 +1,166 @@
+#include "rle565.hpp"
+#include "test_common.hpp"
+#include <vector>
+
+// Сборка потока вручную: пакеты задаются явно, чтобы проверять границы формата
+struct Stream {
+    std::vector<uint8_t> bytes;
+    std::vector<uint16_t> pixels;   // Ожидаемый результат распаковки
+
+    void run(uint16_t count, uint16_t color) {
+        bytes.push_back(static_cast<uint8_t>(RLE565_RUN_FLAG | (count - 1)));
+        bytes.push_back(static_cast<uint8_t>(color));
+        bytes.push_back(static_cast<uint8_t>(color >> 8));
+        pixels.insert(pixels.end(), count, color);
+    }
+
+    void literal(uint16_t count) {
+        bytes.push_back(static_cast<uint8_t>(count - 1));
+        for (uint16_t i = 0; i < count; i++) {
+            uint16_t color = static_cast<uint16_t>(Test_Random());
+            bytes.push_back(static_cast<uint8_t>(color));
+            bytes.push_back(static_cast<uint8_t>(color >> 8));
+            pixels.push_back(color);
+        }
+    }
+};
+
+// Распаковка кусками заданного размера (как построчный вывод изображения)
+static std::vector<uint16_t> readAll(Rle565Reader& reader, uint16_t chunk) {
+    std::vector<uint16_t> out;
+    std::vector<uint16_t> buffer(chunk);
+    for (;;) {
+        uint16_t n = Rle565_Read(reader, buffer.data(), chunk);
+        out.insert(out.end(), buffer.begin(), buffer.begin() + n);
+        if (n < chunk) break;
+    }
+    return out;
+}
+
+static void testPackets() {
+    // Пакеты максимальной длины (128), длины 1 и чередование повторов и литералов
+    Stream s;
+    s.run(RLE565_MAX_PACKET, 0xF800);
+    s.literal(RLE565_MAX_PACKET);
+    s.run(1, 0x07E0);
+    s.literal(1);
+    s.run(2, 0x0000);
+    s.literal(3);
+    s.run(RLE565_MAX_PACKET, 0xFFFF);
+
+    static const uint16_t chunks[] = {1, 2, 7, 127, 128, 129, 240, 1000};
+    for (uint16_t chunk : chunks) {
+        Rle565Reader reader;
+        Rle565_Init(reader, s.bytes.data(), static_cast<uint32_t>(s.bytes.size()));
+        std::vector<uint16_t> out = readAll(reader, chunk);
+        TEST_CHECK(out == s.pixels, "chunk=%u: %zu pixels, expected %zu", chunk, out.size(), s.pixels.size());
+    }
+}
+
+static void testTruncated() {
+    Stream s;
+    s.run(5, 0x1234);
+    s.literal(10);
+    std::vector<uint8_t> whole = s.bytes;
+
+    // Обрезанный литерал отбрасывается целиком, повтор перед ним распаковывается
+    for (uint32_t cut = 4; cut < whole.size(); cut++) {
+        Rle565Reader reader;
+        Rle565_Init(reader, whole.data(), cut);
+        uint16_t out[32];
+        uint16_t n = Rle565_Read(reader, out, 32);
+        TEST_CHECK(n == 5, "literal cut at %u: %u pixels", cut, n);
+    }
+
+    // Повтор без цвета или с половиной цвета
+    for (uint32_t cut = 0; cut < 3; cut++) {
+        Rle565Reader reader;
+        Rle565_Init(reader, whole.data(), cut);
+        uint16_t out[32];
+        uint16_t n = Rle565_Read(reader, out, 32);
+        TEST_CHECK(n == 0, "run cut at %u: %u pixels", cut, n);
+    }
+
+    // Пропуск по обрезанному потоку тоже останавливается на целом пакете
+    Rle565Reader reader;
+    Rle565_Init(reader, whole.data(), static_cast<uint32_t>(whole.size() - 1));
+    uint32_t skipped = Rle565_Skip(reader, 100);
+    TEST_CHECK(skipped == 5, "skip over truncated stream: %u pixels", skipped);
+}
+
+static void testSkip() {
+    Stream s;
+    s.literal(40);
+    s.run(100, 0xABCD);
+    s.literal(RLE565_MAX_PACKET);
+    s.run(3, 0x0F0F);
+
+    // Пропуск с любого места внутри повтора и литерала, затем чтение остатка
+    for (uint32_t skip = 0; skip <= s.pixels.size(); skip += 7) {
+        Rle565Reader reader;
+        Rle565_Init(reader, s.bytes.data(), static_cast<uint32_t>(s.bytes.size()));
+        uint32_t skipped = Rle565_Skip(reader, skip);
+        TEST_CHECK(skipped == skip, "skip %u: skipped %u", skip, skipped);
+
+        std::vector<uint16_t> out = readAll(reader, 50);
+        std::vector<uint16_t> expected(s.pixels.begin() + skip, s.pixels.end());
+        TEST_CHECK(out == expected, "skip %u: rest differs", skip);
+    }
+
+    // Пропуск дальше конца возвращает количество пикселей потока
+    Rle565Reader reader;
+    Rle565_Init(reader, s.bytes.data(), static_cast<uint32_t>(s.bytes.size()));
+    uint32_t skipped = Rle565_Skip(reader, 100000);
+    TEST_CHECK(skipped == s.pixels.size(), "skip past end: %u", skipped);
+}
+
+static void testPalette() {
+    const uint16_t colors[] = {0xF800, 0x07E0, 0x001F};
+    uint8_t palette[sizeof(colors)];
+    for (uint32_t i = 0; i < 3; i++) {
+        palette[i * 2] = static_cast<uint8_t>(colors[i]);
+        palette[i * 2 + 1] = static_cast<uint8_t>(colors[i] >> 8);
+    }
+
+    // Повтор индекса 2, литерал с индексами за пределами палитры (черный), повтор индекса 200
+    const uint8_t data[] = {
+        RLE565_RUN_FLAG | 3, 2,
+        4, 0, 1, 3, 255, 2,
+        RLE565_RUN_FLAG | 1, 200
+    };
+    const uint16_t expected[] = {
+        0x001F, 0x001F, 0x001F, 0x001F,
+        0xF800, 0x07E0, 0x0000, 0x0000, 0x001F,
+        0x0000, 0x0000
+    };
+    constexpr uint16_t count = sizeof(expected) / sizeof(expected[0]);
+
+    Rle565Reader reader;
+    Rle565_InitPalette(reader, data, sizeof(data), palette, 3);
+    uint16_t out[count + 4];
+    uint16_t n = Rle565_Read(reader, out, count + 4);
+    TEST_CHECK(n == count, "palette: %u pixels", n);
+    for (uint16_t i = 0; i < n && i < count; i++) {
+        TEST_CHECK(out[i] == expected[i], "palette [%u]: got %04x expected %04x", i, out[i], expected[i]);
+    }
+
+    // Пропуск литерала с палитрой - по байту на пиксель
+    Rle565_InitPalette(reader, data, sizeof(data), palette, 3);
+    Rle565_Skip(reader, 5);
+    n = Rle565_Read(reader, out, 3);
+    TEST_CHECK(n == 3 && out[0] == 0x07E0 && out[1] == 0x0000 && out[2] == 0x0000,
+               "palette skip: %u pixels, %04x %04x %04x", n, out[0], out[1], out[2]);
+
+    // Литерал с палитрой, обрезанный на последнем индексе
+    Rle565_InitPalette(reader, data, 6, palette, 3);
+    n = Rle565_Read(reader, out, count);
+    TEST_CHECK(n == 4, "palette truncated literal: %u pixels", n);
+}
+
+int main() {
+    testPackets();
+    testTruncated();
+    testSkip();
+    testPalette();
+    return Test_Result("test_rle565");
+}
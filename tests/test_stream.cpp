@@ -0,0 +1,81 @@
+#include "st7789v3.hpp"
+#include "framebuffer.hpp"
+#include "test_common.hpp"
+#include "test_panel.hpp"
+
+// Потоковая запись на эмуляторе панели: continueWrite() продолжает прерванное окно
+// командой RAMWRC, а после смены окна (flushRegions) продолжать уже нечего
+
+constexpr uint16_t WIDTH = ST7789_WIDTH;
+constexpr uint16_t HEIGHT = ST7789_HEIGHT;
+
+static uint16_t fb_memory[WIDTH * HEIGHT] ST7789V3_FB_ALIGNED;
+
+static uint16_t patternColor(uint32_t i) {
+    return static_cast<uint16_t>(i * 0x9E37u + 0x1234u);
+}
+
+// Окно 10x4, первые 25 пикселей до endWrite
+static void startInterruptedStream(ST7789V3& display, uint16_t* pixels) {
+    for (uint32_t i = 0; i < 40; i++) pixels[i] = patternColor(i);
+    TEST_CHECK(display.beginWrite(20, 30, 10, 4), "beginWrite failed");
+    display.pushPixels(pixels, 25);
+    display.endWrite();
+    TEST_CHECK(display.getWriteRemaining() == 15, "remaining %u, expected 15", display.getWriteRemaining());
+}
+
+static void testContinue() {
+    ST7789V3& display = TestPanel_Display();
+    TestPanel_Reset(0x0000);
+
+    uint16_t pixels[40];
+    startInterruptedStream(display, pixels);
+    TEST_CHECK(display.continueWrite(), "continueWrite() after endWrite() returned false");
+    display.pushPixels(pixels + 25, 15);
+    display.endWrite();
+    TEST_CHECK(display.getWriteRemaining() == 0, "remaining %u after the window end", display.getWriteRemaining());
+    TEST_CHECK(!display.continueWrite(), "continueWrite() past the window end returned true");
+
+    for (uint32_t i = 0; i < 40; i++) {
+        uint16_t x = static_cast<uint16_t>(20 + i % 10);
+        uint16_t y = static_cast<uint16_t>(30 + i / 10);
+        TEST_CHECK(TestPanel_GetPixel(x, y) == pixels[i], "(%u, %u) = %04X, expected %04X",
+                   x, y, TestPanel_GetPixel(x, y), pixels[i]);
+    }
+    TEST_CHECK(TestPanel_GetOverruns() == 0, "%u pixels past the window", TestPanel_GetOverruns());
+}
+
+// flushRegions() ставит свои окна: RAMWRC после него писал бы в конец последнего региона
+static void testFlushInvalidates(FramebufferMemoryType type) {
+    ST7789V3& display = TestPanel_Display();
+    TestPanel_Reset(0x0000);
+
+    FramebufferMemory memory = {fb_memory, sizeof(fb_memory), type};
+    Framebuffer framebuffer(memory, WIDTH, HEIGHT);
+    framebuffer.clear(0x0000);
+    framebuffer.fillRect(100, 200, 30, 20, 0xF81F);
+    TEST_CHECK(display.setFramebuffer(&framebuffer), "setFramebuffer failed");
+
+    uint16_t pixels[40];
+    startInterruptedStream(display, pixels);
+    const ST7789_Rect rect = {100, 200, 30, 20};
+    display.flushRegions(&rect, 1);
+
+    const char* path = framebuffer.isDMACapable() ? "DMA" : "CPU";
+    TEST_CHECK(!display.continueWrite(), "%s: continueWrite() after flushRegions() returned true", path);
+    TEST_CHECK(display.getWriteRemaining() == 0, "%s: remaining %u after flushRegions()", path, display.getWriteRemaining());
+    for (uint16_t y = 200; y < 220; y++) {
+        for (uint16_t x = 100; x < 130; x++) {
+            TEST_CHECK(TestPanel_GetPixel(x, y) == 0xF81F, "%s: (%u, %u) = %04X after flush", path, x, y, TestPanel_GetPixel(x, y));
+        }
+    }
+    TEST_CHECK(TestPanel_GetOverruns() == 0, "%s: %u pixels past the window", path, TestPanel_GetOverruns());
+    display.setFramebuffer(nullptr);
+}
+
+int main() {
+    testContinue();
+    testFlushInvalidates(FramebufferMemoryType::SRAM);
+    testFlushInvalidates(FramebufferMemoryType::CCM);
+    return Test_Result("test_stream");
+}
@@ -0,0 +1,203 @@
+// st7789v3_anim - кодировщик анимаций для AnimationPlayer (формат - image/animation.hpp).
+//
+//   st7789v3_anim [-d мс] [-k N] [-t размер] [-n имя] -o выход.h кадр0.ppm кадр1.ppm ...
+//
+//   -d  задержка кадра в мс (по умолчанию 40)
+//   -k  ключевой кадр каждые N кадров (по умолчанию 0 - только первый)
+//   -t  размер плитки для поиска изменений (по умолчанию 16)
+//   -n  имя массива в заголовке (по умолчанию animation)
+//   -o  ".h"/".hpp" - заголовок C++, иначе двоичный файл
+//
+// Каждый кадр сравнивается с предыдущим по плиткам; соседние измененные плитки
+// объединяются в прямоугольники, которые сужаются до реально измененных пикселей
+
+#include "image_io.hpp"
+#include "rle565_encode.hpp"
+#include "animation.hpp"
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+struct Rect {
+    uint16_t x, y, w, h;
+};
+
+static void usage() {
+    fprintf(stderr, "usage: st7789v3_anim [-d ms] [-k N] [-t tile] [-n name] -o output frame.ppm...\n");
+}
+
+static bool tileChanged(const HostImage& prev, const HostImage& cur, uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1) {
+    for (uint16_t y = y0; y < y1; y++) {
+        for (uint16_t x = x0; x < x1; x++) {
+            size_t i = static_cast<size_t>(y) * cur.width + x;
+            if (prev.pixels[i] != cur.pixels[i]) return true;
+        }
+    }
+    return false;
+}
+
+// Сужение прямоугольника до измененных пикселей; false - изменений нет
+static bool shrinkRect(const HostImage& prev, const HostImage& cur, Rect& rect) {
+    uint16_t x0 = rect.x + rect.w, y0 = rect.y + rect.h, x1 = rect.x, y1 = rect.y;
+    for (uint16_t y = rect.y; y < rect.y + rect.h; y++) {
+        for (uint16_t x = rect.x; x < rect.x + rect.w; x++) {
+            size_t i = static_cast<size_t>(y) * cur.width + x;
+            if (prev.pixels[i] == cur.pixels[i]) continue;
+            x0 = std::min(x0, x);
+            y0 = std::min(y0, y);
+            x1 = std::max<uint16_t>(x1, x + 1);
+            y1 = std::max<uint16_t>(y1, y + 1);
+        }
+    }
+    if (x0 >= x1) return false;
+    rect = {x0, y0, static_cast<uint16_t>(x1 - x0), static_cast<uint16_t>(y1 - y0)};
+    return true;
+}
+
+static std::vector<Rect> findDirtyRects(const HostImage& prev, const HostImage& cur, uint16_t tile) {
+    std::vector<Rect> closed;
+    std::vector<Rect> open;   // Прямоугольники, доходящие до текущей строки плиток
+
+    for (uint16_t ty = 0; ty < cur.height; ty += tile) {
+        uint16_t th = std::min<uint16_t>(tile, cur.height - ty);
+        std::vector<Rect> next;
+
+        for (uint16_t tx = 0; tx < cur.width; ) {
+            if (!tileChanged(prev, cur, tx, ty, std::min<uint16_t>(tx + tile, cur.width), ty + th)) {
+                tx += tile;
+                continue;
+            }
+            // Серия измененных плиток в строке
+            uint16_t start = tx;
+            while (tx < cur.width && tileChanged(prev, cur, tx, ty, std::min<uint16_t>(tx + tile, cur.width), ty + th)) {
+                tx += tile;
+            }
+            Rect rect = {start, ty, static_cast<uint16_t>(std::min<uint16_t>(tx, cur.width) - start), th};
+
+            // Прямоугольник с теми же колонками из предыдущей строки плиток продлевается вниз
+            auto above = std::find_if(open.begin(), open.end(), [&](const Rect& r) {
+                return r.x == rect.x && r.w == rect.w;
+            });
+            if (above != open.end()) {
+                rect.y = above->y;
+                rect.h += above->h;
+                open.erase(above);
+            }
+            next.push_back(rect);
+        }
+
+        closed.insert(closed.end(), open.begin(), open.end());
+        open = std::move(next);
+    }
+    closed.insert(closed.end(), open.begin(), open.end());
+
+    std::vector<Rect> result;
+    for (Rect rect : closed) {
+        if (shrinkRect(prev, cur, rect)) result.push_back(rect);
+    }
+    return result;
+}
+
+static void encodeRect(const HostImage& image, const Rect& rect, std::vector<uint8_t>& out) {
+    std::vector<uint16_t> pixels;
+    pixels.reserve(static_cast<size_t>(rect.w) * rect.h);
+    for (uint16_t y = rect.y; y < rect.y + rect.h; y++) {
+        const uint16_t* row = image.pixels.data() + static_cast<size_t>(y) * image.width + rect.x;
+        pixels.insert(pixels.end(), row, row + rect.w);
+    }
+
+    std::vector<uint8_t> payload;
+    Rle565_Encode(pixels.data(), static_cast<uint32_t>(pixels.size()), payload);
+
+    HostImage_Put16(out, rect.x);
+    HostImage_Put16(out, rect.y);
+    HostImage_Put16(out, rect.w);
+    HostImage_Put16(out, rect.h);
+    HostImage_Put32(out, static_cast<uint32_t>(payload.size()));
+    out.insert(out.end(), payload.begin(), payload.end());
+}
+
+int main(int argc, char** argv) {
+    uint16_t delay = 40;
+    uint32_t keyframe_interval = 0;
+    uint16_t tile = 16;
+    std::string name = "animation";
+    std::string output;
+    std::vector<std::string> inputs;
+
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        if ((arg == "-d" || arg == "-k" || arg == "-t" || arg == "-n" || arg == "-o") && i + 1 < argc) {
+            std::string value = argv[++i];
+            if (arg == "-d") delay = static_cast<uint16_t>(atoi(value.c_str()));
+            else if (arg == "-k") keyframe_interval = static_cast<uint32_t>(atoi(value.c_str()));
+            else if (arg == "-t") tile = static_cast<uint16_t>(std::max(1, atoi(value.c_str())));
+            else if (arg == "-n") name = value;
+            else output = value;
+        } else if (!arg.empty() && arg[0] == '-') {
+            usage();
+            return 1;
+        } else {
+            inputs.push_back(arg);
+        }
+    }
+    if (output.empty() || inputs.empty() || inputs.size() > 0xFFFF) {
+        usage();
+        return 1;
+    }
+
+    std::vector<uint8_t> out = {'S', '7', 'A', 'N'};
+    HostImage previous;
+    size_t rect_total = 0;
+
+    for (size_t frame = 0; frame < inputs.size(); frame++) {
+        HostImage image;
+        std::string error;
+        if (!HostImage_Load(inputs[frame], image, error)) {
+            fprintf(stderr, "st7789v3_anim: %s\n", error.c_str());
+            return 1;
+        }
+
+        if (frame == 0) {
+            HostImage_Put16(out, image.width);
+            HostImage_Put16(out, image.height);
+            HostImage_Put16(out, static_cast<uint16_t>(inputs.size()));
+            HostImage_Put16(out, 0);
+        } else if (image.width != previous.width || image.height != previous.height) {
+            fprintf(stderr, "st7789v3_anim: %s: frame size differs from the first frame\n", inputs[frame].c_str());
+            return 1;
+        }
+
+        bool keyframe = (frame == 0) || (keyframe_interval > 0 && frame % keyframe_interval == 0);
+        std::vector<Rect> rects;
+        if (keyframe) {
+            rects.push_back({0, 0, image.width, image.height});
+        } else {
+            rects = findDirtyRects(previous, image, tile);
+        }
+
+        out.push_back(keyframe ? ANIMATION_FLAG_KEYFRAME : 0);
+        out.push_back(0);
+        HostImage_Put16(out, delay);
+        HostImage_Put16(out, static_cast<uint16_t>(rects.size()));
+        for (const Rect& rect : rects) {
+            encodeRect(image, rect, out);
+        }
+
+        rect_total += rects.size();
+        previous = std::move(image);
+    }
+
+    std::string comment = "st7789v3_anim: " + std::to_string(inputs.size()) + " frames " +
+                          std::to_string(previous.width) + "x" + std::to_string(previous.height);
+    if (!HostImage_WriteData(output, name, out, comment)) {
+        fprintf(stderr, "st7789v3_anim: cannot write %s\n", output.c_str());
+        return 1;
+    }
+
+    size_t raw = inputs.size() * previous.width * previous.height * 2;
+    printf("%s: %zu frames, %zu rects, %zu bytes (raw %zu)\n", output.c_str(), inputs.size(), rect_total, out.size(), raw);
+    return 0;
+}
@@ -0,0 +1,161 @@
+// st7789v3_asset - генератор заголовка ресурсов изображений (типы - image/asset.hpp).
+// Обычно вызывается из функции CMake st7789v3_add_assets().
+//
+//   st7789v3_asset -o ресурсы.hpp [-N пространство_имен] -a имя формат файл [-a ...]
+//
+// Форматы:
+//   rgb565   - цвета младшим байтом вперед (DMA прямо из flash)
+//   wire     - цвета в порядке передачи на дисплей
+//   palette  - индекс 1 байт на пиксель и палитра (до 256 цветов)
+//   mask     - 1 бит на пиксель: непрозрачный (альфа >= 128) или, без альфы, не черный пиксель
+//   image    - сжатое изображение S7IM (самый компактный из raw, rle, palette)
+
+#include "image_encode.hpp"
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <vector>
+
+struct AssetInput {
+    std::string name;
+    std::string format;
+    std::string path;
+};
+
+static void usage() {
+    fprintf(stderr, "usage: st7789v3_asset -o output.hpp [-N namespace] -a name rgb565|wire|palette|mask|image file...\n");
+}
+
+static std::string fileName(const std::string& path) {
+    size_t slash = path.find_last_of("/\\");
+    return (slash == std::string::npos) ? path : path.substr(slash + 1);
+}
+
+static bool isIdentifier(const std::string& name) {
+    if (name.empty() || isdigit(static_cast<unsigned char>(name[0]))) return false;
+    for (char c : name) {
+        if (!isalnum(static_cast<unsigned char>(c)) && c != '_') return false;
+    }
+    return true;
+}
+
+// Данные ресурса и его тип в asset.hpp
+static bool buildAsset(const AssetInput& input, const HostImage& image, std::vector<uint8_t>& data,
+                       std::vector<uint8_t>& palette, std::string& type, std::string& error) {
+    if (input.format == "rgb565") {
+        type = "RGB565";
+        for (uint16_t color : image.pixels) HostImage_Put16(data, color);
+    } else if (input.format == "wire") {
+        type = "RGB565_WIRE";
+        for (uint16_t color : image.pixels) {
+            data.push_back(static_cast<uint8_t>(color >> 8));
+            data.push_back(static_cast<uint8_t>(color & 0xFF));
+        }
+    } else if (input.format == "palette") {
+        type = "PALETTE8";
+        std::vector<uint16_t> colors;
+        if (!ImageFile_BuildPalette(image, colors, data)) {
+            error = "more than 256 colors, palette format is not possible";
+            return false;
+        }
+        for (uint16_t color : colors) HostImage_Put16(palette, color);
+    } else if (input.format == "mask") {
+        type = "MASK1";
+        size_t stride = (image.width + 7u) / 8u;
+        data.assign(stride * image.height, 0);
+        for (uint16_t y = 0; y < image.height; y++) {
+            for (uint16_t x = 0; x < image.width; x++) {
+                size_t i = static_cast<size_t>(y) * image.width + x;
+                bool opaque = image.alpha.empty() ? (image.pixels[i] != 0) : (image.alpha[i] >= 128);
+                if (opaque) data[y * stride + x / 8] |= static_cast<uint8_t>(0x80 >> (x & 7));
+            }
+        }
+    } else if (input.format == "image") {
+        type = "IMAGE";
+        return ImageFile_Encode(image, ImageFile_ChooseFormat(image), data, error);
+    } else {
+        error = "unknown asset format '" + input.format + "'";
+        return false;
+    }
+    return true;
+}
+
+int main(int argc, char** argv) {
+    std::string output;
+    std::string name_space;
+    std::vector<AssetInput> inputs;
+
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        if (arg == "-o" && i + 1 < argc) {
+            output = argv[++i];
+        } else if (arg == "-N" && i + 1 < argc) {
+            name_space = argv[++i];
+        } else if (arg == "-a" && i + 3 < argc) {
+            inputs.push_back({argv[i + 1], argv[i + 2], argv[i + 3]});
+            i += 3;
+        } else {
+            usage();
+            return 1;
+        }
+    }
+    if (output.empty() || inputs.empty()) {
+        usage();
+        return 1;
+    }
+
+    std::ofstream out(output, std::ios::binary);
+    if (!out) {
+        fprintf(stderr, "st7789v3_asset: cannot write %s\n", output.c_str());
+        return 1;
+    }
+
+    std::string stem = fileName(output);
+    std::string guard = HostImage_Guard(stem.substr(0, stem.find('.')));
+    out << "// Ресурсы изображений, созданы st7789v3_asset при сборке. Не редактировать\n"
+        << "#ifndef " << guard << "\n#define " << guard << "\n\n"
+        << "#include \"asset.hpp\"\n\n";
+    if (!name_space.empty()) {
+        out << "namespace " << name_space << " {\n\n";
+    }
+
+    for (const AssetInput& input : inputs) {
+        HostImage image;
+        std::vector<uint8_t> data;
+        std::vector<uint8_t> palette;
+        std::string type;
+        std::string error;
+
+        if (!isIdentifier(input.name)) {
+            error = "bad asset name '" + input.name + "'";
+        } else if (HostImage_Load(input.path, image, error)) {
+            buildAsset(input, image, data, palette, type, error);
+        }
+        if (!error.empty()) {
+            fprintf(stderr, "st7789v3_asset: %s: %s\n", input.path.c_str(), error.c_str());
+            out.close();
+            remove(output.c_str());
+            return 1;
+        }
+
+        out << "// " << input.name << ": " << fileName(input.path) << ", " << image.width << "x" << image.height
+            << ", " << data.size() + palette.size() << " bytes\n";
+        out << "alignas(4) inline constexpr uint8_t " << input.name << "_data[" << data.size() << "] = ";
+        HostImage_WriteArray(out, data);
+        out << ";\n";
+        if (!palette.empty()) {
+            out << "alignas(4) inline constexpr uint8_t " << input.name << "_palette[" << palette.size() << "] = ";
+            HostImage_WriteArray(out, palette);
+            out << ";\n";
+        }
+        out << "inline constexpr ImageAsset " << input.name << " = {" << image.width << ", " << image.height
+            << ", AssetFormat::" << type << ", " << input.name << "_data, " << data.size() << ", "
+            << (palette.empty() ? "nullptr" : input.name + "_palette") << ", " << palette.size() / 2 << "};\n\n";
+    }
+
+    if (!name_space.empty()) {
+        out << "} // namespace " << name_space << "\n\n";
+    }
+    out << "#endif\n";
+    return out ? 0 : 1;
+}
@@ -0,0 +1,79 @@
+#include "image_encode.hpp"
+#include "rle565_encode.hpp"
+#include <map>
+
+bool ImageFile_BuildPalette(const HostImage& image, std::vector<uint16_t>& palette, std::vector<uint8_t>& indices) {
+    std::map<uint16_t, uint8_t> lookup;
+    palette.clear();
+    indices.clear();
+    indices.reserve(image.pixels.size());
+
+    for (uint16_t color : image.pixels) {
+        auto it = lookup.find(color);
+        if (it == lookup.end()) {
+            if (palette.size() == 256) return false;
+            it = lookup.emplace(color, static_cast<uint8_t>(palette.size())).first;
+            palette.push_back(color);
+        }
+        indices.push_back(it->second);
+    }
+    return true;
+}
+
+bool ImageFile_Encode(const HostImage& image, ImageFormat format, std::vector<uint8_t>& out, std::string& error) {
+    std::vector<uint16_t> palette;
+    std::vector<uint8_t> indices;
+    bool indexed = (format == ImageFormat::PALETTE_RLE || format == ImageFormat::PALETTE8);
+    if (indexed && !ImageFile_BuildPalette(image, palette, indices)) {
+        error = "more than 256 colors, palette format is not possible";
+        return false;
+    }
+
+    static const uint8_t magic[4] = {'S', '7', 'I', 'M'};
+    out.assign(magic, magic + 4);
+    HostImage_Put16(out, image.width);
+    HostImage_Put16(out, image.height);
+    out.push_back(static_cast<uint8_t>(format));
+    out.push_back(static_cast<uint8_t>(palette.size() & 0xFF)); // 256 цветов записываются как 0
+    HostImage_Put16(out, 0);
+
+    uint32_t count = static_cast<uint32_t>(image.pixels.size());
+    switch (format) {
+        case ImageFormat::RAW565:
+            for (uint16_t color : image.pixels) HostImage_Put16(out, color);
+            break;
+        case ImageFormat::RLE565:
+            Rle565_Encode(image.pixels.data(), count, out);
+            break;
+        case ImageFormat::PALETTE_RLE:
+            for (uint16_t color : palette) HostImage_Put16(out, color);
+            Rle565_EncodeIndices(indices.data(), count, out);
+            break;
+        case ImageFormat::RAW565_WIRE:
+            for (uint16_t color : image.pixels) {
+                out.push_back(static_cast<uint8_t>(color >> 8));
+                out.push_back(static_cast<uint8_t>(color & 0xFF));
+            }
+            break;
+        case ImageFormat::PALETTE8:
+            for (uint16_t color : palette) HostImage_Put16(out, color);
+            out.insert(out.end(), indices.begin(), indices.end());
+            break;
+    }
+    return true;
+}
+
+ImageFormat ImageFile_ChooseFormat(const HostImage& image) {
+    ImageFormat best = ImageFormat::RAW565;
+    size_t best_size = image.pixels.size() * 2;
+    std::string error;
+
+    for (ImageFormat format : {ImageFormat::RLE565, ImageFormat::PALETTE_RLE}) {
+        std::vector<uint8_t> data;
+        if (ImageFile_Encode(image, format, data, error) && data.size() < best_size) {
+            best = format;
+            best_size = data.size();
+        }
+    }
+    return best;
+}
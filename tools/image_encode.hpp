@@ -0,0 +1,19 @@
+#ifndef IMAGE_ENCODE_HPP
+#define IMAGE_ENCODE_HPP
+
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "image.hpp"
+#include "image_io.hpp"
+
+// Таблица палитры изображения; false - больше 256 цветов
+bool ImageFile_BuildPalette(const HostImage& image, std::vector<uint16_t>& palette, std::vector<uint8_t>& indices);
+
+// Изображение в формате S7IM (image/image.hpp)
+bool ImageFile_Encode(const HostImage& image, ImageFormat format, std::vector<uint8_t>& out, std::string& error);
+
+// Самый компактный из доступных форматов
+ImageFormat ImageFile_ChooseFormat(const HostImage& image);
+
+#endif
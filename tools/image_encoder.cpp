@@ -0,0 +1,88 @@
+// st7789v3_image - кодировщик изображений для ImageDecoder (формат - image/image.hpp).
+//
+//   st7789v3_image [-f raw|wire|rle|palette|palette8|auto] [-n имя] -o выход.h картинка
+//
+//   -f  формат (по умолчанию auto - самый компактный из raw, rle, palette)
+//   -n  имя массива в заголовке (по умолчанию image)
+//   -o  ".h"/".hpp" - заголовок C++, иначе двоичный файл
+
+#include "image_encode.hpp"
+#include <cstdio>
+#include <string>
+
+static void usage() {
+    fprintf(stderr, "usage: st7789v3_image [-f raw|wire|rle|palette|palette8|auto] [-n name] -o output image\n");
+}
+
+static const char* formatName(ImageFormat format) {
+    switch (format) {
+        case ImageFormat::RAW565: return "raw";
+        case ImageFormat::RLE565: return "rle";
+        case ImageFormat::PALETTE_RLE: return "palette";
+        case ImageFormat::RAW565_WIRE: return "wire";
+        case ImageFormat::PALETTE8: return "palette8";
+    }
+    return "?";
+}
+
+int main(int argc, char** argv) {
+    std::string format_arg = "auto";
+    std::string name = "image";
+    std::string output;
+    std::string input;
+
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        if ((arg == "-f" || arg == "-n" || arg == "-o") && i + 1 < argc) {
+            std::string value = argv[++i];
+            if (arg == "-f") format_arg = value;
+            else if (arg == "-n") name = value;
+            else output = value;
+        } else if (!arg.empty() && arg[0] != '-' && input.empty()) {
+            input = arg;
+        } else {
+            usage();
+            return 1;
+        }
+    }
+    if (output.empty() || input.empty()) {
+        usage();
+        return 1;
+    }
+
+    HostImage image;
+    std::string error;
+    if (!HostImage_Load(input, image, error)) {
+        fprintf(stderr, "st7789v3_image: %s\n", error.c_str());
+        return 1;
+    }
+
+    ImageFormat format;
+    if (format_arg == "raw") format = ImageFormat::RAW565;
+    else if (format_arg == "rle") format = ImageFormat::RLE565;
+    else if (format_arg == "wire") format = ImageFormat::RAW565_WIRE;
+    else if (format_arg == "palette") format = ImageFormat::PALETTE_RLE;
+    else if (format_arg == "palette8") format = ImageFormat::PALETTE8;
+    else if (format_arg == "auto") format = ImageFile_ChooseFormat(image);
+    else {
+        usage();
+        return 1;
+    }
+
+    std::vector<uint8_t> data;
+    if (!ImageFile_Encode(image, format, data, error)) {
+        fprintf(stderr, "st7789v3_image: %s: %s\n", input.c_str(), error.c_str());
+        return 1;
+    }
+
+    std::string comment = "st7789v3_image: " + std::to_string(image.width) + "x" +
+                          std::to_string(image.height) + ", " + formatName(format);
+    if (!HostImage_WriteData(output, name, data, comment)) {
+        fprintf(stderr, "st7789v3_image: cannot write %s\n", output.c_str());
+        return 1;
+    }
+
+    printf("%s: %ux%u %s, %zu bytes (raw %zu)\n", output.c_str(), image.width, image.height,
+           formatName(format), data.size(), image.pixels.size() * 2);
+    return 0;
+}
@@ -0,0 +1,238 @@
+#include "image_io.hpp"
+#include <cctype>
+#include <fstream>
+#include <iterator>
+
+#ifdef ST7789V3_TOOLS_HAVE_PNG
+#include <png.h>
+#endif
+
+uint16_t HostImage_ToRGB565(uint8_t r, uint8_t g, uint8_t b) {
+    return static_cast<uint16_t>(((r & 0xF8) << 8) | ((g & 0xFC) << 3) | (b >> 3));
+}
+
+// Число из заголовка PPM (с пропуском пробелов и комментариев)
+static bool readPnmNumber(const std::vector<uint8_t>& file, size_t& pos, uint32_t& value) {
+    while (pos < file.size()) {
+        if (file[pos] == '#') {
+            while (pos < file.size() && file[pos] != '\n') pos++;
+        } else if (isspace(file[pos])) {
+            pos++;
+        } else {
+            break;
+        }
+    }
+    if (pos >= file.size() || !isdigit(file[pos])) {
+        return false;
+    }
+    value = 0;
+    while (pos < file.size() && isdigit(file[pos])) {
+        value = value * 10 + (file[pos++] - '0');
+        if (value > 65535) return false;
+    }
+    return true;
+}
+
+static bool loadPpm(const std::vector<uint8_t>& file, HostImage& image, std::string& error) {
+    size_t pos = 2;
+    uint32_t width, height, maxval;
+    if (!readPnmNumber(file, pos, width) || !readPnmNumber(file, pos, height) ||
+        !readPnmNumber(file, pos, maxval)) {
+        error = "broken PPM header";
+        return false;
+    }
+    pos++; // Один пробельный символ после maxval
+
+    if (maxval != 255 || width == 0 || height == 0) {
+        error = "only 8-bit PPM is supported";
+        return false;
+    }
+    size_t size = static_cast<size_t>(width) * height * 3;
+    if (file.size() - pos < size) {
+        error = "truncated PPM data";
+        return false;
+    }
+
+    image.width = static_cast<uint16_t>(width);
+    image.height = static_cast<uint16_t>(height);
+    image.rgb.assign(file.begin() + pos, file.begin() + pos + size);
+    return true;
+}
+
+static uint32_t readLe32(const std::vector<uint8_t>& file, size_t pos) {
+    return static_cast<uint32_t>(file[pos]) | (static_cast<uint32_t>(file[pos + 1]) << 8) |
+           (static_cast<uint32_t>(file[pos + 2]) << 16) | (static_cast<uint32_t>(file[pos + 3]) << 24);
+}
+
+static bool loadBmp(const std::vector<uint8_t>& file, HostImage& image, std::string& error) {
+    if (file.size() < 54) {
+        error = "truncated BMP header";
+        return false;
+    }
+
+    uint32_t offset = readLe32(file, 10);
+    int32_t width = static_cast<int32_t>(readLe32(file, 18));
+    int32_t height = static_cast<int32_t>(readLe32(file, 22));
+    uint16_t bits = static_cast<uint16_t>(file[28] | (file[29] << 8));
+    uint32_t compression = readLe32(file, 30);
+
+    // BI_RGB; BI_BITFIELDS допускается для 32 бит со стандартными масками BGRA
+    if ((bits != 24 && bits != 32) || (compression != 0 && !(compression == 3 && bits == 32))) {
+        error = "only uncompressed 24/32-bit BMP is supported";
+        return false;
+    }
+    bool top_down = height < 0;
+    if (top_down) height = -height;
+    if (width <= 0 || height <= 0 || width > 65535 || height > 65535) {
+        error = "bad BMP size";
+        return false;
+    }
+
+    uint32_t bytes = bits / 8;
+    size_t stride = (static_cast<size_t>(width) * bytes + 3) & ~static_cast<size_t>(3);
+    if (offset > file.size() || file.size() - offset < stride * height) {
+        error = "truncated BMP data";
+        return false;
+    }
+
+    image.width = static_cast<uint16_t>(width);
+    image.height = static_cast<uint16_t>(height);
+    image.rgb.resize(static_cast<size_t>(width) * height * 3);
+    if (bits == 32) {
+        image.alpha.resize(static_cast<size_t>(width) * height);
+    }
+
+    // Строки BMP хранятся снизу вверх (если высота не отрицательная), пиксели - BGR(A)
+    for (int32_t y = 0; y < height; y++) {
+        const uint8_t* row = file.data() + offset + stride * (top_down ? y : height - 1 - y);
+        for (int32_t x = 0; x < width; x++) {
+            size_t i = static_cast<size_t>(y) * width + x;
+            image.rgb[i * 3] = row[x * bytes + 2];
+            image.rgb[i * 3 + 1] = row[x * bytes + 1];
+            image.rgb[i * 3 + 2] = row[x * bytes];
+            if (bits == 32) image.alpha[i] = row[x * bytes + 3];
+        }
+    }
+    return true;
+}
+
+#ifdef ST7789V3_TOOLS_HAVE_PNG
+static bool loadPng(const std::vector<uint8_t>& file, HostImage& image, std::string& error) {
+    png_image png = {};
+    png.version = PNG_IMAGE_VERSION;
+    if (!png_image_begin_read_from_memory(&png, file.data(), file.size())) {
+        error = png.message;
+        return false;
+    }
+
+    png.format = PNG_FORMAT_RGBA;
+    std::vector<uint8_t> rgba(PNG_IMAGE_SIZE(png));
+    if (png.width > 65535 || png.height > 65535 ||
+        !png_image_finish_read(&png, nullptr, rgba.data(), 0, nullptr)) {
+        error = (png.warning_or_error != 0) ? png.message : "bad PNG size";
+        png_image_free(&png);
+        return false;
+    }
+
+    image.width = static_cast<uint16_t>(png.width);
+    image.height = static_cast<uint16_t>(png.height);
+    size_t count = static_cast<size_t>(png.width) * png.height;
+    image.rgb.resize(count * 3);
+    image.alpha.resize(count);
+    for (size_t i = 0; i < count; i++) {
+        image.rgb[i * 3] = rgba[i * 4];
+        image.rgb[i * 3 + 1] = rgba[i * 4 + 1];
+        image.rgb[i * 3 + 2] = rgba[i * 4 + 2];
+        image.alpha[i] = rgba[i * 4 + 3];
+    }
+    return true;
+}
+#endif
+
+bool HostImage_Load(const std::string& path, HostImage& image, std::string& error) {
+    std::ifstream in(path, std::ios::binary);
+    if (!in) {
+        error = "cannot open " + path;
+        return false;
+    }
+    std::vector<uint8_t> file((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+
+    bool loaded = false;
+    if (file.size() > 2 && file[0] == 'P' && file[1] == '6') {
+        loaded = loadPpm(file, image, error);
+    } else if (file.size() > 2 && file[0] == 'B' && file[1] == 'M') {
+        loaded = loadBmp(file, image, error);
+    } else if (file.size() > 8 && file[0] == 0x89 && file[1] == 'P' && file[2] == 'N' && file[3] == 'G') {
+#ifdef ST7789V3_TOOLS_HAVE_PNG
+        loaded = loadPng(file, image, error);
+#else
+        error = "PNG support is not built (libpng not found)";
+#endif
+    } else {
+        error = "unsupported image format";
+    }
+    if (!loaded) {
+        error = path + ": " + error;
+        return false;
+    }
+
+    image.pixels.resize(static_cast<size_t>(image.width) * image.height);
+    for (size_t i = 0; i < image.pixels.size(); i++) {
+        image.pixels[i] = HostImage_ToRGB565(image.rgb[i * 3], image.rgb[i * 3 + 1], image.rgb[i * 3 + 2]);
+    }
+    return true;
+}
+
+static bool endsWith(const std::string& text, const std::string& suffix) {
+    return text.size() >= suffix.size() && text.compare(text.size() - suffix.size(), suffix.size(), suffix) == 0;
+}
+
+void HostImage_WriteArray(std::ostream& out, const std::vector<uint8_t>& data) {
+    static const char digits[] = "0123456789ABCDEF";
+    out << "{";
+    for (size_t i = 0; i < data.size(); i++) {
+        out << ((i % 16 == 0) ? "\n    " : " ") << "0x" << digits[data[i] >> 4] << digits[data[i] & 0x0F] << ",";
+    }
+    out << "\n}";
+}
+
+std::string HostImage_Guard(const std::string& name) {
+    std::string guard;
+    for (char c : name) {
+        guard += isalnum(static_cast<unsigned char>(c)) ? static_cast<char>(toupper(static_cast<unsigned char>(c))) : '_';
+    }
+    return guard + "_DATA_HPP";
+}
+
+bool HostImage_WriteData(const std::string& path, const std::string& name,
+                         const std::vector<uint8_t>& data, const std::string& comment) {
+    std::ofstream out(path, std::ios::binary);
+    if (!out) {
+        return false;
+    }
+
+    if (!endsWith(path, ".h") && !endsWith(path, ".hpp")) {
+        out.write(reinterpret_cast<const char*>(data.data()), static_cast<std::streamsize>(data.size()));
+        return static_cast<bool>(out);
+    }
+
+    std::string guard = HostImage_Guard(name);
+    out << "// " << comment << "\n"
+        << "// Файл создан автоматически, не редактировать\n"
+        << "#ifndef " << guard << "\n#define " << guard << "\n\n"
+        << "#include <cstdint>\n\n"
+        << "alignas(4) inline constexpr uint8_t " << name << "[" << data.size() << "] = ";
+    HostImage_WriteArray(out, data);
+    out << ";\n\n#endif\n";
+    return static_cast<bool>(out);
+}
+
+void HostImage_Put16(std::vector<uint8_t>& out, uint16_t value) {
+    out.push_back(static_cast<uint8_t>(value & 0xFF));
+    out.push_back(static_cast<uint8_t>(value >> 8));
+}
+
+void HostImage_Put32(std::vector<uint8_t>& out, uint32_t value) {
+    HostImage_Put16(out, static_cast<uint16_t>(value & 0xFFFF));
+    HostImage_Put16(out, static_cast<uint16_t>(value >> 16));
+}
@@ -0,0 +1,37 @@
+#ifndef IMAGE_IO_HPP
+#define IMAGE_IO_HPP
+
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <vector>
+
+// Изображение, загруженное на компьютере разработчика
+struct HostImage {
+    uint16_t width = 0;
+    uint16_t height = 0;
+    std::vector<uint8_t> rgb;       // 3 байта на пиксель (R, G, B)
+    std::vector<uint8_t> alpha;     // Прозрачность (пусто, если в файле ее нет)
+    std::vector<uint16_t> pixels;   // RGB565
+};
+
+// Загрузка PPM (P6, 8 бит на канал), BMP (24/32 бита без сжатия) и PNG
+// (если инструменты собраны с libpng). При ошибке error содержит причину
+bool HostImage_Load(const std::string& path, HostImage& image, std::string& error);
+
+uint16_t HostImage_ToRGB565(uint8_t r, uint8_t g, uint8_t b);
+
+// Массив байтов в виде инициализатора C++ (по 16 байт в строке)
+void HostImage_WriteArray(std::ostream& out, const std::vector<uint8_t>& data);
+// Имя защиты заголовка из имени массива
+std::string HostImage_Guard(const std::string& name);
+
+// Запись данных: ".h"/".hpp" - заголовок C++ с массивом name, иначе - двоичный файл
+bool HostImage_WriteData(const std::string& path, const std::string& name,
+                         const std::vector<uint8_t>& data, const std::string& comment);
+
+// Запись чисел младшим байтом вперед
+void HostImage_Put16(std::vector<uint8_t>& out, uint16_t value);
+void HostImage_Put32(std::vector<uint8_t>& out, uint32_t value);
+
+#endif
@@ -0,0 +1,54 @@
+#include "rle565_encode.hpp"
+#include "image_io.hpp"
+#include "rle565.hpp"
+
+// Минимальная серия, которую выгодно кодировать повтором
+static constexpr uint32_t MIN_RUN = 3;
+
+static void putPixel(std::vector<uint8_t>& out, uint16_t color) {
+    HostImage_Put16(out, color);
+}
+
+static void putPixel(std::vector<uint8_t>& out, uint8_t index) {
+    out.push_back(index);
+}
+
+template <typename Pixel>
+static uint32_t runLength(const Pixel* pixels, uint32_t count, uint32_t pos) {
+    uint32_t n = 1;
+    while (pos + n < count && n < RLE565_MAX_PACKET && pixels[pos + n] == pixels[pos]) n++;
+    return n;
+}
+
+template <typename Pixel>
+static void encode(const Pixel* pixels, uint32_t count, std::vector<uint8_t>& out) {
+    uint32_t pos = 0;
+
+    while (pos < count) {
+        uint32_t run = runLength(pixels, count, pos);
+        if (run >= MIN_RUN) {
+            out.push_back(static_cast<uint8_t>(RLE565_RUN_FLAG | (run - 1)));
+            putPixel(out, pixels[pos]);
+            pos += run;
+            continue;
+        }
+
+        // Литерал продолжается до начала следующей выгодной серии
+        uint32_t start = pos;
+        while (pos < count && pos - start < RLE565_MAX_PACKET && runLength(pixels, count, pos) < MIN_RUN) {
+            pos++;
+        }
+        out.push_back(static_cast<uint8_t>(pos - start - 1));
+        for (uint32_t i = start; i < pos; i++) {
+            putPixel(out, pixels[i]);
+        }
+    }
+}
+
+void Rle565_Encode(const uint16_t* pixels, uint32_t count, std::vector<uint8_t>& out) {
+    encode(pixels, count, out);
+}
+
+void Rle565_EncodeIndices(const uint8_t* indices, uint32_t count, std::vector<uint8_t>& out) {
+    encode(indices, count, out);
+}
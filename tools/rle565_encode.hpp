@@ -0,0 +1,13 @@
+#ifndef RLE565_ENCODE_HPP
+#define RLE565_ENCODE_HPP
+
+#include <cstdint>
+#include <vector>
+
+// Сжатие пикселей в поток Rle565 (формат - image/rle565.hpp).
+// Повтором кодируются серии от трех одинаковых пикселей, остальное - литералами
+void Rle565_Encode(const uint16_t* pixels, uint32_t count, std::vector<uint8_t>& out);
+// То же для индексов палитры (поток Rle565 с палитрой)
+void Rle565_EncodeIndices(const uint8_t* indices, uint32_t count, std::vector<uint8_t>& out);
+
+#endif
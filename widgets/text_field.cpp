@@ -0,0 +1,61 @@
+#include "text_field.hpp"
+#include "st7789v3.hpp"
+#include "../fonts/font8x16.hpp"
+
+TextField::TextField(ST7789V3& display, uint16_t x, uint16_t y, uint8_t max_chars,
+                     uint16_t color, uint16_t bg_color, uint8_t scale)
+    : display_(display), x_(x), y_(y), max_chars_(max_chars), scale_(scale),
+      color_(color), bg_color_(bg_color), valid_(false), codepoints_() {
+    if (max_chars_ > TEXT_FIELD_MAX_CHARS) max_chars_ = TEXT_FIELD_MAX_CHARS;
+    if (scale_ == 0) scale_ = 1;
+    if (scale_ > 8) scale_ = 8;
+}
+
+void TextField::setColors(uint16_t color, uint16_t bg_color) {
+    if (color != color_ || bg_color != bg_color_) {
+        color_ = color;
+        bg_color_ = bg_color;
+        valid_ = false;
+    }
+}
+
+uint16_t TextField::getWidth() const {
+    return static_cast<uint16_t>(max_chars_) * ST7789_Font::CHAR_WIDTH * scale_;
+}
+
+uint16_t TextField::getHeight() const {
+    return static_cast<uint16_t>(ST7789_Font::CHAR_HEIGHT) * scale_;
+}
+
+void TextField::setText(const char* utf8_str) {
+    // Декодируем новую строку в ячейки
+    uint32_t next[TEXT_FIELD_MAX_CHARS];
+    const char* ptr = (utf8_str != nullptr) ? utf8_str : "";
+    uint8_t length = UTF8_DecodeBatch(&ptr, next, max_chars_);
+    
+    while (length < max_chars_) {
+        next[length++] = ' ';
+    }
+    
+    uint16_t cell_width = ST7789_Font::CHAR_WIDTH * scale_;
+    uint8_t i = 0;
+    
+    while (i < max_chars_) {
+        if (valid_ && next[i] == codepoints_[i]) {
+            i++;
+            continue;
+        }
+        
+        // Отрезок подряд идущих изменившихся ячеек
+        uint8_t start = i;
+        while (i < max_chars_ && (!valid_ || next[i] != codepoints_[i])) {
+            codepoints_[i] = next[i];
+            i++;
+        }
+        
+        display_.drawTextCells(x_ + start * cell_width, y_, &codepoints_[start], i - start,
+                               color_, scale_, bg_color_);
+    }
+    
+    valid_ = true;
+}
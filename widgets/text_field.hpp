@@ -0,0 +1,42 @@
+#ifndef TEXT_FIELD_HPP
+#define TEXT_FIELD_HPP
+
+#include <cstdint>
+
+class ST7789V3;
+
+// Максимальная длина поля в символах
+constexpr uint8_t TEXT_FIELD_MAX_CHARS = 30;
+
+// Текстовое поле фиксированного размера с инкрементальным обновлением.
+// Поле занимает max_chars ячеек шрифта 8x16 (с масштабом) и помнит последние
+// отрисованные символы. При setText() перерисовываются и передаются на дисплей
+// только изменившиеся ячейки, соседние изменения объединяются в один отрезок.
+class TextField {
+private:
+    ST7789V3& display_;
+    uint16_t x_;
+    uint16_t y_;
+    uint8_t max_chars_;
+    uint8_t scale_;
+    uint16_t color_;
+    uint16_t bg_color_;
+    bool valid_;                                  // false - требуется полная перерисовка
+    uint32_t codepoints_[TEXT_FIELD_MAX_CHARS];   // Отрисованные символы
+    
+public:
+    TextField(ST7789V3& display, uint16_t x, uint16_t y, uint8_t max_chars,
+              uint16_t color, uint16_t bg_color, uint8_t scale = 1);
+    
+    // Обновить текст (UTF-8). Недостающие ячейки заполняются пробелами
+    void setText(const char* utf8_str);
+    
+    // Смена цветов приводит к полной перерисовке при следующем setText()
+    void setColors(uint16_t color, uint16_t bg_color);
+    void invalidate() { valid_ = false; }
+    
+    uint16_t getWidth() const;
+    uint16_t getHeight() const;
+};
+
+#endif